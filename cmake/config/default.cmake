@@ -45,6 +45,8 @@ option(HYPERVISOR_BUILD_LOADER "Turns on/off building the loader" ON)
 option(HYPERVISOR_BUILD_VMMCTL "Turns on/off building the vmmctl" ${HYPERVISOR_DEFAULT_BUILD_VMMCTL})
 option(HYPERVISOR_BUILD_MICROKERNEL "Turns on/off building the microkernel" ON)
 option(HYPERVISOR_BUILD_EFI "Turns on/off building the EFI loader" ${HYPERVISOR_DEFAULT_BUILD_EFI})
+option(HYPERVISOR_LOCK_STATS "Turns on/off the microkernel's lock contention statistics" OFF)
+option(HYPERVISOR_BUILD_BENCHMARKS "Turns on/off building the host-side benchmarks" OFF)
 
 if(NOT DEFINED HYPERVISOR_TARGET_ARCH)
     if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
@@ -196,7 +198,7 @@ bf_add_config(
     CONFIG_NAME HYPERVISOR_DEBUG_RING_SIZE
     CONFIG_TYPE STRING
     DEFAULT_VAL "0x1FFF0"
-    DESCRIPTION "Defines the hypervisor's debug ring size in bytes"
+    DESCRIPTION "Defines the size in bytes of the debug ring given to each PP"
     SKIP_VALIDATION
 )
 
@@ -360,6 +362,14 @@ bf_add_config(
     OPTIONS 0x0000200000000000
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_EXT_FAULT_AROUND_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0x10000"
+    DESCRIPTION "Defines how many bytes around a direct map page fault are mapped"
+    OPTIONS 0x1000 0x10000 0x200000
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_EXT_STACK_ADDR
     CONFIG_TYPE STRING
@@ -68,6 +68,7 @@ macro(hypervisor_add_cmake_args)
         -DHYPERVISOR_PAGE_SIZE=${HYPERVISOR_PAGE_SIZE}
         -DHYPERVISOR_PAGE_SHIFT=${HYPERVISOR_PAGE_SHIFT}
         -DHYPERVISOR_DEBUG_RING_SIZE=${HYPERVISOR_DEBUG_RING_SIZE}
+        -DHYPERVISOR_LOCK_STATS=${HYPERVISOR_LOCK_STATS}
         -DHYPERVISOR_VMEXIT_LOG_SIZE=${HYPERVISOR_VMEXIT_LOG_SIZE}
         -DHYPERVISOR_MAX_ELF_FILE_SIZE=${HYPERVISOR_MAX_ELF_FILE_SIZE}
         -DHYPERVISOR_MAX_SEGMENTS=${HYPERVISOR_MAX_SEGMENTS}
@@ -88,6 +89,7 @@ macro(hypervisor_add_cmake_args)
         -DHYPERVISOR_MK_HUGE_POOL_SIZE=${HYPERVISOR_MK_HUGE_POOL_SIZE}
         -DHYPERVISOR_EXT_DIRECT_MAP_ADDR=${HYPERVISOR_EXT_DIRECT_MAP_ADDR}
         -DHYPERVISOR_EXT_DIRECT_MAP_SIZE=${HYPERVISOR_EXT_DIRECT_MAP_SIZE}
+        -DHYPERVISOR_EXT_FAULT_AROUND_SIZE=${HYPERVISOR_EXT_FAULT_AROUND_SIZE}
         -DHYPERVISOR_EXT_STACK_ADDR=${HYPERVISOR_EXT_STACK_ADDR}
         -DHYPERVISOR_EXT_STACK_SIZE=${HYPERVISOR_EXT_STACK_SIZE}
         -DHYPERVISOR_EXT_CODE_ADDR=${HYPERVISOR_EXT_CODE_ADDR}
@@ -102,6 +102,18 @@ macro(hypervisor_add_info)
         )
     endif()
 
+    if(HYPERVISOR_LOCK_STATS)
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_LOCK_STATS          ${BF_COLOR_GRN}enabled${BF_COLOR_RST}"
+            VERBATIM
+        )
+    else()
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_LOCK_STATS          ${BF_COLOR_RED}disabled${BF_COLOR_RST}"
+            VERBATIM
+        )
+    endif()
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_TARGET_ARCH         ${BF_COLOR_CYN}${HYPERVISOR_TARGET_ARCH}${BF_COLOR_RST}"
         VERBATIM
@@ -253,6 +265,11 @@ macro(hypervisor_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_EXT_FAULT_AROUND_SIZE ${BF_COLOR_CYN}${HYPERVISOR_EXT_FAULT_AROUND_SIZE}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_EXT_STACK_ADDR      ${BF_COLOR_CYN}${HYPERVISOR_EXT_STACK_ADDR}${BF_COLOR_RST}"
         VERBATIM
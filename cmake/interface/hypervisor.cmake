@@ -32,6 +32,16 @@ else()
     )
 endif()
 
+if(HYPERVISOR_LOCK_STATS)
+    target_compile_definitions(hypervisor INTERFACE
+        HYPERVISOR_LOCK_STATS=true
+    )
+else()
+    target_compile_definitions(hypervisor INTERFACE
+        HYPERVISOR_LOCK_STATS=false
+    )
+endif()
+
 target_compile_definitions(hypervisor INTERFACE
     HYPERVISOR_PAGE_SIZE=${HYPERVISOR_PAGE_SIZE}_umax
     HYPERVISOR_PAGE_SHIFT=${HYPERVISOR_PAGE_SHIFT}_umax
@@ -56,6 +66,7 @@ target_compile_definitions(hypervisor INTERFACE
     HYPERVISOR_MK_HUGE_POOL_SIZE=${HYPERVISOR_MK_HUGE_POOL_SIZE}_umax
     HYPERVISOR_EXT_DIRECT_MAP_ADDR=${HYPERVISOR_EXT_DIRECT_MAP_ADDR}_umax
     HYPERVISOR_EXT_DIRECT_MAP_SIZE=${HYPERVISOR_EXT_DIRECT_MAP_SIZE}_umax
+    HYPERVISOR_EXT_FAULT_AROUND_SIZE=${HYPERVISOR_EXT_FAULT_AROUND_SIZE}_umax
     HYPERVISOR_EXT_STACK_ADDR=${HYPERVISOR_EXT_STACK_ADDR}_umax
     HYPERVISOR_EXT_STACK_SIZE=${HYPERVISOR_EXT_STACK_SIZE}_umax
     HYPERVISOR_EXT_CODE_ADDR=${HYPERVISOR_EXT_CODE_ADDR}_umax
@@ -57,6 +57,7 @@ else()
 endif()
 
 hypervisor_silence(HYPERVISOR_DEBUG_RING_SIZE)
+hypervisor_silence(HYPERVISOR_LOCK_STATS)
 hypervisor_silence(HYPERVISOR_VMEXIT_LOG_SIZE)
 hypervisor_silence(HYPERVISOR_MAX_ELF_FILE_SIZE)
 hypervisor_silence(HYPERVISOR_MAX_SEGMENTS)
@@ -77,6 +78,7 @@ hypervisor_silence(HYPERVISOR_MK_HUGE_POOL_ADDR)
 hypervisor_silence(HYPERVISOR_MK_HUGE_POOL_SIZE)
 hypervisor_silence(HYPERVISOR_EXT_DIRECT_MAP_ADDR)
 hypervisor_silence(HYPERVISOR_EXT_DIRECT_MAP_SIZE)
+hypervisor_silence(HYPERVISOR_EXT_FAULT_AROUND_SIZE)
 hypervisor_silence(HYPERVISOR_EXT_STACK_ADDR)
 hypervisor_silence(HYPERVISOR_EXT_STACK_SIZE)
 hypervisor_silence(HYPERVISOR_EXT_CODE_ADDR)
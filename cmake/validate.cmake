@@ -58,6 +58,11 @@ if(HYPERVISOR_MAX_VMS LESS 1)
     message(FATAL_ERROR "HYPERVISOR_MAX_VMS must be at least 1")
 endif()
 
+math(EXPR HYPERVISOR_MAX_PCIDS "${HYPERVISOR_MAX_EXTENSIONS} * ${HYPERVISOR_MAX_VMS}")
+if(HYPERVISOR_MAX_PCIDS GREATER 4095)
+    message(FATAL_ERROR "HYPERVISOR_MAX_EXTENSIONS * HYPERVISOR_MAX_VMS must not be greater than 4095")
+endif()
+
 if(HYPERVISOR_MAX_PPS LESS 1)
     message(FATAL_ERROR "HYPERVISOR_MAX_PPS must be at least 1")
 endif()
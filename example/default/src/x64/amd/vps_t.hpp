@@ -297,21 +297,10 @@ namespace example
             }
 
             /// NOTE:
-            /// - Set up ASID. For this simple example, we will use "1", but
-            ///   in most cases you will want to use something based on the
-            ///   VMID that this VPS is assigned to (which is based on which
-            ///   VP the VPS is assigned to, as VPs are assigned to VMs and
-            ///   VPSs are assigned to VPs).
+            /// - There is no need to set up the ASID. The microkernel gives
+            ///   each VPS its own ASID the first time it runs.
             ///
 
-            constexpr auto guest_asid_val{0x1_u64};
-            mut_ret = mut_sys.bf_vps_op_write(
-                m_id, syscall::bf_reg_t::bf_reg_t_guest_asid, guest_asid_val);
-            if (bsl::unlikely_assert(!mut_ret)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return mut_ret;
-            }
-
             /// NOTE:
             /// - Set up intercept controls. On AMD, we need to intercept
             ///   VMRun, and CPUID if we plan to support reporting and stopping.
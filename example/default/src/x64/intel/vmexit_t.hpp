@@ -338,8 +338,9 @@ namespace example
                         /// - If this is the first PP to stop (which is the
                         ///   last PP in the list as we stop in reverse order),
                         ///   print out how much memory was used by the
-                        ///   hypervisor. This is a debugging feature that can
-                        ///   be disabled, but it helps to track if memory is
+                        ///   hypervisor, and how contended its locks were.
+                        ///   This is a debugging feature that can be
+                        ///   disabled, but it helps to track if memory is
                         ///   being over used.
                         ///
 
@@ -347,6 +348,8 @@ namespace example
                             bsl::print() << bsl::endl;
                             syscall::bf_debug_op_dump_page_pool();
                             bsl::print() << bsl::endl;
+                            syscall::bf_debug_op_dump_lock_stats();
+                            bsl::print() << bsl::endl;
                         }
                         else {
                             bsl::touch();
@@ -313,17 +313,11 @@ namespace example
             }
 
             /// NOTE:
-            /// - Set up VPID
+            /// - There is no need to set up the VPID. The microkernel gives
+            ///   each VPS its own VPID the first time it runs, which is why
+            ///   we turn on VPID below.
             ///
 
-            constexpr auto vmcs_vpid_val{0x1_u64};
-            mut_ret = mut_sys.bf_vps_op_write(
-                m_id, syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier, vmcs_vpid_val);
-            if (bsl::unlikely_assert(!mut_ret)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return mut_ret;
-            }
-
             /// NOTE:
             /// - Set up the VMCS link pointer
             ///
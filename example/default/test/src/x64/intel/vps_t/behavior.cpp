@@ -210,25 +210,6 @@ namespace example
             };
         };
 
-        bsl::ut_scenario{"allocate bf_vps_op_write fails for vpid"} = []() noexcept {
-            bsl::ut_given{} = []() noexcept {
-                vps_t mut_vps{};
-                syscall::bf_syscall_t mut_sys{};
-                constexpr auto val{0x1_u64};
-                bsl::ut_when{} = [&]() noexcept {
-                    bsl::ut_required_step(mut_vps.initialize({}, {}, {}, {}, {}));
-                    mut_sys.set_bf_vps_op_write(
-                        {},
-                        syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier,
-                        val,
-                        bsl::errc_failure);
-                    bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_vps.allocate({}, {}, mut_sys, {}, {}, {}));
-                    };
-                };
-            };
-        };
-
         bsl::ut_scenario{"allocate bf_vps_op_write fails for link ptr"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 vps_t mut_vps{};
@@ -25,36 +25,118 @@
 #ifndef ALLOCATE_TAGS_HPP
 #define ALLOCATE_TAGS_HPP
 
-#include <bsl/cstr_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
 
 namespace mk
 {
     /// @brief Defines the "bf_mem_op_alloc_page" tag
-    constexpr auto ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE{"bf_mem_op_alloc_page"};
+    constexpr auto ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE{0_umax};
     /// @brief Defines the "bf_mem_op_alloc_heap" tag
-    constexpr auto ALLOCATE_TAG_BF_MEM_OP_ALLOC_HEAP{"bf_mem_op_alloc_heap"};
+    constexpr auto ALLOCATE_TAG_BF_MEM_OP_ALLOC_HEAP{1_umax};
     /// @brief Defines the "extension stack memory" tag
-    constexpr auto ALLOCATE_TAG_EXT_STACK{"extension stack memory"};
+    constexpr auto ALLOCATE_TAG_EXT_STACK{2_umax};
     /// @brief Defines the "extension TLS memory" tag
-    constexpr auto ALLOCATE_TAG_EXT_TLS{"extension TLS memory"};
+    constexpr auto ALLOCATE_TAG_EXT_TLS{3_umax};
     /// @brief Defines the "extension TCB memory" tag
-    constexpr auto ALLOCATE_TAG_EXT_TCB{"extension TCB memory"};
+    constexpr auto ALLOCATE_TAG_EXT_TCB{4_umax};
     /// @brief Defines the "extension ELF segments" tag
-    constexpr auto ALLOCATE_TAG_EXT_ELF{"extension ELF segments"};
+    constexpr auto ALLOCATE_TAG_EXT_ELF{5_umax};
     /// @brief Defines the "pml4ts" tag
-    constexpr auto ALLOCATE_TAG_PML4TS{"pml4ts"};
+    constexpr auto ALLOCATE_TAG_PML4TS{6_umax};
     /// @brief Defines the "pdpts" tag
-    constexpr auto ALLOCATE_TAG_PDPTS{"pdpts"};
+    constexpr auto ALLOCATE_TAG_PDPTS{7_umax};
     /// @brief Defines the "pdts" tag
-    constexpr auto ALLOCATE_TAG_PDTS{"pdts"};
+    constexpr auto ALLOCATE_TAG_PDTS{8_umax};
     /// @brief Defines the "pts" tag
-    constexpr auto ALLOCATE_TAG_PTS{"pts"};
+    constexpr auto ALLOCATE_TAG_PTS{9_umax};
     /// @brief Defines the "guest vmcb" tag
-    constexpr auto ALLOCATE_TAG_GUEST_VMCB{"guest vmcb"};
+    constexpr auto ALLOCATE_TAG_GUEST_VMCB{10_umax};
     /// @brief Defines the "host vmcb" tag
-    constexpr auto ALLOCATE_TAG_HOST_VMCB{"host vmcb"};
+    constexpr auto ALLOCATE_TAG_HOST_VMCB{11_umax};
     /// @brief Defines the "vmcs" tag
-    constexpr auto ALLOCATE_TAG_VMCS{"vmcs"};
+    constexpr auto ALLOCATE_TAG_VMCS{12_umax};
+    /// @brief Defines the "xsave area" tag
+    constexpr auto ALLOCATE_TAG_XSAVE{13_umax};
+    /// @brief Defines the total number of allocate tags
+    constexpr auto ALLOCATE_TAG_MAX{14_umax};
+
+    /// <!-- description -->
+    ///   @brief Returns the name of the provided allocate tag, or an
+    ///     empty string if the tag is invalid.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tag the allocate tag to get the name of
+    ///   @return Returns the name of the provided allocate tag, or an
+    ///     empty string if the tag is invalid.
+    ///
+    [[nodiscard]] constexpr auto
+    allocate_tag_to_str(bsl::safe_uintmax const &tag) noexcept -> bsl::string_view
+    {
+        switch (tag.get()) {
+            case ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE.get(): {
+                return "bf_mem_op_alloc_page";
+            }
+
+            case ALLOCATE_TAG_BF_MEM_OP_ALLOC_HEAP.get(): {
+                return "bf_mem_op_alloc_heap";
+            }
+
+            case ALLOCATE_TAG_EXT_STACK.get(): {
+                return "extension stack memory";
+            }
+
+            case ALLOCATE_TAG_EXT_TLS.get(): {
+                return "extension TLS memory";
+            }
+
+            case ALLOCATE_TAG_EXT_TCB.get(): {
+                return "extension TCB memory";
+            }
+
+            case ALLOCATE_TAG_EXT_ELF.get(): {
+                return "extension ELF segments";
+            }
+
+            case ALLOCATE_TAG_PML4TS.get(): {
+                return "pml4ts";
+            }
+
+            case ALLOCATE_TAG_PDPTS.get(): {
+                return "pdpts";
+            }
+
+            case ALLOCATE_TAG_PDTS.get(): {
+                return "pdts";
+            }
+
+            case ALLOCATE_TAG_PTS.get(): {
+                return "pts";
+            }
+
+            case ALLOCATE_TAG_GUEST_VMCB.get(): {
+                return "guest vmcb";
+            }
+
+            case ALLOCATE_TAG_HOST_VMCB.get(): {
+                return "host vmcb";
+            }
+
+            case ALLOCATE_TAG_VMCS.get(): {
+                return "vmcs";
+            }
+
+            case ALLOCATE_TAG_XSAVE.get(): {
+                return "xsave area";
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return {};
+    }
 }
 
 #endif
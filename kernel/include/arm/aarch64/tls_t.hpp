@@ -25,7 +25,9 @@
 #ifndef TLS_T_HPP
 #define TLS_T_HPP
 
+#include <debug_ring_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -326,10 +328,10 @@ namespace mk
         /// @brief used to store a return address for unsafe ops (0x350)
         bsl::uintmax unsafe_rip;
 
-        /// @brief reserved (0x358)
-        bsl::uintmax reserved_padding2;
-        /// @brief reserved (0x360)
-        bsl::uintmax reserved_padding3;
+        /// @brief stores the loader provided debug ring for this PP (0x358)
+        loader::debug_ring_t *debug_ring;
+        /// @brief stores the loader provided trace ring for this PP (0x360)
+        loader::trace_ring_t *trace_ring;
 
         /// @brief stores whether or not the first launch succeeded (0x368)
         bsl::uintmax first_launch_succeeded;
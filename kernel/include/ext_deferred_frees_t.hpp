@@ -0,0 +1,60 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef EXT_DEFERRED_FREES_T_HPP
+#define EXT_DEFERRED_FREES_T_HPP
+
+#include <page_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace mk
+{
+    /// @brief defines the max number of frees a PP can defer at once
+    constexpr auto EXT_MAX_DEFERRED_FREES{16_umax};
+
+    /// @struct mk::ext_deferred_frees_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the memory that a single PP unmapped from an
+    ///     extension's direct map, but that cannot be given back to the
+    ///     page pool (or huge pool) until every other PP has flushed its
+    ///     TLB entries for it. Each freed block of memory is stored with
+    ///     the generation VM 0's direct map reached when the memory was
+    ///     unmapped (see root_page_table_t::is_flushed).
+    ///
+    struct ext_deferred_frees_t final
+    {
+        /// @brief stores the memory waiting to be given back
+        bsl::array<bsl::span<page_t>, EXT_MAX_DEFERRED_FREES.get()> mem;
+        /// @brief stores the generation each block of memory was unmapped at
+        bsl::array<bsl::safe_uintmax, EXT_MAX_DEFERRED_FREES.get()> generations;
+        /// @brief stores the number of blocks of memory waiting
+        bsl::safe_uintmax size;
+    };
+}
+
+#endif
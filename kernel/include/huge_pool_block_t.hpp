@@ -0,0 +1,57 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HUGE_POOL_BLOCK_T_HPP
+#define HUGE_POOL_BLOCK_T_HPP
+
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @struct mk::huge_pool_block_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the bookkeeping that the huge pool keeps for each
+    ///     page in the pool. Only the entry for the first page of a block
+    ///     is used. Free blocks are linked together (by index) into one
+    ///     list per order, where a block of order N is 2^N pages in size.
+    ///
+    struct huge_pool_block_t final
+    {
+        /// @brief stores the index of the next free block of the same order
+        bsl::safe_uintmax next;
+        /// @brief stores the index of the previous free block of the same order
+        bsl::safe_uintmax prev;
+        /// @brief stores the order of the block
+        bsl::safe_uintmax order;
+        /// @brief stores the number of pages that were asked for (if allocated)
+        bsl::safe_uintmax pages;
+        /// @brief stores true if this block is on one of the free lists
+        bool free;
+        /// @brief stores true if this block has been allocated
+        bool allocated;
+    };
+}
+
+#endif
@@ -0,0 +1,58 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef LOCK_STATS_RECORD_T_HPP
+#define LOCK_STATS_RECORD_T_HPP
+
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @struct mk::lock_stats_record_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the layout of a lock statistics record. Each PP has
+    ///     one record per lock tag, and the record is indexed using the
+    ///     tag itself. All times are in timestamp ticks (i.e., TSC cycles
+    ///     on x64).
+    ///
+    struct lock_stats_record_t final
+    {
+        /// @brief stores the number of times the lock was acquired
+        bsl::safe_uintmax acquisitions;
+        /// @brief stores the number of acquisitions that had to wait
+        bsl::safe_uintmax contended;
+        /// @brief stores the total number of ticks spent waiting
+        bsl::safe_uintmax spin_total;
+        /// @brief stores the most ticks any one acquisition waited
+        bsl::safe_uintmax spin_max;
+        /// @brief stores the total number of ticks the lock was held
+        bsl::safe_uintmax hold_total;
+        /// @brief stores the most ticks the lock was held at once
+        bsl::safe_uintmax hold_max;
+    };
+}
+
+#endif
@@ -0,0 +1,83 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef LOCK_TAGS_HPP
+#define LOCK_TAGS_HPP
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+
+namespace mk
+{
+    /// @brief Defines the "page pool" lock tag
+    constexpr auto LOCK_TAG_PAGE_POOL{0_umax};
+    /// @brief Defines the "huge pool" lock tag
+    constexpr auto LOCK_TAG_HUGE_POOL{1_umax};
+    /// @brief Defines the "root page table" lock tag
+    constexpr auto LOCK_TAG_ROOT_PAGE_TABLE{2_umax};
+    /// @brief Defines the "vm" lock tag
+    constexpr auto LOCK_TAG_VM{3_umax};
+    /// @brief Defines the total number of lock tags
+    constexpr auto LOCK_TAG_MAX{4_umax};
+
+    /// <!-- description -->
+    ///   @brief Returns the name of the provided lock tag, or an
+    ///     empty string if the tag is invalid.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tag the lock tag to get the name of
+    ///   @return Returns the name of the provided lock tag, or an
+    ///     empty string if the tag is invalid.
+    ///
+    [[nodiscard]] constexpr auto
+    lock_tag_to_str(bsl::safe_uintmax const &tag) noexcept -> bsl::string_view
+    {
+        switch (tag.get()) {
+            case LOCK_TAG_PAGE_POOL.get(): {
+                return "page pool";
+            }
+
+            case LOCK_TAG_HUGE_POOL.get(): {
+                return "huge pool";
+            }
+
+            case LOCK_TAG_ROOT_PAGE_TABLE.get(): {
+                return "root page table";
+            }
+
+            case LOCK_TAG_VM.get(): {
+                return "vm";
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return {};
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef PAGE_POOL_PP_T_HPP
+#define PAGE_POOL_PP_T_HPP
+
+#include <allocate_tags.hpp>
+#include <page_pool_node_t.hpp>
+#include <page_pool_record_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @struct mk::page_pool_pp_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the page pool state that is owned by a single PP.
+    ///     Each PP keeps a small cache of free pages in front of the page
+    ///     pool's global free list as well as its own tag accounting so
+    ///     that the common allocate/deallocate path never has to take the
+    ///     page pool's lock.
+    ///
+    struct page_pool_pp_t final
+    {
+        /// @brief stores the head of this PP's cache of free pages
+        page_pool_node_t *head;
+        /// @brief stores the number of pages in this PP's cache
+        bsl::safe_uintmax size;
+        /// @brief stores this PP's accounting for each allocate tag
+        bsl::array<page_pool_record_t, ALLOCATE_TAG_MAX.get()> rcds;
+    };
+}
+
+#endif
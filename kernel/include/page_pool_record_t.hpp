@@ -25,22 +25,27 @@
 #ifndef PAGE_POOL_RECORD_T_HPP
 #define PAGE_POOL_RECORD_T_HPP
 
-#include <bsl/cstr_type.hpp>
-#include <bsl/safe_integral.hpp>
+#include <bsl/cstdint.hpp>
 
 namespace mk
 {
     /// @struct mk::page_pool_record_t
     ///
     /// <!-- description -->
-    ///   @brief Defines the layout of a page pool tag
+    ///   @brief Defines the layout of a page pool tag. Each PP has one
+    ///     record per allocate tag, and the record is indexed using the
+    ///     tag itself. Only the PP that owns a record ever writes to it,
+    ///     and the counters are stored as plain integers so that other
+    ///     PPs can read them atomically when they are reported.
     ///
     struct page_pool_record_t final
     {
-        /// @brief stores the tag associated with this record
-        bsl::cstr_type tag;
-        /// @brief stores the number of bytes allocated with this record
-        bsl::safe_uintmax usd;
+        /// @brief stores the number of pages allocated with this record
+        bsl::uint64 allocs;
+        /// @brief stores the number of pages deallocated with this record
+        bsl::uint64 frees;
+        /// @brief stores the number of allocations that failed with this record
+        bsl::uint64 fails;
     };
 }
 
@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef INVPCID_DESCRIPTOR_T
+#define INVPCID_DESCRIPTOR_T
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace mk
+{
+    /// @brief defines the INVPCID individual-address invalidation type
+    constexpr auto INVPCID_TYPE_INDIVIDUAL_ADDRESS{0_u64};
+    /// @brief defines the INVPCID single-context invalidation type
+    constexpr auto INVPCID_TYPE_SINGLE_CONTEXT{1_u64};
+    /// @brief defines the INVPCID all-context (including globals) type
+    constexpr auto INVPCID_TYPE_ALL_CONTEXT_INCLUDING_GLOBALS{2_u64};
+    /// @brief defines the INVPCID all-context invalidation type
+    constexpr auto INVPCID_TYPE_ALL_CONTEXT{3_u64};
+
+    /// @struct mk::invpcid_descriptor_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores information needed to execute invpcid
+    ///
+    struct invpcid_descriptor_t final
+    {
+        /// @brief stores the pcid to invalidate (bits 63:12 must be 0)
+        bsl::uint64 pcid;
+        /// @brief stores the address to invalidate
+        bsl::uint64 addr;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
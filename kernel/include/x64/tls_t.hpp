@@ -25,7 +25,9 @@
 #ifndef TLS_T_HPP
 #define TLS_T_HPP
 
+#include <debug_ring_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -40,7 +42,7 @@ namespace mk
     /// @brief defines the size of the reserved1 field in the tls_t
     constexpr auto TLS_T_RESERVED1_SIZE{0x030_umax};
     /// @brief defines the size of the reserved2 field in the tls_t
-    constexpr auto TLS_T_RESERVED2_SIZE{0x088_umax};
+    constexpr auto TLS_T_RESERVED2_SIZE{0x040_umax};
 
     /// IMPORTANT:
     /// - If the size of the TLS is changed, the mk_main_entry will need to
@@ -264,6 +266,28 @@ namespace mk
 
         /// @brief stores the currently active root page table (0x270)
         void *active_rpt;
+        /// @brief stores whether or not CR4.PCIDE is set on this PP (0x278)
+        bsl::uintmax pcid_enabled;
+
+        /// @brief stores the value loaded into IA32_CSTAR (0x280)
+        bsl::uintmax ia32_cstar;
+        /// @brief stores the value loaded into IA32_KERNEL_GS_BASE (0x288)
+        bsl::uintmax ia32_kernel_gs_base;
+
+        /// @brief stores the next VPID/ASID to give to a VPS on this PP (0x290)
+        bsl::uintmax tlb_tag_next;
+        /// @brief stores the VPID/ASID generation of this PP (0x298)
+        bsl::uintmax tlb_tag_generation;
+
+        /// @brief stores the XSAVE area whose state is loaded in the FPU (0x2A0)
+        void *fpu_owner;
+        /// @brief stores whether or not CR4.OSXSAVE is set on this PP (0x2A8)
+        bsl::uintmax xsave_enabled;
+
+        /// @brief stores the loader provided debug ring for this PP (0x2B0)
+        loader::debug_ring_t *debug_ring;
+        /// @brief stores the loader provided trace ring for this PP (0x2B8)
+        loader::trace_ring_t *trace_ring;
 
         /// @brief reserve the rest of the TLS block for later use.
         bsl::array<bsl::uint8, TLS_T_RESERVED2_SIZE.get()> reserved2;
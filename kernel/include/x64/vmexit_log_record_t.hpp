@@ -84,6 +84,13 @@ namespace mk
         bsl::safe_uintmax rsp;
         /// @brief stores rip
         bsl::safe_uintmax rip;
+        /// @brief stores the TSC cycles spent in intrinsic_vmrun, which
+        ///   includes the time spent switching state (on Intel, at least 5
+        ///   rdmsr per VMExit) and running the guest. This is only recorded
+        ///   when BSL_DEBUG_LEVEL >= VV, and the time the guest runs varies
+        ///   from exit to exit, so it is not a measure of the MSR switch
+        ///   by itself.
+        bsl::safe_uintmax cycles;
     };
 }
 
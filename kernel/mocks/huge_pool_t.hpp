@@ -25,6 +25,7 @@
 #ifndef MOCKS_HUGE_POOL_T_HPP
 #define MOCKS_HUGE_POOL_T_HPP
 
+#include <page_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/debug.hpp>
@@ -32,16 +33,18 @@
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
+#include <bsl/unordered_map.hpp>
 
 namespace mk
 {
     /// <!-- description -->
     ///   @brief If you see this function in an error, it means that you are
-    ///     attempting to perform a deallocation on a nullptr. This is not
-    ///     allowed, although at runtime this will be safely handled.
+    ///     attempting to perform a deallocation or virt to phys or phys to
+    ///     virt translation with an address that was not allocated using
+    ///     the huge pool which is not supported.
     ///
     inline void
-    attempting_to_deallocate_nullptr() noexcept
+    address_was_not_allocated_using_the_huge_pool() noexcept
     {}
 
     /// @class mk::huge_pool_t
@@ -53,6 +56,16 @@ namespace mk
     {
         /// @brief if true, allocate() returns nullptr
         bool m_allocate_fails{};
+        /// @brief stores the number of pages in each allocation
+        bsl::unordered_map<page_t const *, bsl::safe_uintmax> m_pages{};
+        /// @brief stores virt to phys translations
+        bsl::unordered_map<page_t const *, bsl::safe_uintmax> m_virt_to_phys{};
+        /// @brief stores phys to virt translations
+        bsl::unordered_map<bsl::safe_uintmax, page_t *> m_phys_to_virt{};
+        /// @brief stores the next physical address to hand out
+        bsl::safe_uintmax m_phys{HYPERVISOR_PAGE_SIZE};
+        /// @brief stores the total number of pages that are in use
+        bsl::safe_uintmax m_used{};
 
     public:
         /// <!-- description -->
@@ -60,28 +73,19 @@ namespace mk
         ///
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
-        ///   @param size the total number of bytes to allocate.
+        ///   @param pages the total number of pages to allocate.
         ///   @return Returns bsl::span containing the allocated memory
         ///
         [[nodiscard]] constexpr auto
-        allocate(tls_t &tls, bsl::safe_uintmax const &size) noexcept -> bsl::span<bsl::uint8>
+        allocate(tls_t &tls, bsl::safe_uintmax const &pages) noexcept -> bsl::span<page_t>
         {
             bsl::discard(tls);
 
-            if (bsl::unlikely(!size)) {
-                bsl::error() << "invalid size "    // --
-                             << bsl::hex(size)     // --
-                             << bsl::endl          // --
-                             << bsl::here();       // --
-
-                return {};
-            }
-
-            if (bsl::unlikely(size.is_zero())) {
-                bsl::error() << "invalid size "    // --
-                             << bsl::hex(size)     // --
-                             << bsl::endl          // --
-                             << bsl::here();       // --
+            if (bsl::unlikely(pages.is_zero_or_invalid())) {
+                bsl::error() << "invalid pages "    // --
+                             << bsl::hex(pages)     // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
 
                 return {};
             }
@@ -90,7 +94,17 @@ namespace mk
                 return {};
             }
 
-            return {new bsl::uint8[size.get()], size.get()};
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            auto *const pmut_virt{new page_t[pages.get()]};
+
+            m_pages.at(pmut_virt) = pages;
+            m_virt_to_phys.at(pmut_virt) = m_phys;
+            m_phys_to_virt.at(m_phys) = pmut_virt;
+
+            m_phys += pages * HYPERVISOR_PAGE_SIZE;
+            m_used += pages;
+
+            return {pmut_virt, pages};
         }
 
         /// <!-- description -->
@@ -106,28 +120,124 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Not supported
+        ///   @brief Returns the bsl::span that allocate() returned for the
+        ///     allocation that starts at the provided virtual address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param virt the virtual address of the allocation to look up
+        ///   @return Returns the bsl::span that allocate() returned for the
+        ///     allocation that starts at the provided virtual address, or
+        ///     an empty bsl::span on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        lookup(tls_t &tls, page_t const *const virt) const noexcept -> bsl::span<page_t>
+        {
+            bsl::discard(tls);
+
+            if (bsl::unlikely(!m_virt_to_phys.contains(virt))) {
+                address_was_not_allocated_using_the_huge_pool();
+                bsl::error() << "address was not allocated using the huge pool\n" << bsl::here();
+                return {};
+            }
+
+            return {m_phys_to_virt.at(m_virt_to_phys.at(virt)), m_pages.at(virt)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns memory that was allocated using allocate() back
+        ///     to the huge pool.
         ///
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
         ///   @param buf the bsl::span containing the memory to deallocate
         ///
         constexpr void
-        deallocate(tls_t &tls, bsl::span<bsl::uint8> const &buf) noexcept
+        deallocate(tls_t &tls, bsl::span<page_t> const &buf) noexcept
         {
             bsl::discard(tls);
 
-            if (bsl::unlikely(!buf)) {
-                attempting_to_deallocate_nullptr();
-                bsl::error() << "attempting to deallocate nullptr\n" << bsl::here();
+            if (buf.empty()) {
                 return;
             }
 
+            if (bsl::unlikely(!m_virt_to_phys.contains(buf.data()))) {
+                address_was_not_allocated_using_the_huge_pool();
+                bsl::error() << "address was not allocated using the huge pool\n" << bsl::here();
+                return;
+            }
+
+            m_used -= m_pages.at(buf.data());
+
+            bsl::discard(m_phys_to_virt.erase(m_virt_to_phys.at(buf.data())));
+            bsl::discard(m_virt_to_phys.erase(buf.data()));
+            bsl::discard(m_pages.erase(buf.data()));
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
             delete[] buf.data();    // GRCOV_EXCLUDE_BR
         }
 
         /// <!-- description -->
-        ///   @brief Dumps the page_pool_t
+        ///   @brief Converts a virtual address to a physical address for
+        ///     any page allocated by the huge pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T defines the type of virtual address being converted
+        ///   @param virt the virtual address to convert
+        ///   @return the resulting physical address
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        virt_to_phys(T const *const virt) const noexcept -> bsl::safe_uintmax
+        {
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            if (bsl::unlikely(!m_virt_to_phys.contains(virt))) {
+                address_was_not_allocated_using_the_huge_pool();
+                bsl::error() << "address was not allocated using the huge pool\n" << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            return m_virt_to_phys.at(virt);
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a physical address to a virtual address for
+        ///     any page allocated by the huge pool. If the physical address
+        ///     was not allocated by the huge pool, a nullptr is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T defines the type of virtual address to convert to
+        ///   @param phys the physical address to convert
+        ///   @return the resulting virtual address
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        phys_to_virt(bsl::safe_uintmax const &phys) const noexcept -> T *
+        {
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            if (!m_phys_to_virt.contains(phys)) {
+                return nullptr;
+            }
+
+            return m_phys_to_virt.at(phys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of pages that are in use.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of pages that are in use.
+        ///
+        [[nodiscard]] constexpr auto
+        used() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_used;
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the huge_pool_t
         ///
         constexpr void
         dump() const noexcept
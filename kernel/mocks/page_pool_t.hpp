@@ -25,6 +25,7 @@
 #ifndef MOCKS_PAGE_POOL_T_HPP
 #define MOCKS_PAGE_POOL_T_HPP
 
+#include <allocate_tags.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/convert.hpp>
@@ -35,7 +36,6 @@
 #include <bsl/remove_const.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
-#include <bsl/string_view.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unordered_map.hpp>
 
@@ -54,9 +54,6 @@ namespace mk
     /// @brief pt_t prototype
     struct pt_t;
 
-    /// @brief stores the max number of records the page pool can store
-    constexpr auto PAGE_POOL_MAX_RECORDS{10_umax};
-
     /// <!-- description -->
     ///   @brief If you see this function in an error, it means that you are
     ///     attempting to perform a deallocation or virt to phys or phys to
@@ -103,54 +100,54 @@ namespace mk
     class page_pool_t final
     {
         /// @brief stores virtual address to tag conversions
-        bsl::unordered_map<void const *, bsl::string_view> m_tags{};
+        bsl::unordered_map<void const *, bsl::safe_uintmax> m_tags{};
         /// @brief stores allocation counts per tag
-        bsl::unordered_map<bsl::string_view, bsl::safe_uintmax> m_allocated{};
+        bsl::unordered_map<bsl::safe_uintmax, bsl::safe_uintmax> m_allocated{};
 
         /// @brief stores pending physical address for override allocations
-        bsl::unordered_map<bsl::string_view, bsl::safe_uintmax> m_allocate_phys{};
+        bsl::unordered_map<bsl::safe_uintmax, bsl::safe_uintmax> m_allocate_phys{};
         /// @brief stores virt to phys translations
         bsl::unordered_map<void const *, bsl::safe_uintmax> m_virt_to_phys{};
         /// @brief stores virt to phys translation overrides
         bsl::unordered_map<void const *, bsl::safe_uintmax> m_virt_to_phys_ret{};
 
         /// @brief stores pending virtual address for override allocations
-        bsl::unordered_map<bsl::string_view, page_t *> m_allocate_virt_page_t{};
+        bsl::unordered_map<bsl::safe_uintmax, page_t *> m_allocate_virt_page_t{};
         /// @brief stores phys to virt translations
         bsl::unordered_map<bsl::safe_uintmax, page_t *> m_phys_to_virt_page_t{};
         /// @brief stores phys to virt translation overrides
         bsl::unordered_map<bsl::safe_uintmax, page_t *> m_phys_to_virt_page_t_ret{};
 
         /// @brief stores pending virtual address for override allocations
-        bsl::unordered_map<bsl::string_view, ext_tcb_t *> m_allocate_virt_ext_tcb_t{};
+        bsl::unordered_map<bsl::safe_uintmax, ext_tcb_t *> m_allocate_virt_ext_tcb_t{};
         /// @brief stores phys to virt translations
         bsl::unordered_map<bsl::safe_uintmax, ext_tcb_t *> m_phys_to_virt_ext_tcb_t{};
         /// @brief stores phys to virt translation overrides
         bsl::unordered_map<bsl::safe_uintmax, ext_tcb_t *> m_phys_to_virt_ext_tcb_t_ret{};
 
         /// @brief stores pending virtual address for override allocations
-        bsl::unordered_map<bsl::string_view, pml4t_t *> m_allocate_virt_pml4t_t{};
+        bsl::unordered_map<bsl::safe_uintmax, pml4t_t *> m_allocate_virt_pml4t_t{};
         /// @brief stores phys to virt translations
         bsl::unordered_map<bsl::safe_uintmax, pml4t_t *> m_phys_to_virt_pml4t_t{};
         /// @brief stores phys to virt translation overrides
         bsl::unordered_map<bsl::safe_uintmax, pml4t_t *> m_phys_to_virt_pml4t_t_ret{};
 
         /// @brief stores pending virtual address for override allocations
-        bsl::unordered_map<bsl::string_view, pdpt_t *> m_allocate_virt_pdpt_t{};
+        bsl::unordered_map<bsl::safe_uintmax, pdpt_t *> m_allocate_virt_pdpt_t{};
         /// @brief stores phys to virt translations
         bsl::unordered_map<bsl::safe_uintmax, pdpt_t *> m_phys_to_virt_pdpt_t{};
         /// @brief stores phys to virt translation overrides
         bsl::unordered_map<bsl::safe_uintmax, pdpt_t *> m_phys_to_virt_pdpt_t_ret{};
 
         /// @brief stores pending virtual address for override allocations
-        bsl::unordered_map<bsl::string_view, pdt_t *> m_allocate_virt_pdt_t{};
+        bsl::unordered_map<bsl::safe_uintmax, pdt_t *> m_allocate_virt_pdt_t{};
         /// @brief stores phys to virt translations
         bsl::unordered_map<bsl::safe_uintmax, pdt_t *> m_phys_to_virt_pdt_t{};
         /// @brief stores phys to virt translation overrides
         bsl::unordered_map<bsl::safe_uintmax, pdt_t *> m_phys_to_virt_pdt_t_ret{};
 
         /// @brief stores pending virtual address for override allocations
-        bsl::unordered_map<bsl::string_view, pt_t *> m_allocate_virt_pt_t{};
+        bsl::unordered_map<bsl::safe_uintmax, pt_t *> m_allocate_virt_pt_t{};
         /// @brief stores phys to virt translations
         bsl::unordered_map<bsl::safe_uintmax, pt_t *> m_phys_to_virt_pt_t{};
         /// @brief stores phys to virt translation overrides
@@ -168,7 +165,7 @@ namespace mk
         ///
         template<typename T>
         [[nodiscard]] constexpr auto
-        allocate(tls_t const &tls, bsl::string_view const &tag) noexcept -> T *
+        allocate(tls_t const &tls, bsl::safe_uintmax const &tag) noexcept -> T *
         {
             static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
             static_assert(!bsl::is_const<T>::value, "allocating a const makes no sense");
@@ -185,13 +182,12 @@ namespace mk
 
             bsl::discard(tls);
 
-            if (bsl::unlikely(tag.empty())) {
-                bsl::error() << "invalid tag\n" << bsl::here();
-                return nullptr;
-            }
+            if (bsl::unlikely(!(tag < ALLOCATE_TAG_MAX))) {
+                bsl::error() << "invalid tag "    // --
+                             << bsl::hex(tag)     // --
+                             << bsl::endl         // --
+                             << bsl::here();      // --
 
-            if (bsl::unlikely(PAGE_POOL_MAX_RECORDS == m_allocated.size())) {
-                bsl::error() << "page pool out of space for tags\n" << bsl::here();
                 return nullptr;
             }
 
@@ -283,7 +279,9 @@ namespace mk
         template<typename T>
         constexpr void
         set_allocate(
-            bsl::string_view const &tag, T *const pudm_virt, bsl::safe_uintmax const &phys) noexcept
+            bsl::safe_uintmax const &tag,
+            T *const pudm_virt,
+            bsl::safe_uintmax const &phys) noexcept
         {
             if constexpr (bsl::is_same<T, pml4t_t>::value) {
                 m_allocate_virt_pml4t_t.at(tag) = pudm_virt;
@@ -319,7 +317,7 @@ namespace mk
         ///
         template<typename T>
         constexpr void
-        deallocate(tls_t const &tls, T *const pmut_virt, bsl::string_view const &tag) noexcept
+        deallocate(tls_t const &tls, T *const pmut_virt, bsl::safe_uintmax const &tag) noexcept
         {
             static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
             bsl::discard(tls);
@@ -379,7 +377,7 @@ namespace mk
         ///   @return Returns the number of bytes allocated for a given tag.
         ///
         [[nodiscard]] constexpr auto
-        allocated(tls_t const &tls, bsl::string_view const &tag) noexcept -> bsl::safe_uintmax
+        allocated(tls_t const &tls, bsl::safe_uintmax const &tag) noexcept -> bsl::safe_uintmax
         {
             bsl::discard(tls);
 
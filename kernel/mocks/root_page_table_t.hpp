@@ -25,17 +25,22 @@
 #ifndef MOCKS_ROOT_PAGE_TABLE_T_HPP
 #define MOCKS_ROOT_PAGE_TABLE_T_HPP
 
+#include <allocate_tags.hpp>
+#include <intrinsic_t.hpp>
 #include <map_page_flags.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unlikely_contract.hpp>
+#include <bsl/unordered_map.hpp>
 
 namespace mk
 {
@@ -49,6 +54,16 @@ namespace mk
     {
         /// @brief stores whether or not the rpt has been initialized
         bool m_initialized{};
+        /// @brief stores the auto release tag of each mapped page
+        bsl::unordered_map<bsl::safe_uintmax, bsl::safe_uintmax> m_mapped{};
+        /// @brief stores the PCID used by this RPT
+        bsl::safe_uintmax m_pcid{};
+        /// @brief stores whether or not the RPT changed since activate()
+        bool m_stale{};
+        /// @brief incremented each time a mapping is removed or changed
+        bsl::safe_uintmax m_generation{1_umax};
+        /// @brief stores the generation each PP last activated (0 == never)
+        bsl::array<bsl::safe_uintmax, HYPERVISOR_MAX_PPS.get()> m_pp_generations{};
 
         /// <!-- description -->
         ///   @brief Returns the page aligned version of the addr
@@ -119,6 +134,7 @@ namespace mk
             bsl::discard(page_pool);
 
             m_initialized = false;
+            m_stale = true;
         }
 
         /// <!-- description -->
@@ -143,7 +159,7 @@ namespace mk
         ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        activate(tls_t &tls, intrinsic_t &intrinsic) const noexcept -> bsl::errc_type
+        activate(tls_t &tls, intrinsic_t &intrinsic) noexcept -> bsl::errc_type
         {
             bsl::discard(intrinsic);
 
@@ -152,9 +168,154 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            auto *const pmut_pp_generation{m_pp_generations.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_contract(nullptr == pmut_pp_generation)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return bsl::errc_failure;
+            }
+
+            *pmut_pp_generation = m_generation;
+            m_stale = false;
             return tls.test_ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if this RPT was changed since the last
+        ///     call to activate().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if this RPT was changed since the last
+        ///     call to activate().
+        ///
+        [[nodiscard]] constexpr auto
+        is_stale(tls_t const &tls) const noexcept -> bool
+        {
+            bsl::discard(tls);
+            return m_stale;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the current generation of this RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current generation of this RPT
+        ///
+        [[nodiscard]] constexpr auto
+        generation() const noexcept -> bsl::safe_uintmax
+        {
+            return m_generation;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every PP other than the current PP
+        ///     either never activated this RPT, or activated it again
+        ///     after it reached the provided generation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param generation the generation to check against
+        ///   @return Returns true if every other PP flushed the TLB entries
+        ///     this RPT had before it reached the provided generation
+        ///
+        [[nodiscard]] constexpr auto
+        is_flushed(tls_t const &tls, bsl::safe_uintmax const &generation) const noexcept
+            -> bool
+        {
+            for (auto const pp_generation : m_pp_generations) {
+                if (pp_generation.index == bsl::to_umax(tls.ppid)) {
+                    continue;
+                }
+
+                if (pp_generation.data->is_zero()) {
+                    continue;
+                }
+
+                if (*pp_generation.data < generation) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells this RPT that the current PP already flushed the
+        ///     TLB entries for the change that brought this RPT to the
+        ///     provided generation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param generation the generation this RPT reached with the
+        ///     change that the current PP flushed
+        ///
+        constexpr void
+        mark_flushed(tls_t const &tls, bsl::safe_uintmax const &generation) noexcept
+        {
+            auto *const pmut_pp_generation{m_pp_generations.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_contract(nullptr == pmut_pp_generation)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return;
+            }
+
+            if (pmut_pp_generation->is_zero()) {
+                return;
+            }
+
+            if (*pmut_pp_generation + 1_umax != generation) {
+                return;
+            }
+
+            *pmut_pp_generation = generation;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the PCID used by this RPT when CR4.PCIDE is set.
+        ///     PCID 0 is used by the microkernel's system RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pcid the PCID to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_pcid(bsl::safe_uintmax const &pcid) noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely_contract(!pcid)) {
+                bsl::error() << "invalid pcid "    // --
+                             << bsl::hex(pcid)     // --
+                             << bsl::endl          // --
+                             << bsl::here();       // --
+
+                return bsl::errc_failure;
+            }
+
+            m_pcid = pcid;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PCID used by this RPT when CR4.PCIDE is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the PCID used by this RPT when CR4.PCIDE is set.
+        ///
+        [[nodiscard]] constexpr auto
+        pcid() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_pcid;
+        }
+
         /// <!-- description -->
         ///   @brief Maps a page into the root page table being managed
         ///     by this class.
@@ -265,7 +426,12 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            return tls.test_ret;
+            if (bsl::unlikely(!tls.test_ret)) {
+                return tls.test_ret;
+            }
+
+            m_mapped.at(page_virt) = auto_release;
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
@@ -307,6 +473,353 @@ namespace mk
                 auto_release);
         }
 
+        /// <!-- description -->
+        ///   @brief Maps a physically contiguous range of memory into the
+        ///     root page table being managed by this class. The mock
+        ///     always uses 4k pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address to map the physical address
+        ///     too.
+        ///   @param phys the physical address to map.
+        ///   @param bytes the total number of bytes to map
+        ///   @param flags defines how memory should be mapped
+        ///   @param auto_release defines what auto release tag to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_pages(
+            tls_t &tls,
+            page_pool_t &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            for (bsl::safe_uintmax mut_offs{}; mut_offs < bytes; mut_offs += HYPERVISOR_PAGE_SIZE) {
+                auto const ret{this->map_page(
+                    tls, page_pool, virt + mut_offs, phys + mut_offs, flags, auto_release)};
+
+                if (bsl::unlikely(!ret)) {
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a page from the root page table being managed
+        ///     by this class.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to unmap
+        ///   @param auto_release the auto release tag the page was mapped with
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_page(
+            tls_t &tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+
+            if (bsl::unlikely_contract(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_contract(page_virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(page_virt)              // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_contract(!this->is_page_aligned(page_virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(page_virt)                       // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_contract(!(auto_release < MAP_PAGE_AUTO_RELEASE_MAX))) {
+                bsl::error() << "invalid auto release "    // --
+                             << auto_release               // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!tls.test_ret)) {
+                return tls.test_ret;
+            }
+
+            if (bsl::unlikely(!m_mapped.contains(page_virt))) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(m_mapped.at(page_virt) != auto_release)) {
+                bsl::error() << "virtual address "                      // --
+                             << bsl::hex(page_virt)                     // --
+                             << " was not mapped with auto release "    // --
+                             << auto_release                            // --
+                             << bsl::endl                               // --
+                             << bsl::here();                            // --
+
+                return bsl::errc_failure;
+            }
+
+            bsl::discard(m_mapped.erase(page_virt));
+            m_stale = true;
+            ++m_generation;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range of memory from the root page table being
+        ///     managed by this class.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address to unmap
+        ///   @param bytes the total number of bytes to unmap
+        ///   @param auto_release the auto release tag the range was mapped
+        ///     with
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_pages(
+            tls_t &tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            for (bsl::safe_uintmax mut_offs{}; mut_offs < bytes; mut_offs += HYPERVISOR_PAGE_SIZE) {
+                auto const ret{this->unmap_page(tls, page_pool, virt + mut_offs, auto_release)};
+                if (bsl::unlikely(!ret)) {
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of a range of memory that is already
+        ///     mapped into the root page table being managed by this class.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address to protect
+        ///   @param bytes the total number of bytes to protect
+        ///   @param flags defines how memory should be mapped
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        protect_pages(
+            tls_t &tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(flags);
+
+            if (bsl::unlikely_contract(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            for (bsl::safe_uintmax mut_offs{}; mut_offs < bytes; mut_offs += HYPERVISOR_PAGE_SIZE) {
+                if (bsl::unlikely(!m_mapped.contains(virt + mut_offs))) {
+                    bsl::error() << "virtual address "           // --
+                                 << bsl::hex(virt + mut_offs)    // --
+                                 << " is not mapped"             // --
+                                 << bsl::endl                    // --
+                                 << bsl::here();                 // --
+
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
+            m_stale = true;
+            ++m_generation;
+            return tls.test_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a physically contiguous range of memory into the
+        ///     root page table being managed by this class, skipping any
+        ///     part of the range that is already mapped. The mock always
+        ///     uses 4k pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address to map the physical address
+        ///     too.
+        ///   @param phys the physical address to map.
+        ///   @param bytes the total number of bytes to map
+        ///   @param flags defines how memory should be mapped
+        ///   @param use_2m if true, 2M pages are used where possible
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        populate_pages(
+            tls_t &tls,
+            page_pool_t &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags,
+            bool const use_2m) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(phys);
+            bsl::discard(flags);
+            bsl::discard(use_2m);
+
+            if (bsl::unlikely_contract(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!tls.test_ret)) {
+                return tls.test_ret;
+            }
+
+            for (bsl::safe_uintmax mut_offs{}; mut_offs < bytes; mut_offs += HYPERVISOR_PAGE_SIZE) {
+                if (!m_mapped.contains(virt + mut_offs)) {
+                    m_mapped.at(virt + mut_offs) = MAP_PAGE_NO_AUTO_RELEASE;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps every page in the provided range that was
+        ///     mapped using MAP_PAGE_NO_AUTO_RELEASE. Pages that are not
+        ///     mapped are skipped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address to reclaim
+        ///   @param bytes the total number of bytes to reclaim
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reclaim_pages(
+            tls_t &tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &bytes) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+
+            if (bsl::unlikely_contract(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!tls.test_ret)) {
+                return tls.test_ret;
+            }
+
+            for (bsl::safe_uintmax mut_offs{}; mut_offs < bytes; mut_offs += HYPERVISOR_PAGE_SIZE) {
+                if (!m_mapped.contains(virt + mut_offs)) {
+                    continue;
+                }
+
+                if (m_mapped.at(virt + mut_offs) != MAP_PAGE_NO_AUTO_RELEASE) {
+                    continue;
+                }
+
+                bsl::discard(m_mapped.erase(virt + mut_offs));
+                m_stale = true;
+                ++m_generation;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided virtual address is mapped
+        ///     with the provided auto release tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to query
+        ///   @param auto_release the auto release tag to look for
+        ///   @return Returns true if page_virt is mapped with the provided
+        ///     auto release tag, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        is_mapped_with(
+            tls_t &tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &auto_release) noexcept -> bool
+        {
+            bsl::discard(page_pool);
+
+            if (bsl::unlikely_contract(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return false;
+            }
+
+            if (bsl::unlikely(!tls.test_ret)) {
+                return false;
+            }
+
+            if (!m_mapped.contains(page_virt)) {
+                return false;
+            }
+
+            return m_mapped.at(page_virt) == auto_release;
+        }
+
         /// <!-- description -->
         ///   @brief Allocates a page from the provided page pool and maps it
         ///     into the root page table being managed by this class The page
@@ -364,6 +877,12 @@ namespace mk
 
                 return nullptr;
             }
+
+            if (bsl::unlikely(!tls.test_ret)) {
+                return nullptr;
+            }
+
+            return page_pool.template allocate<T>(tls, ALLOCATE_TAG_EXT_ELF);
         }
 
         /// <!-- description -->
@@ -424,6 +943,12 @@ namespace mk
 
                 return nullptr;
             }
+
+            if (bsl::unlikely(!tls.test_ret)) {
+                return nullptr;
+            }
+
+            return page_pool.template allocate<T>(tls, ALLOCATE_TAG_EXT_ELF);
         }
 
         /// <!-- description -->
@@ -443,8 +968,6 @@ namespace mk
         [[nodiscard]] constexpr auto
         add_tables(tls_t &tls, void const *const pml4t) noexcept -> bsl::errc_type
         {
-            lock_guard_t mut_lock{tls, m_lock};
-
             if (bsl::unlikely_contract(!m_initialized)) {
                 bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
                 return bsl::errc_failure;
@@ -455,7 +978,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            return bsl::errc_success;
+            return tls.test_ret;
         }
 
         /// <!-- description -->
@@ -475,7 +998,12 @@ namespace mk
         [[nodiscard]] constexpr auto
         add_tables(tls_t &tls, root_page_table_t const &rpt) noexcept -> bsl::errc_type
         {
-            return this->add_tables(tls, rpt.m_pml4t);
+            if (bsl::unlikely_contract(!rpt.m_initialized)) {
+                bsl::error() << "invalid rpt\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            return this->add_tables(tls, &rpt);
         }
 
         /// <!-- description -->
@@ -486,7 +1014,9 @@ namespace mk
         ///
         constexpr void
         dump(page_pool_t &page_pool) const noexcept
-        {}
+        {
+            bsl::discard(page_pool);
+        }
     };
 }
 
@@ -29,6 +29,7 @@
 #include <tls_t.hpp>
 
 #include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
 
 namespace mk
 {
@@ -51,6 +52,23 @@ namespace mk
         bool m_flag{};
 
     public:
+        /// <!-- description -->
+        ///   @brief Default constructor.
+        ///
+        constexpr spinlock_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a spinlock_t with the provided lock tag, which
+        ///     is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag that names this spinlock_t
+        ///
+        explicit constexpr spinlock_t(bsl::safe_uintmax const &tag) noexcept
+        {
+            bsl::discard(tag);
+        }
+
         /// <!-- description -->
         ///   @brief Locks the spinlock_t. This will not return until the
         ///     spinlock_t can be successfully acquired.
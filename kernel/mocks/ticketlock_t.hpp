@@ -0,0 +1,113 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_TICKETLOCK_T_HPP
+#define MOCKS_TICKETLOCK_T_HPP
+
+#include <bf_constants.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @class mk::ticketlock_t
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a mocked version of ticketlock_t
+    ///
+    /// <!-- notes -->
+    ///   @note This ticketlock_t is designed to detect and prevent deadlock
+    ///     when the same PP attempts to take the lock more than once. This
+    ///     could occur for example if a hardware exception fires before
+    ///     the lock is released. It also handles the case when the lock is
+    ///     taken, and then an ESR fires that is legit and must take the
+    ///     lock as well.
+    ///
+    class ticketlock_t final
+    {
+        /// @brief stores whether or not the ticket lock is locked.
+        bool m_flag{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor.
+        ///
+        constexpr ticketlock_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a ticketlock_t with the provided lock tag, which
+        ///     is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag that names this ticketlock_t
+        ///
+        explicit constexpr ticketlock_t(bsl::safe_uintmax const &tag) noexcept
+        {
+            bsl::discard(tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Locks the ticketlock_t. This will not return until the
+        ///     ticketlock_t can be successfully acquired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        lock(tls_t const &tls) noexcept
+        {
+            bsl::discard(tls);
+            m_flag = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks the ticketlock_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        unlock(tls_t const &tls) noexcept
+        {
+            bsl::discard(tls);
+            m_flag = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the ticketlock_t is locked
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the ticketlock_t is locked
+        ///
+        [[nodiscard]] constexpr auto
+        is_locked() const noexcept -> bool
+        {
+            return m_flag;
+        }
+    };
+}
+
+#endif
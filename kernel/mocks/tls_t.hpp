@@ -25,7 +25,9 @@
 #ifndef MOCKS_TLS_T_HPP
 #define MOCKS_TLS_T_HPP
 
+#include <debug_ring_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/cstdint.hpp>
 #include <bsl/errc_type.hpp>
@@ -74,6 +76,8 @@ namespace mk
 
         /// @brief stores the value of a page fault address for the ESR
         bsl::uintmax esr_pf_addr;
+        /// @brief stores the value of CR0 for the ESR
+        bsl::uintmax esr_cr0;
 
         /// --------------------------------------------------------------------
         /// Fast Fail Information
@@ -159,6 +163,28 @@ namespace mk
 
         /// @brief stores the currently active root page table
         void *active_rpt;
+        /// @brief stores whether or not CR4.PCIDE is set on this PP
+        bsl::uintmax pcid_enabled;
+
+        /// @brief stores the value loaded into IA32_CSTAR
+        bsl::uintmax ia32_cstar;
+        /// @brief stores the value loaded into IA32_KERNEL_GS_BASE
+        bsl::uintmax ia32_kernel_gs_base;
+
+        /// @brief stores the next VPID/ASID to give to a VPS on this PP
+        bsl::uintmax tlb_tag_next;
+        /// @brief stores the VPID/ASID generation of this PP
+        bsl::uintmax tlb_tag_generation;
+
+        /// @brief stores the XSAVE area whose state is loaded in the FPU
+        void *fpu_owner;
+        /// @brief stores whether or not CR4.OSXSAVE is set on this PP
+        bsl::uintmax xsave_enabled;
+
+        /// @brief stores the loader provided debug ring for this PP
+        loader::debug_ring_t *debug_ring;
+        /// @brief stores the loader provided trace ring for this PP
+        loader::trace_ring_t *trace_ring;
 
         /// --------------------------------------------------------------------
         /// Failure Handling
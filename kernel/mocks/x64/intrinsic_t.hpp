@@ -49,6 +49,104 @@ namespace mk
         {
             bsl::discard(val);
         }
+
+        /// <!-- description -->
+        ///   @brief Invalidates TLB entries given a virtual address
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the virtual address to invalidate
+        ///
+        static constexpr void
+        invlpg(bsl::safe_uint64 const &val) noexcept
+        {
+            bsl::discard(val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates TLB entries tagged with a PCID
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pcid the PCID to invalidate
+        ///   @param addr the virtual address to invalidate
+        ///   @param type the INVPCID type
+        ///
+        static constexpr void
+        invpcid(
+            bsl::safe_uint64 const &pcid,
+            bsl::safe_uint64 const &addr,
+            bsl::safe_uint64 const &type) noexcept
+        {
+            bsl::discard(pcid);
+            bsl::discard(addr);
+            bsl::discard(type);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of CR4
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of CR4
+        ///
+        [[nodiscard]] static constexpr auto
+        cr4() noexcept -> bsl::safe_uint64
+        {
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears CR0.TS
+        ///
+        static constexpr void
+        clts() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Sets CR0.TS
+        ///
+        static constexpr void
+        stts() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Saves the state components in "mask" to an XSAVE area
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_area the XSAVE area to save to
+        ///   @param mask the state components to save
+        ///
+        static constexpr void
+        xsave(void *const pmut_area, bsl::safe_uint64 const &mask) noexcept
+        {
+            bsl::discard(pmut_area);
+            bsl::discard(mask);
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores the state components in "mask" from an XSAVE area
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param area the XSAVE area to restore from
+        ///   @param mask the state components to restore
+        ///
+        static constexpr void
+        xrstor(void const *const area, bsl::safe_uint64 const &mask) noexcept
+        {
+            bsl::discard(area);
+            bsl::discard(mask);
+        }
+
+        /// <!-- description -->
+        ///   @brief Puts the state components in "mask" into their initial
+        ///     configuration
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mask the state components to initialize
+        ///
+        static constexpr void
+        xrstor_init(bsl::safe_uint64 const &mask) noexcept
+        {
+            bsl::discard(mask);
+        }
     };
 }
 
@@ -0,0 +1,67 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_EXIT_FILTER_HPP
+#define DISPATCH_EXIT_FILTER_HPP
+
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+#include <vps_pool_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Applies the exit filters of the active VPS to the VMExit
+    ///     that just occurred. None of the exit filter actions are
+    ///     supported on this architecture yet, so every VMExit is handed
+    ///     to the extension.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_intrinsic the intrinsics to use
+    ///   @param mut_vps_pool the VPS pool to use
+    ///   @param exit_reason the exit reason of the VMExit
+    ///   @return Returns true if the VMExit was handled by a filter, false
+    ///     if the VMExit must be handed to the extension.
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_exit_filter(
+        tls_t &mut_tls,
+        intrinsic_t &mut_intrinsic,
+        vps_pool_t &mut_vps_pool,
+        bsl::safe_uintmax const &exit_reason) noexcept -> bool
+    {
+        bsl::discard(mut_tls);
+        bsl::discard(mut_intrinsic);
+        bsl::discard(mut_vps_pool);
+        bsl::discard(exit_reason);
+
+        return false;
+    }
+}
+
+#endif
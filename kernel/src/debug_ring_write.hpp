@@ -26,77 +26,265 @@
 #define DEBUG_RING_WRITE_HPP
 
 #include <debug_ring_t.hpp>
+#include <get_current_tls.hpp>
+#include <timestamp.hpp>
+#include <tls_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstr_type.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/is_constant_evaluated.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
 #include <bsl/touch.hpp>
 
 namespace mk
 {
-    extern "C"
-    {
-        /// @brief stores a pointer to the debug ring provided by the loader
-        // NOLINTNEXTLINE(bsl-var-braced-init)
-        extern loader::debug_ring_t *g_pmut_mut_debug_ring;
-    }
+    /// @brief defines the size of a debug ring record header
+    constexpr auto DEBUG_RING_RECORD_SIZE{loader::DEBUG_RING_TSC_DIGITS + 1_umax};
 
     /// <!-- description -->
-    ///   @brief Outputs a character to the serial port.
+    ///   @brief Outputs the provided characters to the provided debug ring,
+    ///     overwriting the oldest characters in the debug ring if it is
+    ///     full. The characters are written using at most two contiguous
+    ///     copies (one before the end of the debug ring and one after it
+    ///     wraps). Only mut_epos and mut_spos are updated, it is up to the
+    ///     caller to store them in the debug ring once it is done.
     ///
     /// <!-- inputs/outputs -->
-    ///   @param c the character to output
+    ///   @param mut_ring the debug ring to output the characters to
+    ///   @param mut_epos the debug ring's current end position
+    ///   @param mut_spos the debug ring's current start position
+    ///   @param chars the characters to output
     ///
     constexpr void
-    debug_ring_write(bsl::char_type const c) noexcept
+    debug_ring_write_chars(
+        loader::debug_ring_t &mut_ring,
+        bsl::safe_uintmax &mut_epos,
+        bsl::safe_uintmax &mut_spos,
+        bsl::span<bsl::char_type const> const &chars) noexcept
     {
-        if (bsl::is_constant_evaluated()) {
+        constexpr auto one{1_umax};
+        auto const size{mut_ring.buf.size()};
+
+        /// NOTE:
+        /// - The debug ring is empty when epos == spos, which means that
+        ///   it can hold at most size - 1 characters. Anything older than
+        ///   that would be overwritten by this write anyways, so only the
+        ///   tail of the provided characters is copied.
+        ///
+
+        auto mut_src{chars};
+        if (mut_src.size() > size - one) {
+            mut_src = mut_src.subspan(mut_src.size() - (size - one), size - one);
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (mut_src.empty()) {
             return;
         }
 
-        bsl::safe_uintmax mut_epos{g_pmut_mut_debug_ring->epos};
-        bsl::safe_uintmax mut_spos{g_pmut_mut_debug_ring->spos};
+        bsl::safe_uintmax mut_used{};
+        if (mut_epos < mut_spos) {
+            mut_used = (size - mut_spos) + mut_epos;
+        }
+        else {
+            mut_used = mut_epos - mut_spos;
+        }
 
-        if (!(g_pmut_mut_debug_ring->buf.size() > mut_epos)) {
-            mut_epos = {};
+        auto mut_head{size - mut_epos};
+        if (mut_head > mut_src.size()) {
+            mut_head = mut_src.size();
+        }
+        else {
+            bsl::touch();
+        }
+
+        bsl::builtin_memcpy(mut_ring.buf.at_if(mut_epos), mut_src.data(), mut_head);
+
+        auto const tail{mut_src.subspan(mut_head, mut_src.size() - mut_head)};
+        if (!tail.empty()) {
+            bsl::builtin_memcpy(mut_ring.buf.data(), tail.data(), tail.size());
         }
         else {
             bsl::touch();
         }
 
-        *g_pmut_mut_debug_ring->buf.at_if(mut_epos) = c;
-        ++mut_epos;
+        mut_epos += mut_src.size();
+        if (!(size > mut_epos)) {
+            mut_epos -= size;
+        }
+        else {
+            bsl::touch();
+        }
+
+        mut_used += mut_src.size();
+        if (mut_used > size - one) {
+            mut_used = size - one;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (mut_epos < mut_used) {
+            mut_spos = (mut_epos + size) - mut_used;
+        }
+        else {
+            mut_spos = mut_epos - mut_used;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the next character written to the provided
+    ///     debug ring starts a new line (i.e., the debug ring is empty or
+    ///     the last character written to it was a '\n').
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ring the debug ring to query
+    ///   @param epos the debug ring's current end position
+    ///   @param spos the debug ring's current start position
+    ///   @return Returns true if the next character written to the provided
+    ///     debug ring starts a new line.
+    ///
+    [[nodiscard]] constexpr auto
+    debug_ring_at_line_start(
+        loader::debug_ring_t const &ring,
+        bsl::safe_uintmax const &epos,
+        bsl::safe_uintmax const &spos) noexcept -> bool
+    {
+        constexpr auto one{1_umax};
+
+        if (epos == spos) {
+            return true;
+        }
+
+        if (epos.is_zero()) {
+            return '\n' == *ring.buf.at_if(ring.buf.size() - one);
+        }
+
+        return '\n' == *ring.buf.at_if(epos - one);
+    }
+
+    /// <!-- description -->
+    ///   @brief Starts a new record in the provided debug ring. A record
+    ///     starts with a loader::DEBUG_RING_RECORD_START followed by the
+    ///     provided TSC in hex, which the loader uses to merge the debug
+    ///     rings of each PP in time order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_ring the debug ring to start the new record in
+    ///   @param mut_epos the debug ring's current end position
+    ///   @param mut_spos the debug ring's current start position
+    ///   @param tsc the TSC to tag the new record with
+    ///
+    constexpr void
+    debug_ring_write_record_start(
+        loader::debug_ring_t &mut_ring,
+        bsl::safe_uintmax &mut_epos,
+        bsl::safe_uintmax &mut_spos,
+        bsl::safe_uintmax const &tsc) noexcept
+    {
+        constexpr bsl::string_view digits{"0123456789abcdef"};
+        constexpr auto bits_per_digit{4_umax};
+        constexpr auto digit_mask{0xF_umax};
+
+        bsl::array<bsl::char_type, DEBUG_RING_RECORD_SIZE.get()> mut_record{};
+        *mut_record.front_if() = loader::DEBUG_RING_RECORD_START;
+
+        for (auto mut_i{loader::DEBUG_RING_TSC_DIGITS}; mut_i.is_pos(); --mut_i) {
+            auto const shift{(loader::DEBUG_RING_TSC_DIGITS - mut_i) * bits_per_digit};
+            *mut_record.at_if(mut_i) = *digits.at_if((tsc >> shift) & digit_mask);
+        }
+
+        debug_ring_write_chars(
+            mut_ring, mut_epos, mut_spos, {mut_record.data(), mut_record.size()});
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided characters to the provided debug ring,
+    ///     starting a new record tagged with the provided TSC for each
+    ///     line. Each line is written using debug_ring_write_chars, and
+    ///     the debug ring's epos and spos are only stored once all of the
+    ///     characters have been written.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_ring the debug ring to output the characters to
+    ///   @param chars the characters to output
+    ///   @param tsc the TSC to tag any new records with
+    ///
+    constexpr void
+    debug_ring_write_str(
+        loader::debug_ring_t &mut_ring,
+        bsl::span<bsl::char_type const> const &chars,
+        bsl::safe_uintmax const &tsc) noexcept
+    {
+        constexpr auto one{1_umax};
+        auto const size{mut_ring.buf.size()};
+
+        bsl::safe_uintmax mut_epos{mut_ring.epos};
+        bsl::safe_uintmax mut_spos{mut_ring.spos};
 
-        if (!(g_pmut_mut_debug_ring->buf.size() > mut_epos)) {
+        if (!(size > mut_epos) || !(size > mut_spos)) {
             mut_epos = {};
+            mut_spos = {};
         }
         else {
             bsl::touch();
         }
 
-        if (mut_epos == mut_spos) {
-            ++mut_spos;
+        bool mut_at_line_start{debug_ring_at_line_start(mut_ring, mut_epos, mut_spos)};
+
+        bsl::safe_uintmax mut_pos{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < chars.size(); ++mut_i) {
+            bool const at_line_end{'\n' == *chars.at_if(mut_i)};
+            if (!at_line_end && (mut_i + one < chars.size())) {
+                continue;
+            }
 
-            if (!(g_pmut_mut_debug_ring->buf.size() > mut_spos)) {
-                mut_spos = {};
+            if (mut_at_line_start) {
+                debug_ring_write_record_start(mut_ring, mut_epos, mut_spos, tsc);
             }
             else {
                 bsl::touch();
             }
+
+            auto const line{chars.subspan(mut_pos, (mut_i + one) - mut_pos)};
+            debug_ring_write_chars(mut_ring, mut_epos, mut_spos, line);
+
+            mut_at_line_start = at_line_end;
+            mut_pos = mut_i + one;
         }
-        else {
-            bsl::touch();
+
+        mut_ring.epos = mut_epos.get();
+        mut_ring.spos = mut_spos.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs a character to the current PP's debug ring. Each
+    ///     PP has its own debug ring, so no synchronization is needed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to output
+    ///
+    constexpr void
+    debug_ring_write(bsl::char_type const c) noexcept
+    {
+        if (bsl::is_constant_evaluated()) {
+            return;
         }
 
-        g_pmut_mut_debug_ring->epos = mut_epos.get();
-        g_pmut_mut_debug_ring->spos = mut_spos.get();
+        debug_ring_write_str(
+            *get_current_tls()->debug_ring, {&c, 1_umax}, bsl::to_umax(timestamp()));
     }
 
     /// <!-- description -->
-    ///   @brief Outputs a string to the serial port.
+    ///   @brief Outputs a string to the current PP's debug ring. Each
+    ///     PP has its own debug ring, so no synchronization is needed.
     ///
     /// <!-- inputs/outputs -->
     ///   @param str the string to output
@@ -108,9 +296,11 @@ namespace mk
             return;
         }
 
-        for (bsl::safe_uintmax mut_i{}; '\0' != str[mut_i.get()]; ++mut_i) {
-            debug_ring_write(str[mut_i.get()]);
-        }
+        bsl::string_view const view{str};
+        debug_ring_write_str(
+            *get_current_tls()->debug_ring,
+            {view.data(), view.size()},
+            bsl::to_umax(timestamp()));
     }
 }
 
@@ -27,6 +27,8 @@
 
 #include <ext_t.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+#include <trace_ring_write.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
@@ -61,7 +63,11 @@ namespace mk
             return bsl::errc_failure;
         }
 
-        return pmut_ext->map_page_direct(mut_tls, mut_page_pool, bsl::to_umax(mut_tls.esr_pf_addr));
+        auto const addr{bsl::to_umax(mut_tls.esr_pf_addr)};
+        trace_ring_write(
+            mut_tls, loader::TRACE_EVENT_PAGE_FAULT, addr, bsl::to_umax(mut_tls.active_extid));
+
+        return pmut_ext->map_page_direct(mut_tls, mut_page_pool, addr);
     }
 }
 
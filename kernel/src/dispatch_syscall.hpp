@@ -183,8 +183,8 @@ namespace mk
             }
 
             case syscall::BF_MEM_OP_VAL.get(): {
-                auto const ret{
-                    dispatch_syscall_mem_op(mut_tls, mut_page_pool, mut_huge_pool, mut_ext)};
+                auto const ret{dispatch_syscall_mem_op(
+                    mut_tls, mut_page_pool, mut_huge_pool, mut_intrinsic, mut_ext)};
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -29,6 +29,7 @@
 #include <ext_pool_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <lock_stats_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
@@ -136,6 +137,19 @@ namespace mk
                 return syscall::BF_STATUS_SUCCESS;
             }
 
+            case syscall::BF_DEBUG_OP_PAGE_POOL_STATS_IDX_VAL.get(): {
+                mut_tls.ext_reg0 = page_pool.size().get();
+                mut_tls.ext_reg1 = page_pool.used().get();
+                mut_tls.ext_reg2 = page_pool.high_water_mark().get();
+                mut_tls.ext_reg3 = page_pool.failures().get();
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
+            case syscall::BF_DEBUG_OP_DUMP_LOCK_STATS_IDX_VAL.get(): {
+                g_mut_lock_stats.dump();
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
             default: {
                 break;
             }
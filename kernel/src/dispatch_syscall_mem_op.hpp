@@ -27,6 +27,9 @@
 
 #include <bf_constants.hpp>
 #include <ext_t.hpp>
+#include <huge_pool_t.hpp>
+#include <intrinsic_t.hpp>
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/convert.hpp>
@@ -66,13 +69,20 @@ namespace mk
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page pool to use
+    ///   @param mut_intrinsic the intrinsics to use
     ///   @param mut_ext the extension that made the syscall
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
-    syscall_mem_op_free_page(tls_t &mut_tls, ext_t &mut_ext) noexcept -> syscall::bf_status_t
+    syscall_mem_op_free_page(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t &mut_intrinsic,
+        ext_t &mut_ext) noexcept -> syscall::bf_status_t
     {
-        auto const ret{mut_ext.free_page(bsl::to_umax(mut_tls.ext_reg1))};
+        auto const ret{mut_ext.free_page(
+            mut_tls, mut_page_pool, mut_intrinsic, bsl::to_umax(mut_tls.ext_reg1))};
         if (bsl::unlikely(!ret)) {
             bsl::print<bsl::V>() << bsl::here();
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
@@ -116,13 +126,22 @@ namespace mk
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the current TLS block
+    ///   @param page_pool the page pool to use
+    ///   @param mut_huge_pool the huge pool to use
+    ///   @param mut_intrinsic the intrinsics to use
     ///   @param mut_ext the extension that made the syscall
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
-    syscall_mem_op_free_huge(tls_t &mut_tls, ext_t &mut_ext) noexcept -> syscall::bf_status_t
+    syscall_mem_op_free_huge(
+        tls_t &mut_tls,
+        page_pool_t const &page_pool,
+        huge_pool_t &mut_huge_pool,
+        intrinsic_t &mut_intrinsic,
+        ext_t &mut_ext) noexcept -> syscall::bf_status_t
     {
-        auto const ret{mut_ext.free_huge(bsl::to_umax(mut_tls.ext_reg1))};
+        auto const ret{mut_ext.free_huge(
+            mut_tls, page_pool, mut_huge_pool, mut_intrinsic, bsl::to_umax(mut_tls.ext_reg1))};
         if (bsl::unlikely(!ret)) {
             bsl::print<bsl::V>() << bsl::here();
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
@@ -155,6 +174,31 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_mem_op_map_direct syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page pool to use
+    ///   @param mut_ext the extension that made the syscall
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_mem_op_map_direct(tls_t &mut_tls, page_pool_t &mut_page_pool, ext_t &mut_ext) noexcept
+        -> syscall::bf_status_t
+    {
+        auto const phys{bsl::to_umax(mut_tls.ext_reg1)};
+        auto const bytes{bsl::to_umax(mut_tls.ext_reg2)};
+
+        auto const ret{mut_ext.map_direct(mut_tls, mut_page_pool, phys, bytes)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_mem_op syscalls
     ///
@@ -162,6 +206,7 @@ namespace mk
     ///   @param mut_tls the current TLS block
     ///   @param mut_page_pool the page pool to use
     ///   @param mut_huge_pool the huge pool to use
+    ///   @param mut_intrinsic the intrinsics to use
     ///   @param mut_ext the extension that made the syscall
     ///   @return Returns a bf_status_t containing success or failure
     ///
@@ -170,6 +215,7 @@ namespace mk
         tls_t &mut_tls,
         page_pool_t &mut_page_pool,
         huge_pool_t &mut_huge_pool,
+        intrinsic_t &mut_intrinsic,
         ext_t &mut_ext) noexcept -> syscall::bf_status_t
     {
         if (bsl::unlikely(!mut_ext.is_handle_valid(bsl::to_u64(mut_tls.ext_reg0)))) {
@@ -193,7 +239,8 @@ namespace mk
             }
 
             case syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL.get(): {
-                auto const ret{syscall_mem_op_free_page(mut_tls, mut_ext)};
+                auto const ret{
+                    syscall_mem_op_free_page(mut_tls, mut_page_pool, mut_intrinsic, mut_ext)};
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -214,7 +261,8 @@ namespace mk
             }
 
             case syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL.get(): {
-                auto const ret{syscall_mem_op_free_huge(mut_tls, mut_ext)};
+                auto const ret{syscall_mem_op_free_huge(
+                    mut_tls, mut_page_pool, mut_huge_pool, mut_intrinsic, mut_ext)};
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -233,6 +281,16 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_MEM_OP_MAP_DIRECT_IDX_VAL.get(): {
+                auto const ret{syscall_mem_op_map_direct(mut_tls, mut_page_pool, mut_ext)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
@@ -26,6 +26,8 @@
 #define DISPATCH_SYSCALL_VPS_OP_HPP
 
 #include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+#include <bf_reg_batch_entry_t.hpp>
 #include <bf_reg_t.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
@@ -41,6 +43,7 @@
 #include <bsl/debug.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -186,6 +189,201 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Returns the list of bf_reg_batch_entry_t provided by the
+    ///     extension to bf_vps_op_read_batch and bf_vps_op_write_batch. REG2
+    ///     stores the address of a page that the extension allocated using
+    ///     bf_mem_op_alloc_page, and REG3 stores the number of entries.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param page_pool the page pool to use
+    ///   @param mut_ext the extension that made the syscall
+    ///   @return Returns the list of entries, or an empty span on failure
+    ///
+    [[nodiscard]] constexpr auto
+    get_reg_batch(tls_t &mut_tls, page_pool_t const &page_pool, ext_t &mut_ext) noexcept
+        -> bsl::span<syscall::bf_reg_batch_entry_t>
+    {
+        constexpr auto entry_size{bsl::to_umax(sizeof(syscall::bf_reg_batch_entry_t))};
+        static_assert(syscall::BF_REG_BATCH_MAX_ENTRIES * entry_size <= HYPERVISOR_PAGE_SIZE);
+
+        auto const num{bsl::to_umax(mut_tls.ext_reg3)};
+        if (bsl::unlikely(num.is_zero() || num > syscall::BF_REG_BATCH_MAX_ENTRIES)) {
+            bsl::error() << "invalid number of batch entries "    // --
+                         << num                                   // --
+                         << bsl::endl                             // --
+                         << bsl::here();                          // --
+
+            return {};
+        }
+
+        auto *const pmut_page{
+            mut_ext.lookup_page(mut_tls, page_pool, bsl::to_umax(mut_tls.ext_reg2))};
+        if (bsl::unlikely(nullptr == pmut_page)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return {reinterpret_cast<syscall::bf_reg_batch_entry_t *>(pmut_page), num};
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vps_op_read_batch syscall. Every entry is
+    ///     processed, even if an entry before it failed, and the result of
+    ///     each entry is stored in its status field.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param page_pool the page pool to use
+    ///   @param intrinsic the intrinsics to use
+    ///   @param mut_vps_pool the VPS pool to use
+    ///   @param mut_ext the extension that made the syscall
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_vps_op_read_batch(
+        tls_t &mut_tls,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        vps_pool_t &mut_vps_pool,
+        ext_t &mut_ext) noexcept -> syscall::bf_status_t
+    {
+        auto mut_batch{get_reg_batch(mut_tls, page_pool, mut_ext)};
+        if (bsl::unlikely(mut_batch.empty())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        bool mut_failed{};
+        auto const vpsid{bsl::to_u16_unsafe(mut_tls.ext_reg1)};
+
+        for (auto const elem : mut_batch) {
+            auto const val{mut_vps_pool.read(mut_tls, intrinsic, vpsid, elem.data->reg)};
+            if (bsl::unlikely(!val)) {
+                elem.data->status = syscall::BF_STATUS_FAILURE_UNKNOWN.get();
+                mut_failed = true;
+                continue;
+            }
+
+            elem.data->val = val.get();
+            elem.data->status = syscall::BF_STATUS_SUCCESS.get();
+        }
+
+        if (bsl::unlikely(mut_failed)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vps_op_write_batch syscall. Entries are
+    ///     written in order, every entry is processed, even if an entry
+    ///     before it failed, and the result of each entry is stored in its
+    ///     status field.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param page_pool the page pool to use
+    ///   @param mut_intrinsic the intrinsics to use
+    ///   @param mut_vps_pool the VPS pool to use
+    ///   @param mut_ext the extension that made the syscall
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_vps_op_write_batch(
+        tls_t &mut_tls,
+        page_pool_t const &page_pool,
+        intrinsic_t &mut_intrinsic,
+        vps_pool_t &mut_vps_pool,
+        ext_t &mut_ext) noexcept -> syscall::bf_status_t
+    {
+        auto mut_batch{get_reg_batch(mut_tls, page_pool, mut_ext)};
+        if (bsl::unlikely(mut_batch.empty())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        bool mut_failed{};
+        auto const vpsid{bsl::to_u16_unsafe(mut_tls.ext_reg1)};
+
+        for (auto const elem : mut_batch) {
+            auto const ret{mut_vps_pool.write(
+                mut_tls, mut_intrinsic, vpsid, elem.data->reg, bsl::to_u64(elem.data->val))};
+            if (bsl::unlikely(!ret)) {
+                elem.data->status = syscall::BF_STATUS_FAILURE_UNKNOWN.get();
+                mut_failed = true;
+                continue;
+            }
+
+            elem.data->status = syscall::BF_STATUS_SUCCESS.get();
+        }
+
+        if (bsl::unlikely(mut_failed)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vps_op_set_exit_filters syscall. REG2
+    ///     stores the address of a page that the extension allocated using
+    ///     bf_mem_op_alloc_page, and REG3 stores the number of filters in
+    ///     that page. The filters are copied, so the page can be reused
+    ///     (or freed) once this syscall returns. If REG3 is 0, REG2 is
+    ///     ignored and the exit filters of the VPS are removed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param page_pool the page pool to use
+    ///   @param mut_vps_pool the VPS pool to use
+    ///   @param mut_ext the extension that made the syscall
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_vps_op_set_exit_filters(
+        tls_t &mut_tls,
+        page_pool_t const &page_pool,
+        vps_pool_t &mut_vps_pool,
+        ext_t &mut_ext) noexcept -> syscall::bf_status_t
+    {
+        constexpr auto filter_size{bsl::to_umax(sizeof(syscall::bf_exit_filter_t))};
+        static_assert(syscall::BF_EXIT_FILTER_MAX_ENTRIES * filter_size <= HYPERVISOR_PAGE_SIZE);
+
+        syscall::bf_exit_filter_t const *mut_filters{};
+        auto const num{bsl::to_umax(mut_tls.ext_reg3)};
+
+        if (!num.is_zero()) {
+            auto const *const page{
+                mut_ext.lookup_page(mut_tls, page_pool, bsl::to_umax(mut_tls.ext_reg2))};
+            if (bsl::unlikely(nullptr == page)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            mut_filters = reinterpret_cast<syscall::bf_exit_filter_t const *>(page);
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const ret{mut_vps_pool.set_exit_filters(
+            mut_tls, bsl::to_u16_unsafe(mut_tls.ext_reg1), {mut_filters, num})};
+
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Implements the bf_vps_op_run syscall
     ///
@@ -480,7 +678,7 @@ namespace mk
     ///   @param mut_vm_pool the VM pool to use
     ///   @param mut_vp_pool the VP pool to use
     ///   @param mut_vps_pool the VPS pool to use
-    ///   @param ext the extension that made the syscall
+    ///   @param mut_ext the extension that made the syscall
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
@@ -491,9 +689,9 @@ namespace mk
         vm_pool_t &mut_vm_pool,
         vp_pool_t &mut_vp_pool,
         vps_pool_t &mut_vps_pool,
-        ext_t const &ext) noexcept -> syscall::bf_status_t
+        ext_t &mut_ext) noexcept -> syscall::bf_status_t
     {
-        if (bsl::unlikely(!ext.is_handle_valid(bsl::to_u64(mut_tls.ext_reg0)))) {
+        if (bsl::unlikely(!mut_ext.is_handle_valid(bsl::to_u64(mut_tls.ext_reg0)))) {
             bsl::error() << "invalid handle "             // --
                          << bsl::hex(mut_tls.ext_reg0)    // --
                          << bsl::endl                     // --
@@ -504,7 +702,7 @@ namespace mk
 
         if (bsl::unlikely(mut_tls.ext != mut_tls.ext_vmexit)) {
             bsl::error() << "vps ops are not allowed by ext "       // --
-                         << bsl::hex(ext.id())                      // --
+                         << bsl::hex(mut_ext.id())                  // --
                          << " as it didn't register for vmexits"    // --
                          << bsl::endl                               // --
                          << bsl::here();                            // --
@@ -626,6 +824,39 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_VPS_OP_READ_BATCH_IDX_VAL.get(): {
+                auto const ret{syscall_vps_op_read_batch(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vps_pool, mut_ext)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VPS_OP_WRITE_BATCH_IDX_VAL.get(): {
+                auto const ret{syscall_vps_op_write_batch(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vps_pool, mut_ext)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VPS_OP_SET_EXIT_FILTERS_IDX_VAL.get(): {
+                auto const ret{syscall_vps_op_set_exit_filters(
+                    mut_tls, mut_page_pool, mut_vps_pool, mut_ext)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
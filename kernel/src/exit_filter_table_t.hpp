@@ -0,0 +1,313 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef EXIT_FILTER_TABLE_T_HPP
+#define EXIT_FILTER_TABLE_T_HPP
+
+#include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+#include <bsl/unlikely_assert.hpp>
+
+namespace mk
+{
+    /// @class mk::exit_filter_table_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the exit filters that an extension registered for a
+    ///     VPS using bf_vps_op_set_exit_filters. The filters are searched
+    ///     in the order they were registered, and the first filter that
+    ///     matches a VMExit wins. Each filter counts the number of times it
+    ///     was used (see record_hit), which is how the number of VMExits
+    ///     that were handled without calling the extension is reported.
+    ///
+    /// <!-- notes -->
+    ///   @note A VPS only ever runs on one PP at a time, and the table is
+    ///     only changed while the VPS is not running on another PP, so the
+    ///     table and its counters do not need atomics or locks.
+    ///
+    class exit_filter_table_t final
+    {
+        /// @brief stores the filters
+        bsl::array<syscall::bf_exit_filter_t, syscall::BF_EXIT_FILTER_MAX_ENTRIES.get()>
+            m_filters{};
+        /// @brief stores the number of times each filter matched
+        bsl::array<bsl::safe_uintmax, syscall::BF_EXIT_FILTER_MAX_ENTRIES.get()> m_hits{};
+        /// @brief stores the number of filters
+        bsl::safe_uintmax m_size{};
+        /// @brief stores the number of VMExits that were searched
+        bsl::safe_uintmax m_exits{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Replaces the filters in this table with the provided
+        ///     filters, and resets the counters. If any of the provided
+        ///     filters are invalid, the table is left unchanged.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param filters the filters to store in this table
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set(bsl::span<syscall::bf_exit_filter_t const> const &filters) noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(filters.size() > syscall::BF_EXIT_FILTER_MAX_ENTRIES)) {
+                bsl::error() << "invalid number of exit filters "    // --
+                             << filters.size()                       // --
+                             << bsl::endl                            // --
+                             << bsl::here();                         // --
+
+                return bsl::errc_index_out_of_bounds;
+            }
+
+            for (auto const elem : filters) {
+                auto const action{bsl::to_u64(elem.data->action)};
+                if (bsl::unlikely(action > syscall::BF_EXIT_FILTER_ACTION_ADVANCE_IP)) {
+                    bsl::error() << "exit filter "               // --
+                                 << elem.index                   // --
+                                 << " has an invalid action "    // --
+                                 << bsl::hex(action)             // --
+                                 << bsl::endl                    // --
+                                 << bsl::here();                 // --
+
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
+            this->clear();
+            for (auto const elem : filters) {
+                *m_filters.at_if(elem.index) = *elem.data;
+            }
+
+            m_size = filters.size();
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the filters from this table, and resets
+        ///     the counters.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            for (auto const elem : m_hits) {
+                *elem.data = {};
+            }
+
+            m_size = {};
+            m_exits = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of filters in this table
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of filters in this table
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of times the requested filter
+        ///     matched a VMExit, or bsl::safe_uintmax::failure() if the
+        ///     index is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the filter to query
+        ///   @return Returns the number of times the requested filter
+        ///     matched a VMExit, or bsl::safe_uintmax::failure() if the
+        ///     index is invalid.
+        ///
+        [[nodiscard]] constexpr auto
+        hits(bsl::safe_uintmax const &idx) const noexcept -> bsl::safe_uintmax
+        {
+            if (bsl::unlikely(idx >= m_size)) {
+                return bsl::safe_uintmax::failure();
+            }
+
+            return *m_hits.at_if(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of VMExits that were handled by
+        ///     this table without calling the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of VMExits that were handled by
+        ///     this table without calling the extension.
+        ///
+        [[nodiscard]] constexpr auto
+        handled() const noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax mut_handled{};
+            for (bsl::safe_uintmax mut_i{}; mut_i < m_size; ++mut_i) {
+                auto const action{bsl::to_u64(m_filters.at_if(mut_i)->action)};
+                if (syscall::BF_EXIT_FILTER_ACTION_EXT != action) {
+                    mut_handled += *m_hits.at_if(mut_i);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return mut_handled;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first filter that matches the
+        ///     provided VMExit, or bsl::safe_uintmax::failure() if no filter
+        ///     matched. A BF_EXIT_FILTER_ACTION_EXT filter can match, in
+        ///     which case the caller must hand the VMExit to the extension.
+        ///     Matching a filter does not count as a hit (see record_hit).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason of the VMExit
+        ///   @param qual the exit qualification of the VMExit
+        ///   @param regs the guest's ECX:EAX
+        ///   @return Returns the index of the first filter that matches the
+        ///     provided VMExit, or bsl::safe_uintmax::failure() if no filter
+        ///     matched.
+        ///
+        [[nodiscard]] constexpr auto
+        match(
+            bsl::safe_uintmax const &exit_reason,
+            bsl::safe_uintmax const &qual,
+            bsl::safe_uintmax const &regs) noexcept -> bsl::safe_uintmax
+        {
+            if (m_size.is_zero()) {
+                return bsl::safe_uintmax::failure();
+            }
+
+            ++m_exits;
+            for (bsl::safe_uintmax mut_i{}; mut_i < m_size; ++mut_i) {
+                auto const *const filter{m_filters.at_if(mut_i)};
+
+                if (exit_reason != bsl::to_umax(filter->exit_reason)) {
+                    continue;
+                }
+
+                if ((qual & bsl::to_umax(filter->qual_mask)) != bsl::to_umax(filter->qual_val)) {
+                    continue;
+                }
+
+                if ((regs & bsl::to_umax(filter->reg_mask)) != bsl::to_umax(filter->reg_val)) {
+                    continue;
+                }
+
+                return mut_i;
+            }
+
+            return bsl::safe_uintmax::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested filter, or a nullptr if the index
+        ///     is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the filter to get
+        ///   @return Returns the requested filter, or a nullptr if the index
+        ///     is invalid.
+        ///
+        [[nodiscard]] constexpr auto
+        at(bsl::safe_uintmax const &idx) const noexcept -> syscall::bf_exit_filter_t const *
+        {
+            if (bsl::unlikely(!idx) || bsl::unlikely(idx >= m_size)) {
+                return nullptr;
+            }
+
+            return m_filters.at_if(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hit for the requested filter. The caller
+        ///     records a hit once it has used the filter that match()
+        ///     returned, meaning the VMExit was either handed to the
+        ///     extension (BF_EXIT_FILTER_ACTION_EXT), or handled by the
+        ///     filter and the guest's IP was advanced. A VMExit that
+        ///     matched a filter but could not be handled by it is not
+        ///     counted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the filter that was used
+        ///
+        constexpr void
+        record_hit(bsl::safe_uintmax const &idx) noexcept
+        {
+            if (bsl::unlikely_assert(!idx) || bsl::unlikely_assert(idx >= m_size)) {
+                bsl::error() << "invalid exit filter index "    // --
+                             << idx                             // --
+                             << bsl::endl                       // --
+                             << bsl::here();                    // --
+
+                return;
+            }
+
+            ++*m_hits.at_if(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the exit filter table
+        ///
+        constexpr void
+        dump() const noexcept
+        {
+            if constexpr (BSL_DEBUG_LEVEL == bsl::CRITICAL_ONLY) {
+                return;
+            }
+
+            bsl::print() << bsl::mag << "exit filters: ";
+            bsl::print() << bsl::rst << m_size << " registered, ";
+            bsl::print() << bsl::grn << this->handled();
+            bsl::print() << bsl::rst << " of " << m_exits << " exits short-circuited";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            for (bsl::safe_uintmax mut_i{}; mut_i < m_size; ++mut_i) {
+                auto const *const filter{m_filters.at_if(mut_i)};
+
+                bsl::print() << bsl::rst << "  [" << mut_i << "] ";
+                bsl::print() << bsl::rst << "reason: " << bsl::hex(filter->exit_reason);
+                bsl::print() << bsl::rst << ", action: " << bsl::hex(filter->action);
+                bsl::print() << bsl::rst << ", hits: " << *m_hits.at_if(mut_i);
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+        }
+    };
+}
+
+#endif
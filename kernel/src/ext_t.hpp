@@ -32,9 +32,11 @@
 #include <bfelf/elf64_ehdr_t.hpp>
 #include <bfelf/elf64_phdr_t.hpp>
 #include <call_ext.hpp>
+#include <ext_deferred_frees_t.hpp>
 #include <ext_tcb_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <invpcid_descriptor_t.hpp>
 #include <map_page_flags.hpp>
 #include <mk_args_t.hpp>
 #include <page_aligned_bytes_t.hpp>
@@ -43,11 +45,14 @@
 #include <root_page_table_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+#include <trace_ring_write.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unlikely_assert.hpp>
 
@@ -126,6 +131,14 @@ namespace mk
         bsl::safe_uintmax m_handle{bsl::safe_uintmax::failure()};
         /// @brief stores the extension's heap cursor
         bsl::safe_uintmax m_heap_virt{HYPERVISOR_EXT_HEAP_POOL_ADDR};
+        /// @brief stores the number of TLB flushes avoided using PCIDs
+        bsl::array<bsl::safe_uintmax, HYPERVISOR_MAX_PPS.get()> m_tlb_flushes_avoided{};
+        /// @brief stores the number of direct map page faults
+        bsl::array<bsl::safe_uintmax, HYPERVISOR_MAX_PPS.get()> m_direct_map_faults{};
+        /// @brief stores the pages each PP freed that other PPs might still cache
+        bsl::array<ext_deferred_frees_t, HYPERVISOR_MAX_PPS.get()> m_deferred_pages{};
+        /// @brief stores the huge blocks each PP freed that other PPs might still cache
+        bsl::array<ext_deferred_frees_t, HYPERVISOR_MAX_PPS.get()> m_deferred_huge{};
 
         /// <!-- description -->
         ///   @brief Returns the program header table
@@ -887,6 +900,232 @@ namespace mk
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Unmaps memory that was given to the extension using
+        ///     alloc_page or alloc_huge from VM 0's direct map and
+        ///     invalidates the TLB.
+        ///
+        /// <!-- notes -->
+        ///   @note The current PP flushes the pages right away as it returns
+        ///     to the extension without going through execute(). All of the
+        ///     other PPs that used VM 0's direct map flush their TLB the
+        ///     next time they activate it (see root_page_table_t::is_stale).
+        ///     Until then, another PP that is running the extension can
+        ///     still reach the memory through a stale TLB entry, so the
+        ///     memory must not be given back to the page pool (or huge
+        ///     pool) until every other PP has activated VM 0's direct map
+        ///     again. Callers use free_direct_map() for this.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param virt the virtual address of the memory to unmap
+        ///   @param pages the total number of pages to unmap
+        ///   @param auto_release the auto release tag the memory was mapped
+        ///     with
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_direct_map(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            intrinsic_t &mut_intrinsic,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &pages,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            constexpr auto disabled{0_umax};
+            auto &mut_rpt{m_direct_map_rpts.front()};
+
+            auto const ret{mut_rpt.unmap_pages(
+                mut_tls, page_pool, virt, pages * HYPERVISOR_PAGE_SIZE, auto_release)};
+
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            /// NOTE:
+            /// - The memory might have been mapped using 2M pages. invlpg
+            ///   (and an individual-address INVPCID) of any address in a
+            ///   2M page flushes the entire 2M page, so flushing each 4k
+            ///   page works regardless of how the memory was mapped.
+            /// - When PCIDs are enabled, invlpg only flushes the TLB
+            ///   entries tagged with the current PCID. If VM 0's direct map
+            ///   is not the active RPT, the pages are flushed from its PCID
+            ///   using INVPCID instead, which leaves the rest of its TLB
+            ///   entries alone.
+            /// - Either way, this PP has flushed everything this unmap
+            ///   changed, so it does not have to flush all of VM 0's direct
+            ///   map the next time it activates it, unless another change
+            ///   was made that this PP has not flushed yet (see
+            ///   root_page_table_t::mark_flushed).
+            ///
+
+            bool const use_invpcid{
+                disabled != mut_tls.pcid_enabled && mut_tls.active_rpt != &mut_rpt};
+
+            for (bsl::safe_uintmax mut_i{}; mut_i < pages; ++mut_i) {
+                auto const page_virt{virt + (mut_i * HYPERVISOR_PAGE_SIZE)};
+                if (use_invpcid) {
+                    mut_intrinsic.invpcid(
+                        bsl::to_u64(mut_rpt.pcid()),
+                        bsl::to_u64(page_virt),
+                        INVPCID_TYPE_INDIVIDUAL_ADDRESS);
+                }
+                else {
+                    mut_intrinsic.invlpg(bsl::to_u64(page_virt));
+                }
+            }
+
+            mut_rpt.mark_flushed(mut_tls, mut_rpt.generation());
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the frees the current PP deferred using the
+        ///     provided list of deferred frees, or a nullptr if the TLS
+        ///     block's ppid is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_deferred the per-PP deferred frees to search
+        ///   @return Returns the frees the current PP deferred, or a nullptr
+        ///     if the TLS block's ppid is invalid.
+        ///
+        [[nodiscard]] static constexpr auto
+        get_deferred_frees(
+            tls_t const &tls,
+            bsl::array<ext_deferred_frees_t, HYPERVISOR_MAX_PPS.get()> &mut_deferred) noexcept
+            -> ext_deferred_frees_t *
+        {
+            auto *const pmut_frees{mut_deferred.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_frees)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return nullptr;
+            }
+
+            return pmut_frees;
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives a page that was freed using free_page back to
+        ///     the page pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to give the page back to
+        ///   @param mem the page to give back
+        ///
+        static constexpr void
+        give_back(
+            tls_t &mut_tls, page_pool_t &mut_page_pool, bsl::span<page_t> const &mem) noexcept
+        {
+            mut_page_pool.deallocate(mut_tls, mem.data(), ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives a block of memory that was freed using free_huge
+        ///     back to the huge pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_huge_pool the huge_pool_t to give the memory back to
+        ///   @param mem the memory to give back
+        ///
+        static constexpr void
+        give_back(
+            tls_t &mut_tls, huge_pool_t &mut_huge_pool, bsl::span<page_t> const &mem) noexcept
+        {
+            mut_huge_pool.deallocate(mut_tls, mem);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the memory the current PP deferred back to the
+        ///     provided pool once every other PP has flushed it from its
+        ///     TLB. Memory that other PPs might still cache is kept.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam POOL_CONCEPT the type of pool to give the memory to
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_pool the pool to give the memory back to
+        ///   @param mut_frees the frees the current PP deferred
+        ///
+        template<typename POOL_CONCEPT>
+        constexpr void
+        release_deferred_frees(
+            tls_t &mut_tls, POOL_CONCEPT &mut_pool, ext_deferred_frees_t &mut_frees) noexcept
+        {
+            auto const &rpt{m_direct_map_rpts.front()};
+
+            bsl::safe_uintmax mut_kept{};
+            for (bsl::safe_uintmax mut_i{}; mut_i < mut_frees.size; ++mut_i) {
+                auto const mem{*mut_frees.mem.at_if(mut_i)};
+                auto const generation{*mut_frees.generations.at_if(mut_i)};
+
+                if (rpt.is_flushed(mut_tls, generation)) {
+                    give_back(mut_tls, mut_pool, mem);
+                }
+                else {
+                    *mut_frees.mem.at_if(mut_kept) = mem;
+                    *mut_frees.generations.at_if(mut_kept) = generation;
+                    ++mut_kept;
+                }
+            }
+
+            mut_frees.size = mut_kept;
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives memory that unmap_direct_map() just unmapped back
+        ///     to the provided pool. If another PP might still have a TLB
+        ///     entry for the memory, it is deferred instead, and given back
+        ///     by a later call to release_deferred_frees(). The caller must
+        ///     make sure that there is room for one more deferred free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam POOL_CONCEPT the type of pool to give the memory to
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_pool the pool to give the memory back to
+        ///   @param mut_frees the frees the current PP deferred
+        ///   @param mem the memory to give back
+        ///
+        template<typename POOL_CONCEPT>
+        constexpr void
+        free_direct_map(
+            tls_t &mut_tls,
+            POOL_CONCEPT &mut_pool,
+            ext_deferred_frees_t &mut_frees,
+            bsl::span<page_t> const &mem) noexcept
+        {
+            auto const &rpt{m_direct_map_rpts.front()};
+
+            /// NOTE:
+            /// - The generation is read after the memory was unmapped, so
+            ///   any PP that activates VM 0's direct map at this generation
+            ///   (or later) can no longer reach the memory. If another PP
+            ///   unmaps memory in between, the generation is only larger,
+            ///   which delays the free a little longer, which is safe.
+            ///
+
+            auto const generation{rpt.generation()};
+            if (rpt.is_flushed(mut_tls, generation)) {
+                give_back(mut_tls, mut_pool, mem);
+                return;
+            }
+
+            *mut_frees.mem.at_if(mut_frees.size) = mem;
+            *mut_frees.generations.at_if(mut_frees.size) = generation;
+            ++mut_frees.size;
+        }
+
         /// <!-- description -->
         ///   @brief Executes the extension given an instruction pointer to
         ///     execute the extension at, a stack pointer to execute the
@@ -931,7 +1170,39 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            if (mut_tls.active_rpt != pmut_rpt) {
+            auto *const pmut_flushes_avoided{
+                m_tlb_flushes_avoided.at_if(bsl::to_umax(mut_tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_flushes_avoided)) {
+                bsl::error() << "invalid ppid "           // --
+                             << bsl::hex(mut_tls.ppid)    // --
+                             << bsl::endl                 // --
+                             << bsl::here();              // --
+
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - If the RPT is stale, memory was unmapped from it since this
+            ///   PP last activated it, and activating it again flushes the
+            ///   TLB entries associated with it, which is how a PP picks up
+            ///   memory that another PP unmapped from this extension (see
+            ///   unmap_direct_map for details).
+            /// - When PCIDs are enabled, activating an RPT that is not stale
+            ///   keeps the TLB entries tagged with its PCID, and a full TLB
+            ///   flush is avoided.
+            ///
+
+            bool const stale{pmut_rpt->is_stale(mut_tls)};
+            if (mut_tls.active_rpt != pmut_rpt || stale) {
+                constexpr auto disabled{0_umax};
+
+                if (disabled == mut_tls.pcid_enabled || stale) {
+                    bsl::touch();
+                }
+                else {
+                    ++*pmut_flushes_avoided;
+                }
+
                 if (bsl::unlikely_assert(!pmut_rpt->activate(mut_tls, mut_intrinsic))) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
@@ -951,7 +1222,16 @@ namespace mk
                 bsl::touch();
             }
 
+            /// NOTE:
+            /// - The VMExit handler does not return here when the extension
+            ///   runs a VPS, so an EXT_CALL is not always followed by an
+            ///   EXT_RETURN in the trace ring.
+            ///
+
+            trace_ring_write(mut_tls, loader::TRACE_EVENT_EXT_CALL, bsl::to_umax(m_id), ip);
             bsl::exit_code const ret{call_ext(ip.get(), mut_tls.sp, arg0.get(), arg1.get())};
+            trace_ring_write(mut_tls, loader::TRACE_EVENT_EXT_RETURN, bsl::to_umax(m_id), ip);
+
             if (bsl::unlikely(bsl::exit_success != ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -1039,6 +1319,22 @@ namespace mk
             m_bootstrap_ip = bsl::safe_uintmax::failure();
             m_entry_ip = bsl::safe_uintmax::failure();
 
+            /// NOTE:
+            /// - An ext_t is only released when the microkernel fails to
+            ///   start, at which point no PP is running the extension, so
+            ///   any page that is still deferred can be given back. The
+            ///   huge pool is not given to release(), but the extension
+            ///   never had a chance to free huge memory by then.
+            ///
+
+            for (auto const frees : m_deferred_pages) {
+                for (bsl::safe_uintmax mut_i{}; mut_i < frees.data->size; ++mut_i) {
+                    give_back(mut_tls, mut_page_pool, *frees.data->mem.at_if(mut_i));
+                }
+
+                frees.data->size = {};
+            }
+
             for (auto const rpt : m_direct_map_rpts) {
                 rpt.data->release(mut_tls, mut_page_pool);
             }
@@ -1228,6 +1524,14 @@ namespace mk
                 return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
             }
 
+            auto *const pmut_frees{get_deferred_frees(mut_tls, m_deferred_pages)};
+            if (bsl::unlikely_assert(nullptr == pmut_frees)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
+            }
+
+            this->release_deferred_frees(mut_tls, mut_page_pool, *pmut_frees);
+
             auto const *const page{
                 mut_page_pool.allocate<page_t>(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE)};
             if (bsl::unlikely(nullptr == page)) {
@@ -1258,8 +1562,18 @@ namespace mk
             ///   that is not #0 will result in a page fault, and the page
             ///   handler will direct map the address into that VM as it
             ///   would any other physical address.
+            /// - The page might already be mapped into VM 0's direct map if
+            ///   it was part of a fault around window (or bf_mem_op_map_direct)
+            ///   while it was free, so any such mapping is reclaimed first.
             ///
 
+            auto const reclaimed{m_direct_map_rpts.front().reclaim_pages(
+                mut_tls, mut_page_pool, page_virt, HYPERVISOR_PAGE_SIZE)};
+            if (bsl::unlikely(!reclaimed)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
+            }
+
             auto const ret{m_direct_map_rpts.front().map_page(
                 mut_tls,
                 mut_page_pool,
@@ -1281,17 +1595,181 @@ namespace mk
         ///     address space.
         ///
         /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_intrinsic the intrinsic_t to use
         ///   @param page_virt the virtual address to free
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
-        [[nodiscard]] static constexpr auto
-        free_page(bsl::safe_uintmax const &page_virt) noexcept -> bsl::errc_type
+        [[nodiscard]] constexpr auto
+        free_page(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            intrinsic_t &mut_intrinsic,
+            bsl::safe_uintmax const &page_virt) noexcept -> bsl::errc_type
         {
-            bsl::discard(page_virt);
+            if (bsl::unlikely_assert(!m_id)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(page_virt.is_zero_or_invalid())) {
+                bsl::error() << "invalid virtual address "    // --
+                             << bsl::hex(page_virt)           // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(page_virt < HYPERVISOR_EXT_PAGE_POOL_ADDR)) {
+                bsl::error() << "invalid virtual address "    // --
+                             << bsl::hex(page_virt)           // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!(page_virt % HYPERVISOR_PAGE_SIZE).is_zero())) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(page_virt)                       // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
 
-            bsl::error() << "free_page is currently unsupported\n" << bsl::here();
-            return bsl::errc_failure;
+                return bsl::errc_failure;
+            }
+
+            auto *const pmut_frees{get_deferred_frees(mut_tls, m_deferred_pages)};
+            if (bsl::unlikely_assert(nullptr == pmut_frees)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - Freeing a page is optional. If this PP already has too
+            ///   many pages waiting for the other PPs to flush their TLB,
+            ///   the page is left mapped and the free fails, and the
+            ///   extension can try again later.
+            ///
+
+            this->release_deferred_frees(mut_tls, mut_page_pool, *pmut_frees);
+            if (bsl::unlikely(!(pmut_frees->size < EXT_MAX_DEFERRED_FREES))) {
+                bsl::error() << "too many freed pages are waiting on other PPs\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - alloc_page is the only function that maps memory using
+            ///   MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE, so if the unmap succeeds,
+            ///   the page was allocated by this extension using alloc_page
+            ///   and it is safe to give it back to the page pool. If the
+            ///   unmap fails, the extension is attempting to free memory it
+            ///   does not own (or memory that was already freed), and
+            ///   nothing is released.
+            /// - Just like free_huge, the page is unmapped before it is given
+            ///   back to the page pool, which ensures that the page is never
+            ///   mapped when another PP allocates it. The page is only given
+            ///   back once no other PP can reach it through a stale TLB
+            ///   entry (see free_direct_map).
+            ///
+
+            constexpr auto pages{1_umax};
+            auto const ret{this->unmap_direct_map(
+                mut_tls,
+                mut_page_pool,
+                mut_intrinsic,
+                page_virt,
+                pages,
+                MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE)};
+
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            auto const page_phys{page_virt - HYPERVISOR_EXT_PAGE_POOL_ADDR};
+            auto *const pmut_page{mut_page_pool.phys_to_virt<page_t>(page_phys)};
+
+            this->free_direct_map(mut_tls, mut_page_pool, *pmut_frees, {pmut_page, pages});
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the microkernel's view of a page that was
+        ///     allocated by this extension using alloc_page, given the
+        ///     virtual address the extension uses to access the page. This
+        ///     allows syscalls to exchange more than a few registers worth
+        ///     of data with an extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the extension's virtual address of the page
+        ///   @return Returns a pointer to the page on success, or a nullptr
+        ///     if the page was not allocated by this extension.
+        ///
+        [[nodiscard]] constexpr auto
+        lookup_page(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &page_virt) noexcept -> page_t *
+        {
+            if (bsl::unlikely_assert(!m_id)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return nullptr;
+            }
+
+            if (bsl::unlikely(page_virt.is_zero_or_invalid())) {
+                bsl::error() << "invalid virtual address "    // --
+                             << bsl::hex(page_virt)           // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return nullptr;
+            }
+
+            if (bsl::unlikely(page_virt < HYPERVISOR_EXT_PAGE_POOL_ADDR)) {
+                bsl::error() << "invalid virtual address "    // --
+                             << bsl::hex(page_virt)           // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return nullptr;
+            }
+
+            if (bsl::unlikely(!(page_virt % HYPERVISOR_PAGE_SIZE).is_zero())) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(page_virt)                       // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return nullptr;
+            }
+
+            /// NOTE:
+            /// - Just like free_page, the auto release tag is what proves
+            ///   that the page was allocated using alloc_page. Without this
+            ///   check, an extension could hand the microkernel the address
+            ///   of any page in the page pool (including page tables).
+            ///
+
+            bool const owned{m_direct_map_rpts.front().is_mapped_with(
+                mut_tls, page_pool, page_virt, MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE)};
+            if (bsl::unlikely(!owned)) {
+                bsl::error() << "virtual address "                    // --
+                             << bsl::hex(page_virt)                   // --
+                             << " was not allocated by extension "    // --
+                             << bsl::hex(m_id)                        // --
+                             << bsl::endl                             // --
+                             << bsl::here();                          // --
+
+                return nullptr;
+            }
+
+            auto const page_phys{page_virt - HYPERVISOR_EXT_PAGE_POOL_ADDR};
+            return page_pool.phys_to_virt<page_t>(page_phys);
         }
 
         /// <!-- description -->
@@ -1319,13 +1797,21 @@ namespace mk
                 return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
             }
 
+            auto *const pmut_frees{get_deferred_frees(mut_tls, m_deferred_huge)};
+            if (bsl::unlikely_assert(nullptr == pmut_frees)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
+            }
+
+            this->release_deferred_frees(mut_tls, mut_huge_pool, *pmut_frees);
+
             auto const [bytes, pages]{size_to_page_aligned_bytes(size)};
             if (bsl::unlikely(!pages)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
             }
 
-            auto const huge{mut_huge_pool.allocate(mut_tls, bytes)};
+            auto const huge{mut_huge_pool.allocate(mut_tls, pages)};
             if (bsl::unlikely(!huge)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
@@ -1354,23 +1840,33 @@ namespace mk
             ///   that is not #0 will result in a page fault, and the page
             ///   handler will direct map the address into that VM as it
             ///   would any other physical address.
+            /// - The block is physically contiguous and the direct map keeps
+            ///   the virtual and physical addresses congruent, so map_pages
+            ///   is able to use 2M pages for any 2M aligned part of the
+            ///   block, which saves both page tables and TLB entries.
+            /// - Like alloc_page, any part of the block that was mapped
+            ///   into VM 0's direct map while it was free is reclaimed first.
             ///
 
-            for (bsl::safe_uintmax mut_i{}; mut_i < pages; ++mut_i) {
-                auto const ret{m_direct_map_rpts.front().map_page(
-                    mut_tls,
-                    mut_page_pool,
-                    huge_virt + mut_i,
-                    huge_phys + mut_i,
-                    MAP_PAGE_READ | MAP_PAGE_WRITE,
-                    MAP_PAGE_NO_AUTO_RELEASE)};
+            auto const reclaimed{m_direct_map_rpts.front().reclaim_pages(
+                mut_tls, mut_page_pool, huge_virt, bytes)};
+            if (bsl::unlikely(!reclaimed)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
+            }
 
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
-                }
+            auto const ret{m_direct_map_rpts.front().map_pages(
+                mut_tls,
+                mut_page_pool,
+                huge_virt,
+                huge_phys,
+                bytes,
+                MAP_PAGE_READ | MAP_PAGE_WRITE,
+                MAP_PAGE_NO_AUTO_RELEASE)};
 
-                bsl::touch();
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::failure(), bsl::safe_uintmax::failure()};
             }
 
             return {huge_virt, huge_phys};
@@ -1381,17 +1877,97 @@ namespace mk
         ///     mapped it into the extension's address space.
         ///
         /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_huge_pool the huge_pool_t to use
+        ///   @param mut_intrinsic the intrinsic_t to use
         ///   @param huge_virt the virtual address to free
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
-        [[nodiscard]] static constexpr auto
-        free_huge(bsl::safe_uintmax const &huge_virt) noexcept -> bsl::errc_type
+        [[nodiscard]] constexpr auto
+        free_huge(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            huge_pool_t &mut_huge_pool,
+            intrinsic_t &mut_intrinsic,
+            bsl::safe_uintmax const &huge_virt) noexcept -> bsl::errc_type
         {
-            bsl::discard(huge_virt);
+            if (bsl::unlikely_assert(!m_id)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(huge_virt.is_zero_or_invalid())) {
+                bsl::error() << "invalid virtual address "    // --
+                             << bsl::hex(huge_virt)           // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(huge_virt < HYPERVISOR_EXT_PAGE_POOL_ADDR)) {
+                bsl::error() << "invalid virtual address "    // --
+                             << bsl::hex(huge_virt)           // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!(huge_virt % HYPERVISOR_PAGE_SIZE).is_zero())) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(huge_virt)                       // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            auto *const pmut_frees{get_deferred_frees(mut_tls, m_deferred_huge)};
+            if (bsl::unlikely_assert(nullptr == pmut_frees)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            this->release_deferred_frees(mut_tls, mut_huge_pool, *pmut_frees);
+            if (bsl::unlikely(!(pmut_frees->size < EXT_MAX_DEFERRED_FREES))) {
+                bsl::error() << "too many freed blocks are waiting on other PPs\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto const huge_phys{huge_virt - HYPERVISOR_EXT_PAGE_POOL_ADDR};
+            auto const huge{
+                mut_huge_pool.lookup(mut_tls, mut_huge_pool.phys_to_virt<page_t>(huge_phys))};
+            if (bsl::unlikely(huge.empty())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - The memory has to be unmapped before it is given back to
+            ///   the huge pool. Otherwise, another PP could allocate the same
+            ///   block and fail to map it because it is still mapped here.
+            ///   If the block is not mapped into VM 0's direct map, it was
+            ///   not given to this extension, and the free fails.
+            ///
 
-            bsl::error() << "free_huge is currently unsupported\n" << bsl::here();
-            return bsl::errc_failure;
+            auto const ret{this->unmap_direct_map(
+                mut_tls,
+                page_pool,
+                mut_intrinsic,
+                huge_virt,
+                huge.size(),
+                MAP_PAGE_NO_AUTO_RELEASE)};
+
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            this->free_direct_map(mut_tls, mut_huge_pool, *pmut_frees, huge);
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
@@ -1475,8 +2051,14 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Maps a page into the direct map portion of the current
-        ///     direct map root page table that is active.
+        ///   @brief Maps the memory around the provided virtual address into
+        ///     the direct map portion of the current direct map root page
+        ///     table that is active. Instead of mapping a single page, the
+        ///     HYPERVISOR_EXT_FAULT_AROUND_SIZE aligned window that contains
+        ///     the provided address is mapped, so that an extension that
+        ///     scans memory sequentially only takes one page fault per
+        ///     window. Any part of the window that is already mapped is
+        ///     left as is.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
@@ -1492,6 +2074,8 @@ namespace mk
         {
             constexpr auto dm_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
             constexpr auto dm_size{HYPERVISOR_EXT_DIRECT_MAP_SIZE};
+            constexpr auto window{HYPERVISOR_EXT_FAULT_AROUND_SIZE};
+            constexpr auto one{1_umax};
 
             if (bsl::unlikely(page_virt < dm_addr)) {
                 return bsl::errc_failure;
@@ -1501,6 +2085,110 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            auto *const pmut_faults{m_direct_map_faults.at_if(bsl::to_umax(mut_tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_faults)) {
+                bsl::error() << "invalid ppid "           // --
+                             << bsl::hex(mut_tls.ppid)    // --
+                             << bsl::endl                 // --
+                             << bsl::here();              // --
+
+                return bsl::errc_failure;
+            }
+
+            ++*pmut_faults;
+
+            /// NOTE:
+            /// - The window is clamped to the direct map so that it only
+            ///   ever covers addresses that belong to the direct map.
+            ///
+
+            auto mut_window_virt{page_virt - (page_virt & (window - one))};
+            if (mut_window_virt < dm_addr) {
+                mut_window_virt = dm_addr;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto mut_window_size{window};
+            if (mut_window_virt + mut_window_size > dm_addr + dm_size) {
+                mut_window_size = (dm_addr + dm_size) - mut_window_virt;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const ret{this->map_direct(
+                mut_tls, mut_page_pool, mut_window_virt - dm_addr, mut_window_size)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a range of physical memory into the direct map
+        ///     portion of the current direct map root page table that is
+        ///     active. This allows an extension to pre-populate the direct
+        ///     map instead of taking a page fault for each page it touches.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param phys the page aligned physical address to map
+        ///   @param bytes the total number of bytes to map (must be page
+        ///     aligned)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_direct(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &bytes) noexcept -> bsl::errc_type
+        {
+            constexpr auto dm_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+            constexpr auto dm_size{HYPERVISOR_EXT_DIRECT_MAP_SIZE};
+
+            if (bsl::unlikely_assert(!m_id)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!phys)) {
+                bsl::error() << "invalid physical address "    // --
+                             << bsl::hex(phys)                 // --
+                             << bsl::endl                      // --
+                             << bsl::here();                   // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(bytes.is_zero_or_invalid())) {
+                bsl::error() << "invalid number of bytes "    // --
+                             << bsl::hex(bytes)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            auto const end{phys + bytes};
+            if (bsl::unlikely(!end || end > dm_size)) {
+                bsl::error() << "physical address range "       // --
+                             << bsl::hex(phys)                  // --
+                             << " + "                           // --
+                             << bsl::hex(bytes)                 // --
+                             << " is outside the direct map"    // --
+                             << bsl::endl                       // --
+                             << bsl::here();                    // --
+
+                return bsl::errc_failure;
+            }
+
             auto *const pmut_direct_map_rpt{
                 m_direct_map_rpts.at_if(bsl::to_umax(mut_tls.active_vmid))};
             if (bsl::unlikely(nullptr == pmut_direct_map_rpt)) {
@@ -1512,17 +2200,25 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            auto const ret{pmut_direct_map_rpt->map_page_unaligned(
+            /// NOTE:
+            /// - The direct map of VM 0 is also used by alloc_page and
+            ///   alloc_huge, which map their pages into the direct map
+            ///   using 4k pages that are released when they are freed.
+            ///   If a 2M page were used here, these mappings would
+            ///   collide, so VM 0 only uses 4k pages.
+            /// - Alignment is checked by the root page table.
+            ///
+
+            bool const use_2m{syscall::BF_ROOT_VMID != bsl::to_u16(mut_tls.active_vmid)};
+
+            auto const ret{pmut_direct_map_rpt->populate_pages(
                 mut_tls,
                 mut_page_pool,
-                page_virt,
-                page_virt - dm_addr,
+                dm_addr + phys,
+                phys,
+                bytes,
                 MAP_PAGE_READ | MAP_PAGE_WRITE,
-                MAP_PAGE_NO_AUTO_RELEASE)};
-
-            if (ret == bsl::errc_already_exists) {
-                return bsl::errc_success;
-            }
+                use_2m)};
 
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
@@ -1565,13 +2261,29 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            auto const ret{this->initialize_direct_map_rpt(mut_tls, mut_page_pool, *pmut_rpt)};
-            if (bsl::unlikely(!ret)) {
+            /// NOTE:
+            /// - Each direct map RPT gets its own PCID. PCID 0 is used by
+            ///   the microkernel's system RPT, which is why the first PCID
+            ///   that is handed out is 1.
+            ///
+
+            constexpr auto first_pcid{1_umax};
+            auto const pcid{
+                first_pcid + (bsl::to_umax(m_id) * HYPERVISOR_MAX_VMS) + bsl::to_umax(vmid)};
+
+            auto mut_ret{pmut_rpt->set_pcid(pcid)};
+            if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
-                return ret;
+                return mut_ret;
             }
 
-            return ret;
+            mut_ret = this->initialize_direct_map_rpt(mut_tls, mut_page_pool, *pmut_rpt);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            return mut_ret;
         }
 
         /// <!-- description -->
@@ -1607,6 +2319,13 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            /// NOTE:
+            /// - The PCID of this RPT will be used again the next time a
+            ///   VM with the same ID is created. Releasing the RPT makes it
+            ///   stale on every PP that used it, so those PPs flush the TLB
+            ///   entries tagged with this PCID before they use it again.
+            ///
+
             pmut_rpt->release(mut_tls, mut_page_pool);
             return bsl::errc_success;
         }
@@ -1874,6 +2593,46 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            /// Flushes Saved
+            ///
+
+            bsl::safe_uintmax mut_flushes_avoided{};
+            for (auto const elem : m_tlb_flushes_avoided) {
+                mut_flushes_avoided += *elem.data;
+            }
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "flushes saved "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"18d", mut_flushes_avoided} << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Direct Map Faults
+            ///
+
+            bsl::safe_uintmax mut_direct_map_faults{};
+            for (auto const elem : m_direct_map_faults) {
+                mut_direct_map_faults += *elem.data;
+            }
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "dm faults "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"18d", mut_direct_map_faults} << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Fault Around Window
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "fault window "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::hex(HYPERVISOR_EXT_FAULT_AROUND_SIZE) << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
             /// Footer
             ///
 
@@ -25,21 +25,58 @@
 #ifndef HUGE_POOL_T_HPP
 #define HUGE_POOL_T_HPP
 
+#include <clear_pages.hpp>
+#include <huge_pool_block_t.hpp>
 #include <lock_guard_t.hpp>
+#include <lock_tags.hpp>
 #include <page_t.hpp>
-#include <spinlock_t.hpp>
+#include <ticketlock_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstring.hpp>
 #include <bsl/debug.hpp>
-#include <bsl/discard.hpp>
+#include <bsl/is_constant_evaluated.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
+#include <bsl/unlikely_assert.hpp>
 
 namespace mk
 {
+    /// @brief stores the max number of pages the huge pool can manage
+    constexpr auto HUGE_POOL_MAX_PAGES{HYPERVISOR_MK_HUGE_POOL_SIZE / HYPERVISOR_PAGE_SIZE};
+
+    /// <!-- description -->
+    ///   @brief Returns the number of orders that are needed to describe
+    ///     a huge pool with the provided number of pages. A block of
+    ///     order N is 2^N pages in size.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pages the total number of pages in the huge pool
+    ///   @return Returns the number of orders that are needed to describe
+    ///     a huge pool with the provided number of pages.
+    ///
+    [[nodiscard]] constexpr auto
+    huge_pool_orders(bsl::safe_uintmax const &pages) noexcept -> bsl::safe_uintmax
+    {
+        constexpr auto one{1_umax};
+
+        bsl::safe_uintmax mut_orders{};
+        while ((one << mut_orders) <= pages) {
+            ++mut_orders;
+        }
+
+        return mut_orders;
+    }
+
+    /// @brief stores the max number of orders the huge pool supports
+    constexpr auto HUGE_POOL_MAX_ORDERS{huge_pool_orders(HUGE_POOL_MAX_PAGES)};
+    /// @brief used to mark the end of a huge pool free list
+    constexpr auto HUGE_POOL_NO_BLOCK{HUGE_POOL_MAX_PAGES};
+
     /// @class mk::huge_pool_t
     ///
     /// <!-- description -->
@@ -47,25 +84,201 @@ namespace mk
     ///     memory. The amount of memory that is available is really, really
     ///     small (likely no more than 1 MB), but some is needed for different
     ///     architectures that require it like AMD. This memory is only needed
-    ///     by the extensions, and we currently do not support the ability
-    ///     to free memory, so there is no need to over complicate how this
-    ///     allocator works. We simply use a cursor that is always increasing.
-    ///     Once you allocate all of the memory, that is it.
+    ///     by the extensions. The huge pool is a binary buddy allocator.
+    ///     Every allocation is rounded up to a power of two number of pages,
+    ///     larger free blocks are split in half until a block of the right
+    ///     size is found, and when a block is freed, it is merged with its
+    ///     buddy for as long as the buddy is also free. Both allocate and
+    ///     deallocate are O(log n). The bookkeeping is stored outside of
+    ///     the pool itself so that free memory is never written to.
     ///
     class huge_pool_t final
     {
         /// @brief stores the range of memory used by this allocator
         bsl::span<page_t> m_pool{};
-        /// @brief stores the huge pool's cursor
-        bsl::safe_uintmax m_crsr{};
+        /// @brief stores the bookkeeping for each page in the pool
+        bsl::array<huge_pool_block_t, HUGE_POOL_MAX_PAGES.get()> m_blocks{};
+        /// @brief stores the index of the first free block for each order
+        bsl::array<bsl::safe_uintmax, HUGE_POOL_MAX_ORDERS.get()> m_heads{};
+        /// @brief stores the number of free blocks for each order
+        bsl::array<bsl::safe_uintmax, HUGE_POOL_MAX_ORDERS.get()> m_counts{};
+        /// @brief stores the total number of pages in allocated blocks
+        bsl::safe_uintmax m_used{};
+        /// @brief stores the total number of pages that were asked for
+        bsl::safe_uintmax m_requested{};
+        /// @brief stores the total number of allocations that failed
+        bsl::safe_uintmax m_fails{};
         /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock{};
+        mutable ticketlock_t m_lock{LOCK_TAG_HUGE_POOL};
+
+        /// <!-- description -->
+        ///   @brief Returns the number of pages in a block of the
+        ///     provided order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the order to convert
+        ///   @return Returns the number of pages in a block of the
+        ///     provided order.
+        ///
+        [[nodiscard]] static constexpr auto
+        order_to_pages(bsl::safe_uintmax const &order) noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto one{1_umax};
+            return one << order;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest order that can hold the provided
+        ///     number of pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pages the number of pages to convert
+        ///   @return Returns the smallest order that can hold the provided
+        ///     number of pages.
+        ///
+        [[nodiscard]] static constexpr auto
+        pages_to_order(bsl::safe_uintmax const &pages) noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax mut_order{};
+            while (order_to_pages(mut_order) < pages) {
+                ++mut_order;
+            }
+
+            return mut_order;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds the block at idx to the free list of the provided
+        ///     order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the block to add
+        ///   @param order the order of the block to add
+        ///
+        constexpr void
+        push_free(bsl::safe_uintmax const &idx, bsl::safe_uintmax const &order) noexcept
+        {
+            auto *const pmut_blk{m_blocks.at_if(idx)};
+            auto *const pmut_head{m_heads.at_if(order)};
+
+            pmut_blk->next = *pmut_head;
+            pmut_blk->prev = HUGE_POOL_NO_BLOCK;
+            pmut_blk->order = order;
+            pmut_blk->free = true;
+
+            if (HUGE_POOL_NO_BLOCK != *pmut_head) {
+                m_blocks.at_if(*pmut_head)->prev = idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *pmut_head = idx;
+            ++*m_counts.at_if(order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the block at idx from the free list that it
+        ///     is currently on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the block to remove
+        ///
+        constexpr void
+        remove_free(bsl::safe_uintmax const &idx) noexcept
+        {
+            auto *const pmut_blk{m_blocks.at_if(idx)};
+
+            if (HUGE_POOL_NO_BLOCK != pmut_blk->prev) {
+                m_blocks.at_if(pmut_blk->prev)->next = pmut_blk->next;
+            }
+            else {
+                *m_heads.at_if(pmut_blk->order) = pmut_blk->next;
+            }
+
+            if (HUGE_POOL_NO_BLOCK != pmut_blk->next) {
+                m_blocks.at_if(pmut_blk->next)->prev = pmut_blk->prev;
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_blk->next = HUGE_POOL_NO_BLOCK;
+            pmut_blk->prev = HUGE_POOL_NO_BLOCK;
+            pmut_blk->free = false;
+            --*m_counts.at_if(pmut_blk->order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the allocated block that starts
+        ///     at the provided virtual address. If virt is not the start
+        ///     of an allocated block, bsl::safe_uintmax::failure() is
+        ///     returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param virt the virtual address of the block to look up
+        ///   @return Returns the index of the allocated block that starts
+        ///     at the provided virtual address, or
+        ///     bsl::safe_uintmax::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        index_of(page_t const *const virt) const noexcept -> bsl::safe_uintmax
+        {
+            auto const *const begin{m_pool.data()};
+            if (bsl::unlikely(nullptr == virt || nullptr == begin || virt < begin)) {
+                bsl::error() << "address was not allocated using the huge pool\n" << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            auto const idx{bsl::to_umax(virt - begin)};
+            if (bsl::unlikely(!(idx < m_pool.size()))) {
+                bsl::error() << "address was not allocated using the huge pool\n" << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            if (bsl::unlikely(!m_blocks.at_if(idx)->allocated)) {
+                bsl::error() << "huge pool block "     // --
+                             << bsl::hex(idx)          // --
+                             << " is not allocated"    // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            return idx;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided number of pages as either KB or
+        ///     MB. The output is always 8 characters wide.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pages the number of pages to output
+        ///
+        static constexpr void
+        dump_size(bsl::safe_uintmax const &pages) noexcept
+        {
+            constexpr auto kb{1024_umax};
+            constexpr auto mb{kb * kb};
+
+            auto const bytes{pages * HYPERVISOR_PAGE_SIZE};
+            if ((bytes / mb).is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", bytes / kb} << " KB ";
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", bytes / mb} << " MB ";
+            }
+        }
 
     public:
         /// <!-- description -->
         ///   @brief Creates the huge pool given a mutable_buffer_t to
         ///     the huge pool as well as the virtual address base of the
         ///     huge pool which is used for virt to phys translations.
+        ///     The pool is carved up into the largest naturally aligned
+        ///     blocks that fit, which means that the pool does not need
+        ///     to be a power of two in size.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_pool the mutable_buffer_t of the huge pool
@@ -73,11 +286,58 @@ namespace mk
         constexpr void
         initialize(bsl::span<page_t> &mut_pool) noexcept
         {
-            m_pool = mut_pool;
+            constexpr auto one{1_umax};
+
+            if (bsl::unlikely(mut_pool.size() > HUGE_POOL_MAX_PAGES)) {
+                bsl::alert() << "huge pool truncated to "        // --
+                             << bsl::hex(HUGE_POOL_MAX_PAGES)    // --
+                             << " pages"                         // --
+                             << bsl::endl;                       // --
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_pool = mut_pool.subspan(bsl::safe_uintmax{}, HUGE_POOL_MAX_PAGES);
+
+            for (auto const elem : m_blocks) {
+                *elem.data = {};
+            }
+
+            for (auto const elem : m_heads) {
+                *elem.data = HUGE_POOL_NO_BLOCK;
+            }
+
+            for (auto const elem : m_counts) {
+                *elem.data = {};
+            }
+
+            bsl::safe_uintmax mut_idx{};
+            while (mut_idx < m_pool.size()) {
+                bsl::safe_uintmax mut_order{};
+                while (mut_order + one < HUGE_POOL_MAX_ORDERS) {
+                    auto const pages{order_to_pages(mut_order + one)};
+                    if (!(mut_idx % pages).is_zero() || mut_idx + pages > m_pool.size()) {
+                        break;
+                    }
+
+                    ++mut_order;
+                }
+
+                this->push_free(mut_idx, mut_order);
+                mut_idx += order_to_pages(mut_order);
+            }
+
+            m_used = {};
+            m_requested = {};
+            m_fails = {};
         }
 
         /// <!-- description -->
-        ///   @brief Allocates memory from the huge pool.
+        ///   @brief Allocates memory from the huge pool. The allocation is
+        ///     taken from a block that is the next power of two number of
+        ///     pages in size, but the resulting bsl::span only contains the
+        ///     number of pages that were asked for.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
@@ -98,20 +358,93 @@ namespace mk
                 return {};
             }
 
-            auto mut_buf{m_pool.subspan(m_crsr, pages)};
-            if (bsl::unlikely(mut_buf.size() != pages)) {
+            if (bsl::unlikely(pages > m_pool.size())) {
+                ++m_fails;
+                bsl::error() << "huge pool out of memory\n" << bsl::here();
+                return {};
+            }
+
+            auto const order{pages_to_order(pages)};
+
+            auto mut_found{order};
+            while (mut_found < HUGE_POOL_MAX_ORDERS) {
+                if (HUGE_POOL_NO_BLOCK != *m_heads.at_if(mut_found)) {
+                    break;
+                }
+
+                ++mut_found;
+            }
+
+            if (bsl::unlikely(!(mut_found < HUGE_POOL_MAX_ORDERS))) {
+                ++m_fails;
                 bsl::error() << "huge pool out of memory\n" << bsl::here();
                 return {};
             }
 
-            m_crsr += pages;
-            bsl::builtin_memset(mut_buf.data(), '\0', mut_buf.size_bytes());
+            auto const idx{*m_heads.at_if(mut_found)};
+            this->remove_free(idx);
+
+            /// NOTE:
+            /// - If the free block that was found is larger than what is
+            ///   needed, it is split in half until it is the right size.
+            ///   The upper half of each split goes back onto the free list
+            ///   of the order below it.
+            ///
+
+            while (mut_found > order) {
+                --mut_found;
+                this->push_free(idx + order_to_pages(mut_found), mut_found);
+            }
+
+            auto *const pmut_blk{m_blocks.at_if(idx)};
+            pmut_blk->order = order;
+            pmut_blk->pages = pages;
+            pmut_blk->allocated = true;
 
-            return mut_buf;
+            m_used += order_to_pages(order);
+            m_requested += pages;
+
+            /// NOTE:
+            /// - The loader zeros the entire huge pool before the microkernel
+            ///   is started, and deallocate() zeros a block before it is
+            ///   given back to the free lists, which means that every page
+            ///   handed out here is already zero.
+            ///
+
+            return m_pool.subspan(idx, pages);
         }
 
         /// <!-- description -->
-        ///   @brief Not supported
+        ///   @brief Returns the bsl::span that allocate() returned for the
+        ///     allocation that starts at the provided virtual address. If
+        ///     virt is not the start of an allocation, an empty bsl::span
+        ///     is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param virt the virtual address of the allocation to look up
+        ///   @return Returns the bsl::span that allocate() returned for the
+        ///     allocation that starts at the provided virtual address, or
+        ///     an empty bsl::span on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        lookup(tls_t &mut_tls, page_t const *const virt) const noexcept -> bsl::span<page_t>
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            auto const idx{this->index_of(virt)};
+            if (bsl::unlikely(!idx)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {};
+            }
+
+            return m_pool.subspan(idx, m_blocks.at_if(idx)->pages);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns memory that was allocated using allocate() back
+        ///     to the huge pool. The block is zeroed and then merged with
+        ///     its buddy for as long as the buddy is also free.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
@@ -120,26 +453,129 @@ namespace mk
         constexpr void
         deallocate(tls_t &mut_tls, bsl::span<page_t> const &buf) noexcept
         {
+            constexpr auto one{1_umax};
             lock_guard_t mut_lock{mut_tls, m_lock};
-            bsl::discard(buf);
+
+            if (buf.empty()) {
+                return;
+            }
+
+            auto mut_idx{this->index_of(buf.data())};
+            if (bsl::unlikely(!mut_idx)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return;
+            }
+
+            auto *const pmut_blk{m_blocks.at_if(mut_idx)};
+            auto mut_order{pmut_blk->order};
+            auto const pages{order_to_pages(mut_order)};
 
             /// NOTE:
-            /// - If this function is implemented, we will have to deal with
-            ///   deallocations being a page in size. Specifically, right now
-            ///   a huge page is allocated and mapped into the page tables
-            ///   one page at a time. When is is time to deallocate, this
-            ///   memory is released one page at a time. If the page tables
-            ///   are deallocating one page of a larger physically contiguous
-            ///   memory region, it should be assumed that the entire region
-            ///   will be freed, it will just happen in page increments.
-            /// - What this means is this function could see a free for the
-            ///   same physically contiguous block of memory (one for each
-            ///   page in the block). We could ignore the extras, or we
-            ///   could set up the allocator so that it frees one page at a
-            ///   time. Just depends on how we want to do this... but in
-            ///   general, I would suggest using the later as a buddy allocator
-            ///   can support this without any added overhead.
+            /// - The entire block is zeroed, not just the pages that were
+            ///   asked for, so that allocate() can hand out any block
+            ///   without having to zero it. This happens while the lock is
+            ///   held, but the huge pool is small, and frees are rare.
             ///
+
+            if (bsl::is_constant_evaluated()) {
+                bsl::builtin_memset(
+                    m_pool.subspan(mut_idx, pages).data(), '\0', pages * HYPERVISOR_PAGE_SIZE);
+            }
+            else {
+                clear_pages(m_pool.subspan(mut_idx, pages).data(), pages.get());
+            }
+
+            m_used -= pages;
+            m_requested -= pmut_blk->pages;
+
+            pmut_blk->pages = {};
+            pmut_blk->allocated = false;
+
+            while (mut_order + one < HUGE_POOL_MAX_ORDERS) {
+                auto const buddy{mut_idx ^ order_to_pages(mut_order)};
+                if (!(buddy < m_pool.size())) {
+                    break;
+                }
+
+                auto const *const blk{m_blocks.at_if(buddy)};
+                if (!blk->free || blk->order != mut_order) {
+                    break;
+                }
+
+                this->remove_free(buddy);
+
+                if (buddy < mut_idx) {
+                    mut_idx = buddy;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                ++mut_order;
+            }
+
+            this->push_free(mut_idx, mut_order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of pages in the huge pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of pages in the huge pool.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_uintmax
+        {
+            return m_pool.size();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of pages that are in use.
+        ///     This includes the pages that were lost to rounding each
+        ///     allocation up to a power of two.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of pages that are in use.
+        ///
+        [[nodiscard]] constexpr auto
+        used() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_used;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of pages in the largest free block.
+        ///     This is the largest allocation that can currently succeed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of pages in the largest free block.
+        ///
+        [[nodiscard]] constexpr auto
+        largest_free() const noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax mut_largest{};
+            for (auto const elem : m_counts) {
+                if (!elem.data->is_zero()) {
+                    mut_largest = order_to_pages(elem.index);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return mut_largest;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of allocations that failed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of allocations that failed.
+        ///
+        [[nodiscard]] constexpr auto
+        failures() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_fails;
         }
 
         /// <!-- description -->
@@ -193,13 +629,12 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Dumps the page_pool_t
+        ///   @brief Dumps the huge_pool_t
         ///
         constexpr void
         dump() const noexcept
         {
-            constexpr auto kb{1024_umax};
-            constexpr auto mb{kb * kb};
+            constexpr auto percent{100_umax};
 
             bsl::print() << bsl::mag << "huge pool dump: ";
             bsl::print() << bsl::rst << bsl::endl;
@@ -226,12 +661,7 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<12s", "total "};
             bsl::print() << bsl::ylw << "| ";
-            if ((m_pool.size() / mb).is_zero()) {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", m_pool.size() / kb} << " KB ";
-            }
-            else {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", m_pool.size() / mb} << " MB ";
-            }
+            dump_size(m_pool.size());
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
@@ -241,30 +671,106 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<12s", "used "};
             bsl::print() << bsl::ylw << "| ";
-            if ((m_crsr / mb).is_zero()) {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", m_crsr / kb} << " KB ";
-            }
-            else {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", m_crsr / mb} << " MB ";
-            }
+            dump_size(m_used);
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Wasted (internal fragmentation)
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<12s", "wasted "};
+            bsl::print() << bsl::ylw << "| ";
+            dump_size(m_used - m_requested);
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
             /// Remaining
             ///
 
+            auto const remaining{m_pool.size() - m_used};
+
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<12s", "remaining "};
             bsl::print() << bsl::ylw << "| ";
-            if (((m_pool.size() - m_crsr) / mb).is_zero()) {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", (m_pool.size() - m_crsr) / kb} << " KB ";
+            dump_size(remaining);
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Largest Free Block
+            ///
+
+            auto const largest{this->largest_free()};
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<12s", "largest "};
+            bsl::print() << bsl::ylw << "| ";
+            dump_size(largest);
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Fragmentation (external)
+            ///
+            /// NOTE:
+            /// - This is the percentage of the remaining memory that cannot
+            ///   be handed out as a single allocation. 0% means that all
+            ///   of the remaining memory is in a single free block.
+            ///
+
+            bsl::safe_uintmax mut_frag{};
+            if (!remaining.is_zero()) {
+                mut_frag = percent - ((largest * percent) / remaining);
             }
             else {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", (m_pool.size() - m_crsr) / mb} << " MB ";
+                bsl::touch();
             }
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<12s", "fragmented "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"4d", mut_frag} << " %  ";
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Failures
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<12s", "failures "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"8d", m_fails};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Free Blocks Header
+            ///
+
+            bsl::print() << bsl::ylw << "+-----------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^12s", "block size "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^8s", "free "};
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            bsl::print() << bsl::ylw << "+-----------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Free Blocks
+            ///
+
+            for (auto const elem : m_counts) {
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << "    ";
+                dump_size(order_to_pages(elem.index));
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"8d", *elem.data};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
             /// Footer
             ///
 
@@ -0,0 +1,309 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef ID_BITMAP_T_HPP
+#define ID_BITMAP_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/is_constant_evaluated.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely_assert.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of IDs that are stored in each word
+    constexpr auto ID_BITMAP_BITS_PER_WORD{64_umax};
+    /// @brief defines a word with all of its IDs taken
+    constexpr auto ID_BITMAP_WORD_FULL{0xFFFFFFFFFFFFFFFF_u64};
+
+    /// @class mk::id_bitmap_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a set of IDs as a bitmap, where a set bit means that
+    ///     the ID is taken. Every operation is a single atomic operation on
+    ///     the word that stores the ID, so IDs can be allocated, freed and
+    ///     queried from any PP without a lock. Allocating an ID and finding
+    ///     the first ID that is taken only need to look at one word per 64
+    ///     IDs instead of at every object in a pool.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the total number of IDs stored in the bitmap
+    ///
+    template<bsl::uintmax N>
+    class id_bitmap_t final
+    {
+        /// @brief stores the total number of IDs in the bitmap
+        static constexpr bsl::safe_uintmax IDS{N};
+        /// @brief stores the total number of words in the bitmap
+        static constexpr auto WORDS{
+            (IDS + ID_BITMAP_BITS_PER_WORD - 1_umax) / ID_BITMAP_BITS_PER_WORD};
+
+        /// @brief stores the bitmap itself
+        bsl::array<bsl::uint64, WORDS.get()> m_words{};
+
+        /// <!-- description -->
+        ///   @brief Returns the bit in its word that stores the provided ID
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to get the bit for
+        ///   @return Returns the bit in its word that stores the provided ID
+        ///
+        [[nodiscard]] static constexpr auto
+        mask(bsl::safe_uintmax const &id) noexcept -> bsl::uint64
+        {
+            return (1_u64 << bsl::to_u64(id % ID_BITMAP_BITS_PER_WORD)).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the word that stores the provided ID, or a
+        ///     nullptr if the ID is out of range.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to get the word for
+        ///   @return Returns the word that stores the provided ID, or a
+        ///     nullptr if the ID is out of range.
+        ///
+        [[nodiscard]] constexpr auto
+        word(bsl::safe_uintmax const &id) noexcept -> bsl::uint64 *
+        {
+            if (bsl::unlikely_assert(id >= IDS)) {
+                bsl::error() << "id "                               // --
+                             << bsl::hex(id)                        // --
+                             << " is out of range of the bitmap"    // --
+                             << bsl::endl                           // --
+                             << bsl::here();                        // --
+
+                return nullptr;
+            }
+
+            return m_words.at_if(id / ID_BITMAP_BITS_PER_WORD);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the word that stores the provided ID, or a
+        ///     nullptr if the ID is out of range.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to get the word for
+        ///   @return Returns the word that stores the provided ID, or a
+        ///     nullptr if the ID is out of range.
+        ///
+        [[nodiscard]] constexpr auto
+        word(bsl::safe_uintmax const &id) const noexcept -> bsl::uint64 const *
+        {
+            if (bsl::unlikely_assert(id >= IDS)) {
+                bsl::error() << "id "                               // --
+                             << bsl::hex(id)                        // --
+                             << " is out of range of the bitmap"    // --
+                             << bsl::endl                           // --
+                             << bsl::here();                        // --
+
+                return nullptr;
+            }
+
+            return m_words.at_if(id / ID_BITMAP_BITS_PER_WORD);
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically reads the provided word.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param wrd the word to read
+        ///   @return Returns the value of the provided word
+        ///
+        [[nodiscard]] static constexpr auto
+        load(bsl::uint64 const *const wrd) noexcept -> bsl::uint64
+        {
+            if (bsl::is_constant_evaluated()) {
+                return *wrd;
+            }
+
+            return __atomic_load_n(wrd, __ATOMIC_ACQUIRE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the lowest set bit of the provided
+        ///     word. The word cannot be 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param wrd the word to search
+        ///   @return Returns the index of the lowest set bit of the
+        ///     provided word.
+        ///
+        [[nodiscard]] static constexpr auto
+        lowest_set(bsl::uint64 const wrd) noexcept -> bsl::safe_uintmax
+        {
+            return bsl::to_umax(__builtin_ctzll(wrd));
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Takes the lowest ID that is not already taken and
+        ///     returns it. If all of the IDs are taken, this returns
+        ///     bsl::safe_uintmax::failure().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the ID that was taken, or
+        ///     bsl::safe_uintmax::failure() if all of the IDs are taken.
+        ///
+        [[nodiscard]] constexpr auto
+        allocate() noexcept -> bsl::safe_uintmax
+        {
+            for (auto const elem : m_words) {
+                bsl::uint64 mut_word{load(elem.data)};
+
+                /// NOTE:
+                /// - The lowest ID that is free in this word is the lowest
+                ///   bit that is clear. We then attempt to set this bit. If
+                ///   another PP changed the word in the meantime, the
+                ///   compare exchange fails and gives us the word's new
+                ///   value, and we try again with that value until either
+                ///   we take an ID or the word is full.
+                ///
+
+                while (ID_BITMAP_WORD_FULL.get() != mut_word) {
+                    auto const bit{lowest_set(ID_BITMAP_WORD_FULL.get() ^ mut_word)};
+                    auto const id{(elem.index * ID_BITMAP_BITS_PER_WORD) + bit};
+                    if (id >= IDS) {
+                        break;
+                    }
+
+                    bsl::uint64 const desired{mut_word | mask(bit)};
+                    if (bsl::is_constant_evaluated()) {
+                        *elem.data = desired;
+                        return id;
+                    }
+
+                    if (__atomic_compare_exchange_n(
+                            elem.data,
+                            &mut_word,
+                            desired,
+                            false,
+                            __ATOMIC_ACQ_REL,
+                            __ATOMIC_ACQUIRE)) {
+                        return id;
+                    }
+
+                    bsl::touch();
+                }
+            }
+
+            return bsl::safe_uintmax::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the provided ID as taken.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to mark as taken
+        ///
+        constexpr void
+        set(bsl::safe_uintmax const &id) noexcept
+        {
+            auto *const pmut_word{this->word(id)};
+            if (bsl::unlikely_assert(nullptr == pmut_word)) {
+                return;
+            }
+
+            if (bsl::is_constant_evaluated()) {
+                *pmut_word |= mask(id);
+                return;
+            }
+
+            __atomic_fetch_or(pmut_word, mask(id), __ATOMIC_ACQ_REL);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the provided ID as free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to mark as free
+        ///
+        constexpr void
+        clear(bsl::safe_uintmax const &id) noexcept
+        {
+            auto *const pmut_word{this->word(id)};
+            if (bsl::unlikely_assert(nullptr == pmut_word)) {
+                return;
+            }
+
+            bsl::uint64 const keep{ID_BITMAP_WORD_FULL.get() ^ mask(id)};
+            if (bsl::is_constant_evaluated()) {
+                *pmut_word &= keep;
+                return;
+            }
+
+            __atomic_fetch_and(pmut_word, keep, __ATOMIC_ACQ_REL);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided ID is taken, false if the
+        ///     ID is free or out of range.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to query
+        ///   @return Returns true if the provided ID is taken, false if the
+        ///     ID is free or out of range.
+        ///
+        [[nodiscard]] constexpr auto
+        is_set(bsl::safe_uintmax const &id) const noexcept -> bool
+        {
+            auto const *const wrd{this->word(id)};
+            if (bsl::unlikely_assert(nullptr == wrd)) {
+                return false;
+            }
+
+            return 0U != (load(wrd) & mask(id));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lowest ID that is taken, or
+        ///     bsl::safe_uintmax::failure() if all of the IDs are free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the lowest ID that is taken, or
+        ///     bsl::safe_uintmax::failure() if all of the IDs are free.
+        ///
+        [[nodiscard]] constexpr auto
+        first_set() const noexcept -> bsl::safe_uintmax
+        {
+            for (auto const elem : m_words) {
+                bsl::uint64 const wrd{load(elem.data)};
+                if (0U != wrd) {
+                    return (elem.index * ID_BITMAP_BITS_PER_WORD) + lowest_set(wrd);
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::safe_uintmax::failure();
+        }
+    };
+}
+
+#endif
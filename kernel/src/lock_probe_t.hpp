@@ -0,0 +1,224 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef LOCK_PROBE_T_HPP
+#define LOCK_PROBE_T_HPP
+
+#include "lock_stats_t.hpp"
+
+#include <timestamp.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @class mk::lock_probe_t
+    ///
+    /// <!-- description -->
+    ///   @brief Each lock owns a lock_probe_t, which measures how long
+    ///     the lock was waited on and how long it was held for, and adds
+    ///     the results to g_mut_lock_stats using the lock's tag. Locks
+    ///     that are not given a tag are not measured.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam ENABLED true if lock statistics are enabled
+    ///
+    template<bool ENABLED = HYPERVISOR_LOCK_STATS>
+    class lock_probe_t final
+    {
+        /// @brief stores the lock tag of the lock this probe measures
+        bsl::safe_uintmax m_tag;
+        /// @brief stores the timestamp of when the lock was acquired
+        bsl::safe_uintmax m_acquired;
+
+        /// <!-- description -->
+        ///   @brief Returns the number of ticks since the provided
+        ///     timestamp. If the timestamp is in the future (e.g., the
+        ///     timestamps of two PPs are not synchronized), 0 is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param start the timestamp to get the number of ticks since
+        ///   @return Returns the number of ticks since the provided
+        ///     timestamp.
+        ///
+        [[nodiscard]] static constexpr auto
+        elapsed(bsl::safe_uintmax const &start) noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax const now{timestamp()};
+            if (now < start) {
+                return {};
+            }
+
+            return now - start;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a lock_probe_t for a lock that is not named,
+        ///     which is not measured.
+        ///
+        constexpr lock_probe_t() noexcept
+            : m_tag{bsl::safe_uintmax::failure()}, m_acquired{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a lock_probe_t for a lock with the provided
+        ///     lock tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag of the lock this probe measures
+        ///
+        explicit constexpr lock_probe_t(bsl::safe_uintmax const &tag) noexcept
+            : m_tag{tag}, m_acquired{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the timestamp that the wait for the lock
+        ///     starts at, which must be given to acquired() once the
+        ///     lock has been acquired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the timestamp that the wait for the lock
+        ///     starts at.
+        ///
+        [[nodiscard]] constexpr auto
+        start() const noexcept -> bsl::safe_uintmax
+        {
+            if (!m_tag) {
+                return {};
+            }
+
+            return bsl::safe_uintmax{timestamp()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Records that the lock was acquired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param start the timestamp returned by start()
+        ///   @param contended true if the lock had to be waited on
+        ///
+        constexpr void
+        acquired(tls_t const &tls, bsl::safe_uintmax const &start, bool const contended) noexcept
+        {
+            if (!m_tag) {
+                return;
+            }
+
+            g_mut_lock_stats.acquired(tls, m_tag, elapsed(start), contended);
+            m_acquired = bsl::safe_uintmax{timestamp()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Records that the lock is about to be released.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        released(tls_t const &tls) noexcept
+        {
+            if (!m_tag) {
+                return;
+            }
+
+            g_mut_lock_stats.released(tls, m_tag, elapsed(m_acquired));
+        }
+    };
+
+    /// @class mk::lock_probe_t
+    ///
+    /// <!-- description -->
+    ///   @brief When lock statistics are disabled, the lock_probe_t is
+    ///     empty and does nothing, which allows the locks to store it
+    ///     using [[no_unique_address]] so that it costs nothing.
+    ///
+    template<>
+    class lock_probe_t<false> final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a lock_probe_t for a lock that is not named.
+        ///
+        constexpr lock_probe_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a lock_probe_t for a lock with the provided
+        ///     lock tag, which is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag of the lock this probe measures
+        ///
+        explicit constexpr lock_probe_t(bsl::safe_uintmax const &tag) noexcept
+        {
+            bsl::discard(tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns 0
+        ///
+        [[nodiscard]] static constexpr auto
+        start() noexcept -> bsl::safe_uintmax
+        {
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls ignored
+        ///   @param start ignored
+        ///   @param contended ignored
+        ///
+        static constexpr void
+        acquired(tls_t const &tls, bsl::safe_uintmax const &start, bool const contended) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(start);
+            bsl::discard(contended);
+        }
+
+        /// <!-- description -->
+        ///   @brief Does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls ignored
+        ///
+        static constexpr void
+        released(tls_t const &tls) noexcept
+        {
+            bsl::discard(tls);
+        }
+    };
+}
+
+#endif
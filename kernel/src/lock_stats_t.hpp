@@ -0,0 +1,326 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef LOCK_STATS_T_HPP
+#define LOCK_STATS_T_HPP
+
+#include <bf_constants.hpp>
+#include <lock_stats_record_t.hpp>
+#include <lock_tags.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely_assert.hpp>
+
+namespace mk
+{
+    /// @brief stores the number of PPs the lock statistics are stored for
+    constexpr auto LOCK_STATS_MAX_PPS{HYPERVISOR_LOCK_STATS ? HYPERVISOR_MAX_PPS : 1_umax};
+
+    /// @class mk::lock_stats_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the contention statistics of every named lock in
+    ///     the microkernel. Each PP has its own set of records, one per
+    ///     lock tag, and a PP only ever writes to its own records, which
+    ///     means that no atomics or locks are needed to record a lock's
+    ///     statistics (which would defeat the purpose). The records are
+    ///     only summed up when they are dumped.
+    ///
+    /// <!-- notes -->
+    ///   @note When HYPERVISOR_LOCK_STATS is disabled, the locks do not
+    ///     record anything (see lock_probe_t), and this table is reduced
+    ///     to a single PP so that it does not take up any real space.
+    ///
+    class lock_stats_t final
+    {
+        /// @brief stores the records of each lock tag for each PP
+        bsl::array<bsl::array<lock_stats_record_t, LOCK_TAG_MAX.get()>, LOCK_STATS_MAX_PPS.get()>
+            m_rcds{};
+
+        /// <!-- description -->
+        ///   @brief Returns the provided PP's record for the provided
+        ///     lock tag, or a nullptr if either is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param tag the lock tag of the record to get
+        ///   @return Returns the provided PP's record for the provided
+        ///     lock tag, or a nullptr if either is invalid.
+        ///
+        [[nodiscard]] constexpr auto
+        rcd(tls_t const &tls, bsl::safe_uintmax const &tag) noexcept -> lock_stats_record_t *
+        {
+            auto *const pmut_rcds{m_rcds.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_rcds)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return nullptr;
+            }
+
+            auto *const pmut_rcd{pmut_rcds->at_if(tag)};
+            if (bsl::unlikely_assert(nullptr == pmut_rcd)) {
+                bsl::error() << "invalid lock tag "    // --
+                             << bsl::hex(tag)          // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return nullptr;
+            }
+
+            return pmut_rcd;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the provided total divided by the provided
+        ///     count, or 0 if the count is 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param total the total to get the average of
+        ///   @param count the number of samples in total
+        ///   @return Returns the provided total divided by the provided
+        ///     count, or 0 if the count is 0.
+        ///
+        [[nodiscard]] static constexpr auto
+        avg(bsl::safe_uintmax const &total, bsl::safe_uintmax const &count) noexcept
+            -> bsl::safe_uintmax
+        {
+            if (count.is_zero()) {
+                return {};
+            }
+
+            return total / count;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Records that the provided PP acquired the lock with
+        ///     the provided tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param tag the lock tag of the lock that was acquired
+        ///   @param spin the number of ticks spent waiting for the lock
+        ///   @param contended true if the lock had to be waited on
+        ///
+        constexpr void
+        acquired(
+            tls_t const &tls,
+            bsl::safe_uintmax const &tag,
+            bsl::safe_uintmax const &spin,
+            bool const contended) noexcept
+        {
+            auto *const pmut_rcd{this->rcd(tls, tag)};
+            if (bsl::unlikely_assert(nullptr == pmut_rcd)) {
+                return;
+            }
+
+            ++pmut_rcd->acquisitions;
+            if (contended) {
+                ++pmut_rcd->contended;
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_rcd->spin_total += spin;
+            if (spin > pmut_rcd->spin_max) {
+                pmut_rcd->spin_max = spin;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Records that the provided PP released the lock with
+        ///     the provided tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param tag the lock tag of the lock that was released
+        ///   @param hold the number of ticks the lock was held for
+        ///
+        constexpr void
+        released(
+            tls_t const &tls, bsl::safe_uintmax const &tag, bsl::safe_uintmax const &hold) noexcept
+        {
+            auto *const pmut_rcd{this->rcd(tls, tag)};
+            if (bsl::unlikely_assert(nullptr == pmut_rcd)) {
+                return;
+            }
+
+            pmut_rcd->hold_total += hold;
+            if (hold > pmut_rcd->hold_max) {
+                pmut_rcd->hold_max = hold;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the provided lock tag's records combined
+        ///     across all of the PPs. The totals are summed, and the
+        ///     maximums are the largest maximum of any PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag to get the totals for
+        ///   @return Returns the provided lock tag's records combined
+        ///     across all of the PPs.
+        ///
+        [[nodiscard]] constexpr auto
+        totals(bsl::safe_uintmax const &tag) const noexcept -> lock_stats_record_t
+        {
+            lock_stats_record_t mut_totals{};
+            for (auto const elem : m_rcds) {
+                auto const *const rcd{elem.data->at_if(tag)};
+                if (bsl::unlikely_assert(nullptr == rcd)) {
+                    return {};
+                }
+
+                mut_totals.acquisitions += rcd->acquisitions;
+                mut_totals.contended += rcd->contended;
+                mut_totals.spin_total += rcd->spin_total;
+                mut_totals.hold_total += rcd->hold_total;
+
+                if (rcd->spin_max > mut_totals.spin_max) {
+                    mut_totals.spin_max = rcd->spin_max;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (rcd->hold_max > mut_totals.hold_max) {
+                    mut_totals.hold_max = rcd->hold_max;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return mut_totals;
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the lock statistics. All times are in
+        ///     timestamp ticks (i.e., TSC cycles on x64).
+        ///
+        constexpr void
+        dump() const noexcept
+        {
+            bsl::print() << bsl::mag << "lock stats dump: ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            if constexpr (!HYPERVISOR_LOCK_STATS) {
+                bsl::print() << bsl::ylw << "  lock stats are disabled (see HYPERVISOR_LOCK_STATS)";
+                bsl::print() << bsl::rst << bsl::endl;
+
+                return;
+            }
+
+            /// Header
+            ///
+
+            bsl::print() << bsl::ylw << "+---------------------------------------------";
+            bsl::print() << bsl::ylw << "---------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^17s", "lock "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "acquires "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "contended "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "avg spin "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "max spin "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "avg hold "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "max hold "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+---------------------------------------------";
+            bsl::print() << bsl::ylw << "---------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Locks
+            ///
+
+            for (bsl::safe_uintmax mut_i{}; mut_i < LOCK_TAG_MAX; ++mut_i) {
+                auto const totals{this->totals(mut_i)};
+                if (totals.acquisitions.is_zero()) {
+                    continue;
+                }
+
+                auto const avg_spin{avg(totals.spin_total, totals.acquisitions)};
+                auto const avg_hold{avg(totals.hold_total, totals.acquisitions)};
+
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"<17s", lock_tag_to_str(mut_i)};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"9d", totals.acquisitions} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"9d", totals.contended} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"9d", avg_spin} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"9d", totals.spin_max} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"9d", avg_hold} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"9d", totals.hold_max} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
+            /// Footer
+            ///
+
+            bsl::print() << bsl::ylw << "+---------------------------------------------";
+            bsl::print() << bsl::ylw << "---------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+    };
+
+    extern "C"
+    {
+        /// @brief stores the lock statistics of every named lock
+        // NOLINTNEXTLINE(bsl-var-braced-init)
+        extern lock_stats_t g_mut_lock_stats;
+    }
+}
+
+#endif
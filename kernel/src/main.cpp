@@ -28,11 +28,14 @@
 #include <fast_fail.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <lock_stats_t.hpp>
 #include <mk_args_t.hpp>
 #include <mk_main_t.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+#include <trace_ring_write.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vmexit_loop.hpp>
@@ -49,8 +52,8 @@ namespace mk
     /// @brief stores the TLS blocks used by the microkernel.
     extern "C" constinit bsl::array<tls_t, HYPERVISOR_MAX_PPS.get()> g_mut_tls_blocks{};
 
-    /// @brief stores a pointer to the debug ring provided by the loader
-    extern "C" constinit loader::debug_ring_t *g_pmut_mut_debug_ring{};
+    /// @brief stores the lock statistics of every named lock
+    extern "C" constinit lock_stats_t g_mut_lock_stats{};
 
     /// @brief stores the vmexit log used by the microkernel
     constinit inline vmexit_log_t g_mut_vmexit_log{};
@@ -108,18 +111,23 @@ namespace mk
     [[nodiscard]] extern "C" auto
     dispatch_syscall_trampoline(tls_t *const pmut_tls) noexcept -> syscall::bf_status_t::value_type
     {
-        return dispatch_syscall(
-                   *pmut_tls,
-                   g_mut_page_pool,
-                   g_mut_huge_pool,
-                   g_mut_intrinsic,
-                   g_mut_vm_pool,
-                   g_mut_vp_pool,
-                   g_mut_vps_pool,
-                   g_mut_ext_pool,
-                   *static_cast<ext_t *>(pmut_tls->ext),
-                   g_mut_vmexit_log)
-            .get();
+        auto const opcode{bsl::to_umax(pmut_tls->ext_syscall)};
+        trace_ring_write(*pmut_tls, loader::TRACE_EVENT_SYSCALL_ENTRY, opcode);
+
+        auto const ret{dispatch_syscall(
+            *pmut_tls,
+            g_mut_page_pool,
+            g_mut_huge_pool,
+            g_mut_intrinsic,
+            g_mut_vm_pool,
+            g_mut_vp_pool,
+            g_mut_vps_pool,
+            g_mut_ext_pool,
+            *static_cast<ext_t *>(pmut_tls->ext),
+            g_mut_vmexit_log)};
+
+        trace_ring_write(*pmut_tls, loader::TRACE_EVENT_SYSCALL_EXIT, opcode, bsl::to_umax(ret));
+        return ret.get();
     }
 
     /// <!-- description -->
@@ -29,6 +29,7 @@
 #include <ext_pool_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <invpcid_descriptor_t.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
 #include <tls_t.hpp>
@@ -197,6 +198,14 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            if (bsl::unlikely_assert(nullptr == mut_args.trace_ring)) {
+                bsl::error() << "mut_args.trace_ring is null"    // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
             if (bsl::unlikely_assert(nullptr == mut_args.ext_elf_files.front())) {
                 bsl::error() << "at least one extension is required"    // --
                              << bsl::endl                               // --
@@ -277,6 +286,58 @@ namespace mk
             mut_intrinsic.set_tp(bsl::to_u64(mut_tls.tp));
         }
 
+        /// <!-- description -->
+        ///   @brief Records whether or not the loader enabled PCIDs on the
+        ///     PP we are currently executing on. If PCIDs are enabled, the
+        ///     TLB is flushed of any entries that the OS might have tagged
+        ///     with a PCID as the microkernel uses its own PCIDs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        static constexpr void
+        set_pcid_enabled(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            constexpr auto cr4_pcide{0x0000000000020000_u64};
+            constexpr auto disabled{0_u64};
+            constexpr auto enabled{1_umax};
+
+            auto const pcide{mut_intrinsic.cr4() & cr4_pcide};
+            if (disabled == pcide) {
+                mut_tls.pcid_enabled = {};
+                return;
+            }
+
+            mut_tls.pcid_enabled = enabled.get();
+            mut_intrinsic.invpcid({}, {}, INVPCID_TYPE_ALL_CONTEXT);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records whether or not the OS enabled XSAVE on the PP we
+        ///     are currently executing on. If XSAVE is disabled, the FPU
+        ///     state of each VPS is not switched (see fpu_t).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        static constexpr void
+        set_xsave_enabled(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            constexpr auto cr4_osxsave{0x0000000000040000_u64};
+            constexpr auto disabled{0_u64};
+            constexpr auto enabled{1_umax};
+
+            auto const osxsave{intrinsic.cr4() & cr4_osxsave};
+            if (disabled == osxsave) {
+                mut_tls.xsave_enabled = {};
+                return;
+            }
+
+            mut_tls.xsave_enabled = enabled.get();
+        }
+
         /// <!-- description -->
         ///   @brief Initialize all of the global resources the microkernel
         ///     depends on.
@@ -437,6 +498,8 @@ namespace mk
 
             set_extension_sp(mut_tls);
             set_extension_tp(mut_tls, mut_intrinsic);
+            set_pcid_enabled(mut_tls, mut_intrinsic);
+            set_xsave_enabled(mut_tls, mut_intrinsic);
 
             if (mut_args.ppid == syscall::BF_BS_PPID) {
                 mut_ret = this->initialize(
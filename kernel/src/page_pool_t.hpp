@@ -25,10 +25,14 @@
 #ifndef PAGE_POOL_T_HPP
 #define PAGE_POOL_T_HPP
 
+#include <allocate_tags.hpp>
+#include <clear_pages.hpp>
 #include <lock_guard_t.hpp>
+#include <lock_tags.hpp>
 #include <page_pool_node_t.hpp>
+#include <page_pool_pp_t.hpp>
 #include <page_pool_record_t.hpp>
-#include <spinlock_t.hpp>
+#include <ticketlock_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/array.hpp>
@@ -37,17 +41,18 @@
 #include <bsl/cstring.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/destroy_at.hpp>
-#include <bsl/is_trivial.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/is_constant_evaluated.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
-#include <bsl/string_view.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
+#include <bsl/unlikely_assert.hpp>
 
 namespace mk
 {
-    /// @brief stores the max number of records the page pool can store
-    constexpr auto PAGE_POOL_MAX_RECORDS{10_umax};
+    /// @brief stores the number of pages moved to/from a PP's cache at once
+    constexpr auto PAGE_POOL_BATCH_SIZE{16_umax};
 
     /// @class mk::page_pool_t
     ///
@@ -58,16 +63,335 @@ namespace mk
     ///      direct map, so all virt to phys translations of allocated pages
     ///      can be done using simple arithmetic.
     ///
+    /// <!-- notes -->
+    ///   @note Each PP has a cache of free pages that sits in front of the
+    ///     global free list. Pages are moved between a PP's cache and the
+    ///     global free list in batches of PAGE_POOL_BATCH_SIZE, which means
+    ///     that the page pool's lock is only taken once per batch instead
+    ///     of once per page. Tag accounting is also kept per PP and is
+    ///     indexed by the allocate tag (see allocate_tags.hpp). A PP only
+    ///     ever writes to its own records, so allocate() and deallocate()
+    ///     never touch memory that is shared with another PP unless they
+    ///     have to refill or drain the PP's cache. The records are summed
+    ///     up using relaxed loads when they are reported, and a tag's
+    ///     high-water mark is sampled when the lock is taken to refill or
+    ///     drain a PP's cache.
+    ///   @note Pages are zeroed when they are deallocated and not when they
+    ///     are allocated. The loader provides a zeroed page pool, so every
+    ///     page in the page pool is always zero except for the node's next
+    ///     pointer, and allocate() only has to clear that pointer.
+    ///
     class page_pool_t final
     {
         /// @brief stores the head of the page pool.
         page_pool_node_t *m_head{};
         /// @brief stores the total number of bytes given to the page pool.
         bsl::safe_uintmax m_size{};
-        /// @brief stores information about how memory is allocated
-        bsl::array<page_pool_record_t, PAGE_POOL_MAX_RECORDS.get()> m_rcds{};
+        /// @brief stores the number of pages in the global free list
+        bsl::safe_uintmax m_free{};
+        /// @brief stores the most bytes ever taken from the global free list
+        bsl::safe_uintmax m_hwm{};
+        /// @brief stores the (sampled) high-water mark of each allocate tag
+        bsl::array<bsl::uint64, ALLOCATE_TAG_MAX.get()> m_tag_hwms{};
+        /// @brief stores each PP's page cache and tag accounting
+        bsl::array<page_pool_pp_t, HYPERVISOR_MAX_PPS.get()> m_pps{};
         /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock{};
+        mutable ticketlock_t m_lock{LOCK_TAG_PAGE_POOL};
+
+        /// <!-- description -->
+        ///   @brief Returns the PP specific state of the page pool for the
+        ///     PP associated with the provided TLS block, or a nullptr if
+        ///     the TLS block's ppid is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the PP specific state of the page pool for the
+        ///     PP associated with the provided TLS block, or a nullptr if
+        ///     the TLS block's ppid is invalid.
+        ///
+        [[nodiscard]] constexpr auto
+        get_pp(tls_t const &tls) noexcept -> page_pool_pp_t *
+        {
+            auto *const pmut_pp{m_pps.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_pp)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return nullptr;
+            }
+
+            return pmut_pp;
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically reads the provided counter. The counters are
+        ///     only used for accounting, so a relaxed load is enough.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cnt the counter to read
+        ///   @return Returns the value of the provided counter
+        ///
+        [[nodiscard]] static constexpr auto
+        load(bsl::uint64 const *const cnt) noexcept -> bsl::safe_uintmax
+        {
+            if (bsl::is_constant_evaluated()) {
+                return bsl::to_umax(*cnt);
+            }
+
+            return bsl::to_umax(__atomic_load_n(cnt, __ATOMIC_RELAXED));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically stores the provided value into the provided
+        ///     counter. The counters are only used for accounting, so a
+        ///     relaxed store is enough.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_cnt the counter to store to
+        ///   @param val the value to store
+        ///
+        static constexpr void
+        store(bsl::uint64 *const pmut_cnt, bsl::safe_uintmax const &val) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                *pmut_cnt = bsl::to_u64(val).get();
+                return;
+            }
+
+            __atomic_store_n(pmut_cnt, bsl::to_u64(val).get(), __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds one to the provided counter of one of the current
+        ///     PP's records. Only the PP that owns a record ever writes to
+        ///     it, so there is no need for an atomic read-modify-write. The
+        ///     store is atomic so that other PPs can read the counter while
+        ///     it is being updated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_cnt the counter to add one to
+        ///
+        static constexpr void
+        inc(bsl::uint64 *const pmut_cnt) noexcept
+        {
+            store(pmut_cnt, load(pmut_cnt) + 1_umax);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes currently allocated using
+        ///     the provided allocate tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the allocate tag to get the number of bytes for
+        ///   @return Returns the number of bytes currently allocated using
+        ///     the provided allocate tag.
+        ///
+        [[nodiscard]] constexpr auto
+        tag_usd(bsl::safe_uintmax const &tag) const noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax mut_allocs{};
+            bsl::safe_uintmax mut_frees{};
+
+            /// NOTE:
+            /// - A page might be allocated on one PP and deallocated on
+            ///   another. The deallocations are added up first so that we
+            ///   usually see the allocation that each deallocation belongs
+            ///   to, but relaxed loads do not guarantee that, so another PP
+            ///   can make it look like a tag has more deallocations than
+            ///   allocations for a moment. This is only accounting, so in
+            ///   that case the tag is reported as using nothing.
+            ///
+
+            for (auto const elem : m_pps) {
+                mut_frees += load(&elem.data->rcds.at_if(tag)->frees);
+            }
+
+            for (auto const elem : m_pps) {
+                mut_allocs += load(&elem.data->rcds.at_if(tag)->allocs);
+            }
+
+            if (mut_frees > mut_allocs) {
+                return {};
+            }
+
+            return (mut_allocs - mut_frees) * HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the high-water mark of the provided allocate
+        ///     tag in bytes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the allocate tag to get the high-water mark for
+        ///   @return Returns the high-water mark of the provided allocate
+        ///     tag in bytes.
+        ///
+        [[nodiscard]] constexpr auto
+        tag_hwm(bsl::safe_uintmax const &tag) const noexcept -> bsl::safe_uintmax
+        {
+            auto const usd{this->tag_usd(tag)};
+            auto const hwm{load(m_tag_hwms.at_if(tag))};
+
+            if (usd > hwm) {
+                return usd;
+            }
+
+            return hwm;
+        }
+
+        /// <!-- description -->
+        ///   @brief Samples the high-water mark of the provided allocate
+        ///     tag. This must be called with the lock held.
+        ///
+        /// <!-- notes -->
+        ///   @note The high-water mark is only sampled when a PP refills
+        ///     or drains its cache, which is where the lock is already held.
+        ///     The sample includes the allocation or deallocation that
+        ///     caused the refill or drain. Between two samples, a tag can
+        ///     peak without being seen, so a tag's high-water mark can be
+        ///     short by at most the size of a PP's cache (i.e., twice
+        ///     PAGE_POOL_BATCH_SIZE pages) per PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the allocate tag to sample the high-water mark of
+        ///
+        constexpr void
+        sample_tag_hwm(bsl::safe_uintmax const &tag) noexcept
+        {
+            auto *const pmut_hwm{m_tag_hwms.at_if(tag)};
+            auto const usd{this->tag_usd(tag) + HYPERVISOR_PAGE_SIZE};
+
+            if (usd > load(pmut_hwm)) {
+                store(pmut_hwm, usd);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the sum of the provided allocate tag's records
+        ///     across all of the PPs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the allocate tag to get the totals for
+        ///   @return Returns the sum of the provided allocate tag's records
+        ///     across all of the PPs.
+        ///
+        [[nodiscard]] constexpr auto
+        tag_totals(bsl::safe_uintmax const &tag) const noexcept -> page_pool_record_t
+        {
+            bsl::safe_uintmax mut_allocs{};
+            bsl::safe_uintmax mut_frees{};
+            bsl::safe_uintmax mut_fails{};
+            for (auto const elem : m_pps) {
+                auto const *const rcd{elem.data->rcds.at_if(tag)};
+
+                mut_allocs += load(&rcd->allocs);
+                mut_frees += load(&rcd->frees);
+                mut_fails += load(&rcd->fails);
+            }
+
+            return {mut_allocs.get(), mut_frees.get(), mut_fails.get()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to PAGE_POOL_BATCH_SIZE pages from the global
+        ///     free list into the provided PP's cache. The pages are moved
+        ///     as a single chain, so they are handed out in the same order
+        ///     that they were stored in the global free list. Since the lock
+        ///     is already held, this is also where the high-water marks are
+        ///     updated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param pmut_pp the PP specific state of the page pool to refill
+        ///   @param tag the allocate tag of the allocation that needs the
+        ///     refill
+        ///
+        constexpr void
+        refill(tls_t &mut_tls, page_pool_pp_t *const pmut_pp, bsl::safe_uintmax const &tag) noexcept
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely(nullptr == m_head)) {
+                return;
+            }
+
+            auto *const pmut_first{m_head};
+            auto *pmut_mut_last{m_head};
+
+            bsl::safe_uintmax mut_size{1_umax};
+            while (mut_size < PAGE_POOL_BATCH_SIZE) {
+                if (nullptr == pmut_mut_last->next) {
+                    break;
+                }
+
+                pmut_mut_last = pmut_mut_last->next;
+                ++mut_size;
+            }
+
+            m_head = pmut_mut_last->next;
+            m_free -= mut_size;
+
+            pmut_mut_last->next = pmut_pp->head;
+            pmut_pp->head = pmut_first;
+            pmut_pp->size += mut_size;
+
+            /// NOTE:
+            /// - The pool's high-water mark is the most memory that has ever
+            ///   been taken out of the global free list, which is exactly
+            ///   how much memory the pool needed to have. This is the
+            ///   number to use when sizing HYPERVISOR_MK_PAGE_POOL_SIZE.
+            ///
+
+            auto const out{m_size - (m_free * HYPERVISOR_PAGE_SIZE)};
+            if (out > m_hwm) {
+                m_hwm = out;
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->sample_tag_hwm(tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves PAGE_POOL_BATCH_SIZE pages from the provided PP's
+        ///     cache back to the global free list. The chain is detached
+        ///     from the PP's cache before the lock is taken so that the
+        ///     lock is only held long enough to splice in the chain, and to
+        ///     sample the high-water mark of the tag being deallocated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param pmut_pp the PP specific state of the page pool to drain
+        ///   @param tag the allocate tag of the deallocation that caused
+        ///     the drain
+        ///
+        constexpr void
+        drain(tls_t &mut_tls, page_pool_pp_t *const pmut_pp, bsl::safe_uintmax const &tag) noexcept
+        {
+            auto *const pmut_first{pmut_pp->head};
+            auto *pmut_mut_last{pmut_pp->head};
+
+            for (bsl::safe_uintmax mut_i{1_umax}; mut_i < PAGE_POOL_BATCH_SIZE; ++mut_i) {
+                pmut_mut_last = pmut_mut_last->next;
+            }
+
+            pmut_pp->head = pmut_mut_last->next;
+            pmut_pp->size -= PAGE_POOL_BATCH_SIZE;
+
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            pmut_mut_last->next = m_head;
+            m_head = pmut_first;
+            m_free += PAGE_POOL_BATCH_SIZE;
+
+            this->sample_tag_hwm(tag);
+        }
 
     public:
         /// <!-- description -->
@@ -83,6 +407,7 @@ namespace mk
         {
             m_head = mut_pool.data();
             m_size = mut_pool.size() * HYPERVISOR_PAGE_SIZE;
+            m_free = mut_pool.size();
         }
 
         /// <!-- description -->
@@ -91,72 +416,80 @@ namespace mk
         /// <!-- inputs/outputs -->
         ///   @tparam T the type of pointer to allocate
         ///   @param mut_tls the current TLS block
-        ///   @param tag the tag to mark the allocation with
+        ///   @param tag the allocate tag to mark the allocation with
         ///   @return Returns a pointer to the newly allocated page
         ///
         template<typename T>
         [[nodiscard]] constexpr auto
-        allocate(tls_t &mut_tls, bsl::string_view const &tag) noexcept -> T *
+        allocate(tls_t &mut_tls, bsl::safe_uintmax const &tag) noexcept -> T *
         {
             static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
-            lock_guard_t mut_lock{mut_tls, m_lock};
 
-            if (bsl::unlikely(tag.empty())) {
-                bsl::error() << "invalid tag\n" << bsl::here();
+            auto *const pmut_pp{this->get_pp(mut_tls)};
+            if (bsl::unlikely_assert(nullptr == pmut_pp)) {
+                bsl::print<bsl::V>() << bsl::here();
                 return nullptr;
             }
 
-            if (bsl::unlikely(nullptr == m_head)) {
-                bsl::error() << "page pool out of pages\n" << bsl::here();
+            auto *const pmut_rcd{pmut_pp->rcds.at_if(tag)};
+            if (bsl::unlikely(nullptr == pmut_rcd)) {
+                bsl::error() << "invalid tag "    // --
+                             << bsl::hex(tag)     // --
+                             << bsl::endl         // --
+                             << bsl::here();      // --
+
                 return nullptr;
             }
 
-            page_pool_record_t *pmut_mut_record{};
-            for (auto const elem : m_rcds) {
-                if (nullptr == elem.data->tag) {
-                    pmut_mut_record = elem.data;
-                    pmut_mut_record->tag = tag.data();
-                    break;
-                }
-
-                if (tag == elem.data->tag) {
-                    pmut_mut_record = elem.data;
-                    break;
-                }
-
+            if (nullptr == pmut_pp->head) {
+                this->refill(mut_tls, pmut_pp, tag);
+            }
+            else {
                 bsl::touch();
             }
 
-            if (bsl::unlikely(nullptr == pmut_mut_record)) {
-                bsl::error() << "page pool out of space for tags\n" << bsl::here();
+            /// NOTE:
+            /// - Pages that are sitting in another PP's cache are not
+            ///   visible from here, so this PP can run out of pages while
+            ///   other PPs still have a few cached. Each PP's cache is
+            ///   bounded by twice PAGE_POOL_BATCH_SIZE, which bounds the
+            ///   number of pages that can be stranded this way.
+            ///
+
+            if (bsl::unlikely(nullptr == pmut_pp->head)) {
+                inc(&pmut_rcd->fails);
+                bsl::error() << "page pool out of pages\n" << bsl::here();
                 return nullptr;
             }
 
-            auto *const pmut_node{m_head};
-            m_head = m_head->next;
-            pmut_mut_record->usd += HYPERVISOR_PAGE_SIZE;
+            auto *const pmut_node{pmut_pp->head};
+            pmut_pp->head = pmut_node->next;
+            --pmut_pp->size;
+            inc(&pmut_rcd->allocs);
 
             /// NOTE:
-            /// - We need start the lifetime of the object we are allocating.
-            ///   To do this, we first need to end the lifetime of the node
-            ///   itself, which is done using destroy_at.
-            /// - Next, we need to construct T. This starts the lifetime of
-            ///   T at the address provided by the node. In other words, we
-            ///   now a pointer of type T that has been properly constructed.
-            /// - Finally, if the type is trivial, we zero the memory of the
-            ///   type. This ensures that all trivial types are properly
-            ///   constructed and cleared as there is no default constructor
-            ///   to initialize the type.
+            /// - Every page in the page pool is already zero with the
+            ///   exception of the node's next pointer. The loader zeros
+            ///   the entire page pool before it links the pages together,
+            ///   and deallocate() zeros each page before it is returned
+            ///   to the page pool. Clearing the next pointer is all that
+            ///   is needed to hand out a zeroed page, which keeps the cost
+            ///   of zeroing off of the allocation path.
+            /// - Next, we need start the lifetime of the object we are
+            ///   allocating. To do this, we first need to end the lifetime
+            ///   of the node itself, which is done using destroy_at.
+            /// - Finally, we need to construct T. This starts the lifetime
+            ///   of T at the address provided by the node. In other words,
+            ///   we now a pointer of type T that has been properly
+            ///   constructed. Since the page is already zero, trivial types
+            ///   are properly cleared even though they do not have a
+            ///   default constructor to initialize the type.
             ///
 
-            bsl::destroy_at(pmut_node);
-            auto *const pmut_virt{bsl::construct_at<T>(pmut_node)};
-
-            if (bsl::is_trivial<T>::value) {
-                return bsl::builtin_memset(pmut_virt, '\0', HYPERVISOR_PAGE_SIZE);
-            }
+            pmut_node->next = nullptr;
 
-            return pmut_virt;
+            bsl::destroy_at(pmut_node);
+            return bsl::construct_at<T>(pmut_node);
         }
 
         /// <!-- description -->
@@ -167,32 +500,28 @@ namespace mk
         ///   @tparam T the type of pointer to deallocate
         ///   @param mut_tls the current TLS block
         ///   @param pmut_virt the pointer to the page to deallocate
-        ///   @param tag the tag the allocation was marked with
+        ///   @param tag the allocate tag the allocation was marked with
         ///
         template<typename T>
         constexpr void
-        deallocate(tls_t &mut_tls, T *const pmut_virt, bsl::string_view const &tag) noexcept
+        deallocate(tls_t &mut_tls, T *const pmut_virt, bsl::safe_uintmax const &tag) noexcept
         {
             static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
-            lock_guard_t mut_lock{mut_tls, m_lock};
 
             if (bsl::unlikely(nullptr == pmut_virt)) {
                 return;
             }
 
-            page_pool_record_t *pmut_mut_record{};
-            for (auto const elem : m_rcds) {
-                if (elem.data->tag == tag) {
-                    pmut_mut_record = elem.data;
-                    break;
-                }
-
-                bsl::touch();
+            auto *const pmut_pp{this->get_pp(mut_tls)};
+            if (bsl::unlikely_assert(nullptr == pmut_pp)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return;
             }
 
-            if (bsl::unlikely(nullptr == pmut_mut_record)) {
+            auto *const pmut_rcd{pmut_pp->rcds.at_if(tag)};
+            if (bsl::unlikely(nullptr == pmut_rcd)) {
                 bsl::error() << "invalid tag "    // --
-                             << tag               // --
+                             << bsl::hex(tag)     // --
                              << bsl::endl         // --
                              << bsl::here();      // --
 
@@ -206,9 +535,17 @@ namespace mk
             ///   to construct T * as a node, the same way that we constructed
             ///   the T * in the first place. To do that, we must first end
             ///   the lifetime of the provided T *.
+            /// - Next, we zero the page. Every page in the page pool must be
+            ///   zero (except for the node's next pointer) so that allocate()
+            ///   can hand out pages without zeroing them. The page is zeroed
+            ///   here, before it is added to this PP's cache, which means
+            ///   that the zeroing is done by the PP that is freeing the page
+            ///   and never while the page pool's lock is held.
             /// - Next, we construct a node using the memory from T *. This
             ///   beings the lifetime of our node.
-            /// - Finally, we add the node to the linked list.
+            /// - Finally, we add the node to this PP's cache. If the cache
+            ///   has grown too large, a batch of pages is given back to the
+            ///   global free list so that other PPs can use them.
             /// - You might be wondering why we simply do not use a static_cast.
             ///   If the types are POD types, a static_cast using void * would
             ///   be enough without invoking undefined behavior. The use of
@@ -227,40 +564,145 @@ namespace mk
             ///
 
             bsl::destroy_at(pmut_virt);
+            if (bsl::is_constant_evaluated()) {
+                bsl::builtin_memset(pmut_virt, '\0', HYPERVISOR_PAGE_SIZE);
+            }
+            else {
+                constexpr auto one_page{1_u64};
+                clear_pages(pmut_virt, one_page.get());
+            }
             auto *const pmut_node{bsl::construct_at<page_pool_node_t>(pmut_virt)};
 
-            pmut_node->next = m_head;
-            m_head = pmut_node;
-            pmut_mut_record->usd -= HYPERVISOR_PAGE_SIZE;
+            pmut_node->next = pmut_pp->head;
+            pmut_pp->head = pmut_node;
+            ++pmut_pp->size;
+            inc(&pmut_rcd->frees);
+
+            if (pmut_pp->size > (PAGE_POOL_BATCH_SIZE + PAGE_POOL_BATCH_SIZE)) {
+                this->drain(mut_tls, pmut_pp, tag);
+            }
+            else {
+                bsl::touch();
+            }
         }
 
         /// <!-- description -->
         ///   @brief Returns the number of bytes allocated for a given tag.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
-        ///   @param tag the tag the allocation was marked with
+        ///   @param tls the current TLS block
+        ///   @param tag the allocate tag the allocation was marked with
         ///   @return Returns the number of bytes allocated for a given tag.
         ///
         [[nodiscard]] constexpr auto
-        allocated(tls_t &mut_tls, bsl::string_view const &tag) noexcept -> bsl::safe_uintmax
+        allocated(tls_t const &tls, bsl::safe_uintmax const &tag) const noexcept
+            -> bsl::safe_uintmax
         {
-            lock_guard_t mut_lock{mut_tls, m_lock};
+            bsl::discard(tls);
 
-            for (auto const elem : m_rcds) {
-                if (elem.data->tag == tag) {
-                    return elem.data->usd;
-                }
+            if (bsl::unlikely(nullptr == m_tag_hwms.at_if(tag))) {
+                bsl::error() << "invalid tag "    // --
+                             << bsl::hex(tag)     // --
+                             << bsl::endl         // --
+                             << bsl::here();      // --
 
-                bsl::touch();
+                return bsl::safe_uintmax::failure();
+            }
+
+            return this->tag_usd(tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the most bytes that have ever been allocated at
+        ///     once for a given tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param tag the allocate tag the allocations were marked with
+        ///   @return Returns the most bytes that have ever been allocated at
+        ///     once for a given tag.
+        ///
+        [[nodiscard]] constexpr auto
+        allocated_hwm(tls_t const &tls, bsl::safe_uintmax const &tag) const noexcept
+            -> bsl::safe_uintmax
+        {
+            bsl::discard(tls);
+
+            if (bsl::unlikely(nullptr == m_tag_hwms.at_if(tag))) {
+                bsl::error() << "invalid tag "    // --
+                             << bsl::hex(tag)     // --
+                             << bsl::endl         // --
+                             << bsl::here();      // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            return this->tag_hwm(tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes given to the page pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of bytes given to the page pool.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes currently allocated from
+        ///     the page pool across all of the allocate tags.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes currently allocated from
+        ///     the page pool across all of the allocate tags.
+        ///
+        [[nodiscard]] constexpr auto
+        used() const noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax mut_usd{};
+            for (bsl::safe_uintmax mut_i{}; mut_i < ALLOCATE_TAG_MAX; ++mut_i) {
+                mut_usd += this->tag_usd(mut_i);
             }
 
-            bsl::error() << "invalid tag "    // --
-                         << tag               // --
-                         << bsl::endl         // --
-                         << bsl::here();      // --
+            return mut_usd;
+        }
 
-            return bsl::safe_uintmax::failure();
+        /// <!-- description -->
+        ///   @brief Returns the most bytes that have ever been taken out of
+        ///     the page pool's global free list (i.e., the most memory that
+        ///     the page pool has ever needed).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the most bytes that have ever been taken out of
+        ///     the page pool's global free list.
+        ///
+        [[nodiscard]] constexpr auto
+        high_water_mark() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_hwm;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of allocations that failed
+        ///     because the page pool was out of pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of allocations that failed
+        ///     because the page pool was out of pages.
+        ///
+        [[nodiscard]] constexpr auto
+        failures() const noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax mut_fails{};
+            for (bsl::safe_uintmax mut_i{}; mut_i < ALLOCATE_TAG_MAX; ++mut_i) {
+                mut_fails += bsl::to_umax(this->tag_totals(mut_i).fails);
+            }
+
+            return mut_fails;
         }
 
         /// <!-- description -->
@@ -349,9 +791,12 @@ namespace mk
             bsl::print() << bsl::ylw << "+----------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
 
-            bsl::safe_uintmax mut_usd{};
-            for (auto const elem : m_rcds) {
-                mut_usd += elem.data->usd;
+            auto const usd{this->used()};
+            auto const rem{m_size - usd};
+
+            bsl::safe_uintmax mut_cached{};
+            for (auto const elem : m_pps) {
+                mut_cached += elem.data->size * HYPERVISOR_PAGE_SIZE;
             }
 
             /// Total
@@ -375,11 +820,26 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<23s", "used "};
             bsl::print() << bsl::ylw << "| ";
-            if ((mut_usd / mb).is_zero()) {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", mut_usd / kb} << " KB ";
+            if ((usd / mb).is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", usd / kb} << " KB ";
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", usd / mb} << " MB ";
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Cached
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "cached (per-pp) "};
+            bsl::print() << bsl::ylw << "| ";
+            if ((mut_cached / mb).is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", mut_cached / kb} << " KB ";
             }
             else {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", mut_usd / mb} << " MB ";
+                bsl::print() << bsl::rst << bsl::fmt{"4d", mut_cached / mb} << " MB ";
             }
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
@@ -390,15 +850,40 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<23s", "remaining "};
             bsl::print() << bsl::ylw << "| ";
-            if (((m_size - mut_usd) / mb).is_zero()) {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", (m_size - mut_usd) / kb} << " KB ";
+            if ((rem / mb).is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", rem / kb} << " KB ";
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", rem / mb} << " MB ";
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// High-Water Mark
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "high-water mark "};
+            bsl::print() << bsl::ylw << "| ";
+            if ((m_hwm / mb).is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", m_hwm / kb} << " KB ";
             }
             else {
-                bsl::print() << bsl::rst << bsl::fmt{"4d", (m_size - mut_usd) / mb} << " MB ";
+                bsl::print() << bsl::rst << bsl::fmt{"4d", m_hwm / mb} << " MB ";
             }
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            /// Failures
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "failures "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"7d", this->failures()} << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
             /// Tags
             ///
 
@@ -406,49 +891,78 @@ namespace mk
             bsl::print() << bsl::rst << bsl::endl;
 
             bsl::print() << bsl::rst << bsl::endl;
-            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::ylw << "+----------------------------------";
+            bsl::print() << bsl::ylw << "-----------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
 
             bsl::print() << bsl::ylw << "| ";
-            bsl::print() << bsl::blu << bsl::fmt{"^33s", "breakdown "};
+            bsl::print() << bsl::blu << bsl::fmt{"^68s", "breakdown "};
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
-            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::ylw << "+----------------------------------";
+            bsl::print() << bsl::ylw << "-----------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
 
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::cyn << bsl::fmt{"^23s", "description "};
             bsl::print() << bsl::ylw << "| ";
-            bsl::print() << bsl::cyn << bsl::fmt{"^8s", "value "};
+            bsl::print() << bsl::cyn << bsl::fmt{"^8s", "used "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^8s", "hwm "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^7s", "allocs "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^7s", "frees "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^5s", "fails "};
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
-            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::ylw << "+----------------------------------";
+            bsl::print() << bsl::ylw << "-----------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
 
-            for (auto const elem : m_rcds) {
-                if (nullptr == elem.data->tag) {
+            for (bsl::safe_uintmax mut_i{}; mut_i < ALLOCATE_TAG_MAX; ++mut_i) {
+                auto const totals{this->tag_totals(mut_i)};
+                if (bsl::to_umax(totals.allocs).is_zero() && bsl::to_umax(totals.fails).is_zero()) {
                     continue;
                 }
 
+                auto const tag_usd{this->tag_usd(mut_i)};
+                auto const tag_hwm{this->tag_hwm(mut_i)};
+
                 bsl::print() << bsl::ylw << "| ";
-                bsl::print() << bsl::rst << bsl::fmt{"<23s", elem.data->tag};
+                bsl::print() << bsl::rst << bsl::fmt{"<23s", allocate_tag_to_str(mut_i)};
                 bsl::print() << bsl::ylw << "| ";
-                if ((elem.data->usd / mb).is_zero()) {
-                    bsl::print() << bsl::rst << bsl::fmt{"4d", elem.data->usd / kb} << " KB ";
+                if ((tag_usd / mb).is_zero()) {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", tag_usd / kb} << " KB ";
                 }
                 else {
-                    bsl::print() << bsl::rst << bsl::fmt{"4d", elem.data->usd / mb} << " MB ";
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", tag_usd / mb} << " MB ";
                 }
                 bsl::print() << bsl::ylw << "| ";
+                if ((tag_hwm / mb).is_zero()) {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", tag_hwm / kb} << " KB ";
+                }
+                else {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", tag_hwm / mb} << " MB ";
+                }
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"6d", bsl::to_umax(totals.allocs)} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"6d", bsl::to_umax(totals.frees)} << ' ';
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"4d", bsl::to_umax(totals.fails)} << ' ';
+                bsl::print() << bsl::ylw << "| ";
                 bsl::print() << bsl::rst << bsl::endl;
             }
 
             /// Footer
             ///
 
-            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::ylw << "+----------------------------------";
+            bsl::print() << bsl::ylw << "-----------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
         }
     };
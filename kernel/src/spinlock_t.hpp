@@ -25,14 +25,19 @@
 #ifndef SPINLOCK_T_HPP
 #define SPINLOCK_T_HPP
 
+#include "lock_probe_t.hpp"
+#include "trace_ring_write.hpp"
+
 #include <bf_constants.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
 #include <yield.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/is_constant_evaluated.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 
 #pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
 
@@ -62,6 +67,8 @@ namespace mk
         bsl::safe_uint16 m_esr_ppid;
         /// @brief stores whether or not the lock is acquired
         _Atomic bool m_flag;
+        /// @brief stores the probe that records this lock's statistics
+        [[no_unique_address]] lock_probe_t<> m_probe;
 
     public:
         /// <!-- description -->
@@ -70,7 +77,29 @@ namespace mk
         // We cannot member initialize atomics so this is not possible
         // NOLINTNEXTLINE(bsl-class-member-init)
         constexpr spinlock_t() noexcept    // --
-            : m_std_ppid{bsl::safe_uint16::failure()}, m_esr_ppid{bsl::safe_uint16::failure()}
+            : m_std_ppid{bsl::safe_uint16::failure()}
+            , m_esr_ppid{bsl::safe_uint16::failure()}
+            , m_probe{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_flag = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a spinlock_t with the provided lock tag. The
+        ///     tag names the lock, which is how the lock's contention
+        ///     statistics are reported (see lock_stats_t).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag that names this spinlock_t
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        explicit constexpr spinlock_t(bsl::safe_uintmax const &tag) noexcept    // --
+            : m_std_ppid{bsl::safe_uint16::failure()}
+            , m_esr_ppid{bsl::safe_uint16::failure()}
+            , m_probe{tag}
         {
             // This is the only way to initialize this
             // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
@@ -198,12 +227,28 @@ namespace mk
             ///   overall performance.
             ///
 
+            auto const start{m_probe.start()};
+            bool mut_contended{};
+            bsl::safe_uintmax mut_spins{};
+
             while (__c11_atomic_exchange(&m_flag, true, __ATOMIC_ACQUIRE)) {
+                mut_contended = true;
                 while (__c11_atomic_load(&m_flag, __ATOMIC_RELAXED)) {
+                    ++mut_spins;
                     yield();
                 }
             }
 
+            m_probe.acquired(tls, start, mut_contended);
+            if (mut_contended) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                auto const addr{bsl::to_umax(reinterpret_cast<bsl::uintmax>(this))};
+                trace_ring_write(tls, loader::TRACE_EVENT_LOCK_CONTENTION, addr, mut_spins);
+            }
+            else {
+                bsl::touch();
+            }
+
             if (tls.esr_ip == SPINLOCK_ESR_NOT_EXECUTED) {
                 m_std_ppid = tls.ppid;
             }
@@ -247,6 +292,8 @@ namespace mk
                 return;
             }
 
+            m_probe.released(tls);
+
             /// NOTE:
             /// - Here, we simply need to set the lock flag to false,
             ///   indicating that we no longer are holding the lock. We
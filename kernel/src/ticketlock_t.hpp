@@ -0,0 +1,620 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef TICKETLOCK_T_HPP
+#define TICKETLOCK_T_HPP
+
+#include "lock_probe_t.hpp"
+#include "trace_ring_write.hpp"
+
+#include <bf_constants.hpp>
+#include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+#include <yield.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/is_constant_evaluated.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely_assert.hpp>
+
+#pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
+
+namespace mk
+{
+    /// @brief defines when an esr has not executed
+    constexpr auto TICKETLOCK_ESR_NOT_EXECUTED{0_umax};
+    /// @brief defines how much a ticket is incremented by
+    constexpr auto TICKETLOCK_TICKET_INC{1_u32};
+    /// @brief defines the bits of a claim that store the claimed ticket
+    constexpr auto TICKETLOCK_TICKET_MASK{0xFFFFFFFF_u64};
+    /// @brief defines the number of tickets before the tickets wrap around
+    constexpr auto TICKETLOCK_TICKET_WRAP{0x100000000_u64};
+    /// @brief defines the claim of a PP that is taking a ticket
+    constexpr auto TICKETLOCK_TAKING{0x100000000_u64};
+    /// @brief defines the bit of a claim that marks the ticket as claimed
+    constexpr auto TICKETLOCK_CLAIMED{0x200000000_u64};
+    /// @brief defines the bit of a claim made by an ESR that interrupted a take
+    constexpr auto TICKETLOCK_INTERRUPTED{0x400000000_u64};
+
+    /// @class mk::ticketlock_t
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a ticketlock_t. A ticketlock_t is a drop in
+    ///     replacement for a spinlock_t that hands out the lock in the
+    ///     same order that it was asked for. Each PP that wants the lock
+    ///     takes a ticket with a single atomic add, and then waits until
+    ///     the ticket that is being served is its ticket. Unlike a
+    ///     spinlock_t, taking a ticket never fails, so each PP writes the
+    ///     lock's cache line once to get in line and then only reads it
+    ///     while it waits, and a PP cannot be starved by other PPs that
+    ///     happen to win the race for the lock's cache line. This makes
+    ///     the ticketlock_t the better choice for locks that are taken by
+    ///     every PP at the same time (e.g., the page pool), while the
+    ///     spinlock_t is smaller and cheaper when it is not contended.
+    ///
+    /// <!-- notes -->
+    ///   @note Like the spinlock_t, the ticketlock_t detects and prevents
+    ///     deadlock when the same PP attempts to take the lock more than
+    ///     once, and it handles the case when the lock is taken, and then
+    ///     an ESR fires that is legit and must take the lock as well.
+    ///   @note A ticketlock_t adds one more case that a spinlock_t does not
+    ///     have. If an ESR fires while the PP is waiting for its ticket
+    ///     to be served, the ESR cannot take a ticket of its own, as its
+    ///     ticket would be served after the ticket that the interrupted
+    ///     code is waiting on, which cannot be served until the ESR
+    ///     returns. To handle this, the ticket that each PP is waiting on
+    ///     is stored in the lock, and the ESR borrows the ticket of the
+    ///     code that it interrupted instead.
+    ///   @note The ticket is only known once the atomic add that takes it
+    ///     returns, so there is always a window between taking a ticket
+    ///     and storing it where an ESR could fire. To handle this window,
+    ///     each PP has a claim in the lock. A PP marks its claim as taking
+    ///     before it takes a ticket, and then stores the ticket in its
+    ///     claim, which it keeps until the lock is released. Every ticket
+    ///     that has been taken, but not yet served and released, is
+    ///     therefore either in some PP's claim, or was taken by a PP that
+    ///     is still taking. An ESR that finds its own PP taking waits until
+    ///     the ticket being served is not claimed by any other PP. If that
+    ///     ticket was already taken, it can only be the ticket that the
+    ///     interrupted code took, and the ESR borrows it. Otherwise, the
+    ///     interrupted code has not taken a ticket yet, and the ESR takes
+    ///     a ticket of its own.
+    ///
+    class ticketlock_t final
+    {
+        /// @brief stores the ppid that currently owns the lock (non-ESR)
+        bsl::safe_uint16 m_std_ppid;
+        /// @brief stores the ppid that currently owns the lock (ESR)
+        bsl::safe_uint16 m_esr_ppid;
+        /// @brief stores whether or not a PP is waiting for its ticket
+        bsl::array<bool, HYPERVISOR_MAX_PPS.get()> m_queued;
+        /// @brief stores the ticket that each PP is waiting for
+        bsl::array<bsl::safe_uint32, HYPERVISOR_MAX_PPS.get()> m_tickets;
+        /// @brief stores each PP's claim (see the notes for this class)
+        bsl::array<bsl::uint64, HYPERVISOR_MAX_PPS.get()> m_claims;
+        /// @brief stores the next ticket
+        _Atomic bsl::uint32 m_next;
+        /// @brief stores the ticket that currently owns the lock
+        _Atomic bsl::uint32 m_serving;
+        /// @brief stores the probe that records this lock's statistics
+        [[no_unique_address]] lock_probe_t<> m_probe;
+
+        /// <!-- description -->
+        ///   @brief Returns the number of tickets from the provided first
+        ///     ticket to the provided last ticket, taking into account
+        ///     that tickets wrap around.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param first the ticket to count from
+        ///   @param last the ticket to count to
+        ///   @return Returns the number of tickets from first to last
+        ///
+        [[nodiscard]] static constexpr auto
+        distance(bsl::safe_uint32 const &first, bsl::safe_uint32 const &last) noexcept
+            -> bsl::safe_uint64
+        {
+            return ((bsl::to_u64(last) + TICKETLOCK_TICKET_WRAP) - bsl::to_u64(first)) &
+                   TICKETLOCK_TICKET_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a PP other than the current PP either
+        ///     claimed the provided ticket, or is still taking a ticket and
+        ///     might have taken the provided ticket.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param ticket the ticket to look for
+        ///   @return Returns true if the provided ticket might belong to a
+        ///     PP other than the current PP.
+        ///
+        [[nodiscard]] constexpr auto
+        is_claimed_by_other(tls_t const &tls, bsl::safe_uint32 const &ticket) const noexcept
+            -> bool
+        {
+            auto const claimed{TICKETLOCK_CLAIMED | bsl::to_u64(ticket)};
+            for (auto const elem : m_claims) {
+                if (elem.index == bsl::to_umax(tls.ppid)) {
+                    continue;
+                }
+
+                bsl::safe_uint64 const claim{__atomic_load_n(elem.data, __ATOMIC_ACQUIRE)};
+                if (claim == TICKETLOCK_TAKING) {
+                    return true;
+                }
+
+                if ((claim & (TICKETLOCK_CLAIMED | TICKETLOCK_TICKET_MASK)) == claimed) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Called by an ESR that interrupted its PP while it was
+        ///     taking a ticket. If the interrupted code already took its
+        ///     ticket, the ticket is stored on behalf of the interrupted
+        ///     code so that the ESR can borrow it, and true is returned.
+        ///     If the interrupted code did not take its ticket yet, false
+        ///     is returned, and the ESR must take a ticket of its own.
+        ///
+        /// <!-- notes -->
+        ///   @note If the interrupted code took a ticket, that ticket was
+        ///     taken before next was read, and it cannot be served and
+        ///     released until the ESR returns, so serving stops at it. If
+        ///     serving gets to next instead, the interrupted code did not
+        ///     take a ticket. If two PPs are interrupted by an ESR that
+        ///     takes this lock while they are taking a ticket, both ESRs
+        ///     wait on each other, so ESRs that take a ticketlock_t must
+        ///     not fire on more than one PP at the same time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param pmut_claim the claim of the current PP
+        ///   @param mut_queued returns true if the ticket was stored
+        ///   @param mut_ticket returns the ticket that was stored
+        ///   @return Returns true if the ESR can borrow the ticket of the
+        ///     code that it interrupted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        borrow_interrupted_ticket(
+            tls_t const &tls,
+            bsl::uint64 *const pmut_claim,
+            bool &mut_queued,
+            bsl::safe_uint32 &mut_ticket) noexcept -> bool
+        {
+            bsl::safe_uint32 const first{__c11_atomic_load(&m_serving, __ATOMIC_ACQUIRE)};
+            bsl::safe_uint32 const next{__c11_atomic_load(&m_next, __ATOMIC_ACQUIRE)};
+
+            while (true) {
+                bsl::safe_uint32 const serving{__c11_atomic_load(&m_serving, __ATOMIC_ACQUIRE)};
+                if (distance(first, serving) >= distance(first, next)) {
+                    return false;
+                }
+
+                if (this->is_claimed_by_other(tls, serving)) {
+                    yield();
+                    continue;
+                }
+
+                if (bsl::safe_uint32{__c11_atomic_load(&m_serving, __ATOMIC_ACQUIRE)} != serving) {
+                    continue;
+                }
+
+                mut_ticket = serving;
+                mut_queued = true;
+
+                auto const claim{TICKETLOCK_CLAIMED | bsl::to_u64(serving)};
+                __atomic_store_n(pmut_claim, claim.get(), __ATOMIC_RELEASE);
+
+                return true;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the current PP's claim once its ticket was
+        ///     served. If the claim was made by an ESR that interrupted
+        ///     its PP while it was taking a ticket, the claim goes back to
+        ///     taking, as the interrupted code still has to take a ticket.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        release_claim(tls_t const &tls) noexcept
+        {
+            auto *const pmut_claim{m_claims.at_if(bsl::to_umax(tls.ppid))};
+            bsl::safe_uint64 const claim{__atomic_load_n(pmut_claim, __ATOMIC_RELAXED)};
+
+            if ((claim & TICKETLOCK_INTERRUPTED).is_pos()) {
+                __atomic_store_n(pmut_claim, TICKETLOCK_TAKING.get(), __ATOMIC_RELEASE);
+            }
+            else {
+                __atomic_store_n(pmut_claim, bsl::uint64{}, __ATOMIC_RELEASE);
+            }
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor.
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        constexpr ticketlock_t() noexcept    // --
+            : m_std_ppid{bsl::safe_uint16::failure()}
+            , m_esr_ppid{bsl::safe_uint16::failure()}
+            , m_queued{}
+            , m_tickets{}
+            , m_claims{}
+            , m_probe{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_next = {};
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_serving = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a ticketlock_t with the provided lock tag. The
+        ///     tag names the lock, which is how the lock's contention
+        ///     statistics are reported (see lock_stats_t).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag the lock tag that names this ticketlock_t
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        explicit constexpr ticketlock_t(bsl::safe_uintmax const &tag) noexcept    // --
+            : m_std_ppid{bsl::safe_uint16::failure()}
+            , m_esr_ppid{bsl::safe_uint16::failure()}
+            , m_queued{}
+            , m_tickets{}
+            , m_claims{}
+            , m_probe{tag}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_next = {};
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_serving = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Destructor
+        ///
+        constexpr ~ticketlock_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr ticketlock_t(ticketlock_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr ticketlock_t(ticketlock_t &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(ticketlock_t const &o) &noexcept -> ticketlock_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(ticketlock_t &&mut_o) &noexcept -> ticketlock_t & = default;
+
+        /// <!-- description -->
+        ///   @brief Locks the ticketlock_t. This will not return until the
+        ///     ticketlock_t can be successfully acquired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        lock(tls_t const &tls) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            /// NOTE:
+            /// - Perform deadlock detection. If deadlock is detected, we
+            ///   return as it means that this PP has already acquired the
+            ///   lock with no means that unlock.
+            ///
+
+            if (tls.ppid == m_std_ppid) {
+                if (tls.esr_ip != TICKETLOCK_ESR_NOT_EXECUTED) {
+                    if (!m_esr_ppid) {
+                        m_esr_ppid = tls.ppid;
+                        return;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                bsl::alert() << "pp "                                       // --
+                             << bsl::hex(tls.ppid)                          // --
+                             << " acquired the same lock more than once"    // --
+                             << bsl::endl;                                  // --
+
+                return;
+            }
+
+            if (tls.ppid == m_esr_ppid) {
+                if (tls.esr_ip == TICKETLOCK_ESR_NOT_EXECUTED) {
+                    m_std_ppid = tls.ppid;
+                    return;
+                }
+
+                bsl::alert() << "pp "                                       // --
+                             << bsl::hex(tls.ppid)                          // --
+                             << " acquired the same lock more than once"    // --
+                             << bsl::endl;                                  // --
+
+                return;
+            }
+
+            auto *const pmut_queued{m_queued.at_if(bsl::to_umax(tls.ppid))};
+            auto *const pmut_ticket{m_tickets.at_if(bsl::to_umax(tls.ppid))};
+            auto *const pmut_claim{m_claims.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_queued)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return;
+            }
+
+            /// NOTE:
+            /// - If an ESR fired while this PP was waiting for its ticket,
+            ///   the ESR borrows the ticket that the interrupted code is
+            ///   waiting on. Once the ESR is done, it does not serve the
+            ///   next ticket (see unlock), which allows the interrupted
+            ///   code to acquire the lock with the same ticket once it
+            ///   resumes.
+            /// - If an ESR fired while this PP was taking a ticket, the
+            ///   ESR has to work out if the interrupted code took a ticket
+            ///   (see the notes for this class). If it did not, the ESR
+            ///   takes its own ticket, and marks its claim so that the
+            ///   claim goes back to taking once the ESR is done.
+            ///
+
+            bsl::safe_uint64 mut_interrupted{};
+            if (tls.esr_ip != TICKETLOCK_ESR_NOT_EXECUTED) {
+                if (!*pmut_queued) {
+                    bsl::safe_uint64 const claim{__atomic_load_n(pmut_claim, __ATOMIC_RELAXED)};
+                    if (claim == TICKETLOCK_TAKING) {
+                        if (this->borrow_interrupted_ticket(
+                                tls, pmut_claim, *pmut_queued, *pmut_ticket)) {
+                            bsl::touch();
+                        }
+                        else {
+                            mut_interrupted = TICKETLOCK_INTERRUPTED;
+                        }
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (*pmut_queued) {
+                    while (bsl::safe_uint32{__c11_atomic_load(&m_serving, __ATOMIC_ACQUIRE)} !=
+                           *pmut_ticket) {
+                        yield();
+                    }
+
+                    m_esr_ppid = tls.ppid;
+                    return;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - The __c11_atomic_fetch_add here takes a ticket. Tickets
+            ///   are handed out in order and are only ever compared for
+            ///   equality, so it does not matter that they eventually wrap
+            ///   around as there can never be more waiters than tickets.
+            /// - Each waiter then reads the ticket that is currently being
+            ///   served until it is its own ticket. Unlike the spinlock_t,
+            ///   the cache line is only written by the PP that takes a
+            ///   ticket and by the PP that releases the lock, and the lock
+            ///   is handed to the waiters in the order that they arrived.
+            /// - This PP's claim is marked as taking before the ticket is
+            ///   taken, and the ticket is stored in the claim once it is
+            ///   known, which is what allows an ESR that fires in between
+            ///   to find the ticket (see the notes for this class). The
+            ///   non-ESR code also records its ticket before it waits so
+            ///   that an ESR that fires while it is waiting can borrow it.
+            ///
+
+            __atomic_store_n(pmut_claim, TICKETLOCK_TAKING.get(), __ATOMIC_RELAXED);
+            bsl::safe_uint32 const ticket{
+                __c11_atomic_fetch_add(&m_next, TICKETLOCK_TICKET_INC.get(), __ATOMIC_ACQ_REL)};
+
+            auto const start{m_probe.start()};
+            bool mut_contended{};
+            bsl::safe_uintmax mut_spins{};
+
+            if (tls.esr_ip == TICKETLOCK_ESR_NOT_EXECUTED) {
+                *pmut_ticket = ticket;
+                *pmut_queued = true;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const claim{TICKETLOCK_CLAIMED | mut_interrupted | bsl::to_u64(ticket)};
+            __atomic_store_n(pmut_claim, claim.get(), __ATOMIC_RELEASE);
+
+            while (bsl::safe_uint32{__c11_atomic_load(&m_serving, __ATOMIC_ACQUIRE)} != ticket) {
+                mut_contended = true;
+                ++mut_spins;
+                yield();
+            }
+
+            m_probe.acquired(tls, start, mut_contended);
+            if (mut_contended) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                auto const addr{bsl::to_umax(reinterpret_cast<bsl::uintmax>(this))};
+                trace_ring_write(tls, loader::TRACE_EVENT_LOCK_CONTENTION, addr, mut_spins);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (tls.esr_ip == TICKETLOCK_ESR_NOT_EXECUTED) {
+                m_std_ppid = tls.ppid;
+                *pmut_queued = false;
+            }
+            else {
+                m_esr_ppid = tls.ppid;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks the ticketlock_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        unlock(tls_t const &tls) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            /// NOTE:
+            /// - Before we release the lock, we need to make sure that
+            ///   we are not holding the lock in both the normal case,
+            ///   and the ESR case. If both have been released, we are clear
+            ///   to release the lock.
+            ///
+
+            if (tls.esr_ip == TICKETLOCK_ESR_NOT_EXECUTED) {
+                m_std_ppid = bsl::safe_uint16::failure();
+            }
+            else {
+                m_esr_ppid = bsl::safe_uint16::failure();
+            }
+
+            if (!!m_std_ppid) {
+                return;
+            }
+
+            if (!!m_esr_ppid) {
+                return;
+            }
+
+            /// NOTE:
+            /// - If this PP is still waiting for its ticket, the lock was
+            ///   acquired by an ESR using a borrowed ticket. The ticket is
+            ///   not served here, as it still belongs to the code that the
+            ///   ESR interrupted, which will own the lock once it resumes.
+            ///
+
+            auto const *const queued{m_queued.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == queued)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return;
+            }
+
+            if (*queued) {
+                return;
+            }
+
+            m_probe.released(tls);
+
+            /// NOTE:
+            /// - Here, we simply need to serve the next ticket, which
+            ///   hands the lock to the next PP in line. We use
+            ///   __ATOMIC_RELEASE to ensure proper memory ordering.
+            /// - This PP's claim is only released once the next ticket is
+            ///   served, so that its ticket is claimed for as long as it is
+            ///   the ticket being served (see the notes for this class).
+            ///
+
+            __c11_atomic_fetch_add(&m_serving, TICKETLOCK_TICKET_INC.get(), __ATOMIC_RELEASE);
+            this->release_claim(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the ticketlock_t is locked
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the ticketlock_t is locked
+        ///
+        [[nodiscard]] constexpr auto
+        is_locked() const noexcept -> bool
+        {
+            bsl::safe_uint32 const next{static_cast<bsl::uint32>(m_next)};
+            bsl::safe_uint32 const serving{static_cast<bsl::uint32>(m_serving)};
+
+            return next != serving;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,102 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_RING_WRITE_HPP
+#define TRACE_RING_WRITE_HPP
+
+#include <timestamp.hpp>
+#include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/is_constant_evaluated.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Adds a record for the provided event to the current PP's
+    ///     trace ring if the event is enabled in the trace ring's mask,
+    ///     overwriting the oldest record if the trace ring is full. This
+    ///     is meant to be cheap enough for the VMExit path, so no
+    ///     formatting is done here. vmmctl does that instead.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @param event the TRACE_EVENT_xxx to record
+    ///   @param data0 the first event specific payload to record
+    ///   @param data1 the second event specific payload to record
+    ///
+    constexpr void
+    trace_ring_write(
+        tls_t const &tls,
+        bsl::safe_uintmax const &event,
+        bsl::safe_uintmax const &data0 = {},
+        bsl::safe_uintmax const &data1 = {}) noexcept
+    {
+        constexpr auto one{1_umax};
+
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        auto *const pmut_ring{tls.trace_ring};
+        if (nullptr == pmut_ring) {
+            return;
+        }
+
+        bsl::safe_uintmax const mask{pmut_ring->mask};
+        if ((mask & (one << event)).is_zero()) {
+            return;
+        }
+
+        bsl::safe_uintmax mut_epos{pmut_ring->epos};
+        auto *const pmut_record{pmut_ring->records.at_if(mut_epos)};
+        if (bsl::unlikely(nullptr == pmut_record)) {
+            pmut_ring->epos = {};
+            return;
+        }
+
+        pmut_record->event = bsl::to_u16_unsafe(event).get();
+        pmut_record->vpsid = tls.active_vpsid;
+        pmut_record->tsc = timestamp();
+        pmut_record->data0 = data0.get();
+        pmut_record->data1 = data1.get();
+
+        ++mut_epos;
+        if (!(loader::TRACE_RING_MAX_RECORDS > mut_epos)) {
+            mut_epos = {};
+        }
+        else {
+            bsl::touch();
+        }
+
+        pmut_ring->epos = mut_epos.get();
+        pmut_ring->num = (bsl::safe_uintmax{pmut_ring->num} + one).get();
+    }
+}
+
+#endif
@@ -25,8 +25,7 @@
 #ifndef VM_POOL_T_HPP
 #define VM_POOL_T_HPP
 
-#include "lock_guard_t.hpp"
-#include "spinlock_t.hpp"
+#include "id_bitmap_t.hpp"
 
 #include <bf_constants.hpp>
 #include <ext_pool_t.hpp>
@@ -48,12 +47,17 @@ namespace mk
     /// <!-- description -->
     ///   @brief Defines the microkernel's VM pool
     ///
+    /// <!-- notes -->
+    ///   @note The IDs of the vm_ts that are not free (i.e., allocated or
+    ///     zombies) are tracked using an id_bitmap_t, which is how a free
+    ///     vm_t is found without a lock or a search of the entire pool.
+    ///
     class vm_pool_t final
     {
         /// @brief stores the pool of vm_ts
         bsl::array<vm_t, HYPERVISOR_MAX_VMS.get()> m_pool{};
-        /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock{};
+        /// @brief stores which of the vm_ts are not free
+        id_bitmap_t<HYPERVISOR_MAX_VMS.get()> m_ids{};
 
     public:
         /// <!-- description -->
@@ -143,24 +147,27 @@ namespace mk
         allocate(tls_t &mut_tls, page_pool_t &mut_page_pool, ext_pool_t &mut_ext_pool) noexcept
             -> bsl::safe_uint16
         {
-            lock_guard_t mut_lock{mut_tls, m_lock};
+            auto const id{m_ids.allocate()};
+            if (bsl::unlikely(!id)) {
+                bsl::error() << "vm pool out of vms\n" << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
 
-            vm_t *pmut_mut_vm{};
-            for (auto const elem : m_pool) {
-                if (elem.data->is_deallocated()) {
-                    pmut_mut_vm = elem.data;
-                    break;
+            auto *const pmut_vm{m_pool.at_if(id)};
+            auto const vmid{pmut_vm->allocate(mut_tls, mut_page_pool, mut_ext_pool)};
+            if (bsl::unlikely(!vmid)) {
+                if (!pmut_vm->is_zombie()) {
+                    m_ids.clear(id);
+                }
+                else {
+                    bsl::touch();
                 }
 
-                bsl::touch();
-            }
-
-            if (bsl::unlikely(nullptr == pmut_mut_vm)) {
-                bsl::error() << "vm pool out of vms\n" << bsl::here();
+                bsl::print<bsl::V>() << bsl::here();
                 return bsl::safe_uint16::failure();
             }
 
-            return pmut_mut_vm->allocate(mut_tls, mut_page_pool, mut_ext_pool);
+            return vmid;
         }
 
         /// <!-- description -->
@@ -197,7 +204,14 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
-            return pmut_vm->deallocate(mut_tls, mut_page_pool, vp_pool, mut_ext_pool);
+            auto const ret{pmut_vm->deallocate(mut_tls, mut_page_pool, vp_pool, mut_ext_pool)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            m_ids.clear(bsl::to_umax(vmid));
+            return ret;
         }
 
         /// <!-- description -->
@@ -225,7 +239,20 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
+            /// NOTE:
+            /// - A zombie can never be allocated again, so its ID is
+            ///   marked as taken for good (which it already is if the
+            ///   vm_t was allocated when it was zombified).
+            ///
+
             pmut_vm->zombify();
+            if (pmut_vm->is_zombie()) {
+                m_ids.set(bsl::to_umax(vmid));
+            }
+            else {
+                bsl::touch();
+            }
+
             return bsl::errc_success;
         }
 
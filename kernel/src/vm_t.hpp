@@ -25,16 +25,17 @@
 #ifndef VM_T_HPP
 #define VM_T_HPP
 
+#include "id_bitmap_t.hpp"
 #include "lock_guard_t.hpp"
 #include "spinlock_t.hpp"
 
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <ext_pool_t.hpp>
+#include <lock_tags.hpp>
 #include <tls_t.hpp>
 #include <vp_pool_t.hpp>
 
-#include <bsl/array.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally.hpp>
@@ -79,10 +80,10 @@ namespace mk
         bsl::safe_uint16 m_id{bsl::safe_uint16::failure()};
         /// @brief stores whether or not this vm_t is allocated.
         allocated_status_t m_allocated{allocated_status_t::deallocated};
-        /// @brief stores whether or not this vm_t is active.
-        bsl::array<bool, HYPERVISOR_MAX_PPS.get()> m_active{};
+        /// @brief stores the IDs of the PPs this vm_t is active on
+        id_bitmap_t<HYPERVISOR_MAX_PPS.get()> m_active{};
         /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock;
+        mutable spinlock_t m_lock{LOCK_TAG_VM};
 
     public:
         /// <!-- description -->
@@ -467,10 +468,9 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            auto *const pmut_active{m_active.at_if(bsl::to_umax(mut_tls.ppid))};
-            if (bsl::unlikely_assert(nullptr == pmut_active)) {
+            if (bsl::unlikely_assert(bsl::to_umax(mut_tls.ppid) >= HYPERVISOR_MAX_PPS)) {
                 bsl::error() << "mut_tls.ppid "                               // --
-                             << bsl::hex(m_id)                                // --
+                             << bsl::hex(mut_tls.ppid)                        // --
                              << " is greater than the HYPERVISOR_MAX_PPS "    // --
                              << bsl::hex(HYPERVISOR_MAX_PPS)                  // --
                              << bsl::endl                                     // --
@@ -479,7 +479,7 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
-            if (bsl::unlikely_assert(*pmut_active)) {
+            if (bsl::unlikely_assert(m_active.is_set(bsl::to_umax(mut_tls.ppid)))) {
                 bsl::error() << "vm "                                 // --
                              << bsl::hex(m_id)                        // --
                              << " is already the active vm on pp "    // --
@@ -491,7 +491,7 @@ namespace mk
             }
 
             mut_tls.active_vmid = m_id.get();
-            *pmut_active = true;
+            m_active.set(bsl::to_umax(mut_tls.ppid));
 
             return bsl::errc_success;
         }
@@ -546,10 +546,9 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            auto *const pmut_active{m_active.at_if(bsl::to_umax(mut_tls.ppid))};
-            if (bsl::unlikely_assert(nullptr == pmut_active)) {
+            if (bsl::unlikely_assert(bsl::to_umax(mut_tls.ppid) >= HYPERVISOR_MAX_PPS)) {
                 bsl::error() << "mut_tls.ppid "                               // --
-                             << bsl::hex(m_id)                                // --
+                             << bsl::hex(mut_tls.ppid)                        // --
                              << " is greater than the HYPERVISOR_MAX_PPS "    // --
                              << bsl::hex(HYPERVISOR_MAX_PPS)                  // --
                              << bsl::endl                                     // --
@@ -558,7 +557,7 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
-            if (bsl::unlikely_assert(!*pmut_active)) {
+            if (bsl::unlikely_assert(!m_active.is_set(bsl::to_umax(mut_tls.ppid)))) {
                 bsl::error() << "vm "                      // --
                              << bsl::hex(m_id)             // --
                              << " is not active on pp "    // --
@@ -570,7 +569,7 @@ namespace mk
             }
 
             mut_tls.active_vmid = syscall::BF_INVALID_ID.get();
-            *pmut_active = false;
+            m_active.clear(bsl::to_umax(mut_tls.ppid));
 
             return bsl::errc_success;
         }
@@ -589,17 +588,14 @@ namespace mk
         [[nodiscard]] constexpr auto
         is_active(tls_t const &tls) const noexcept -> bsl::safe_uint16
         {
-            auto const online_pps{m_active.size().min(bsl::to_umax(tls.online_pps))};
-
-            for (bsl::safe_uintmax mut_i{}; mut_i < online_pps; ++mut_i) {
-                if (*m_active.at_if(mut_i)) {
-                    return bsl::to_u16(mut_i);
-                }
+            bsl::discard(tls);
 
-                bsl::touch();
+            auto const ppid{m_active.first_set()};
+            if (!ppid) {
+                return bsl::safe_uint16::failure();
             }
 
-            return bsl::safe_uint16::failure();
+            return bsl::to_u16(ppid);
         }
 
         /// <!-- description -->
@@ -614,10 +610,9 @@ namespace mk
         [[nodiscard]] constexpr auto
         is_active_on_current_pp(tls_t const &tls) const noexcept -> bool
         {
-            auto const *const active{m_active.at_if(bsl::to_umax(tls.ppid))};
-            if (bsl::unlikely(nullptr == active)) {
+            if (bsl::unlikely(bsl::to_umax(tls.ppid) >= HYPERVISOR_MAX_PPS)) {
                 bsl::error() << "tls.ppid "                                   // --
-                             << bsl::hex(m_id)                                // --
+                             << bsl::hex(tls.ppid)                            // --
                              << " is greater than the HYPERVISOR_MAX_PPS "    // --
                              << bsl::hex(HYPERVISOR_MAX_PPS)                  // --
                              << bsl::endl                                     // --
@@ -626,7 +621,7 @@ namespace mk
                 return false;
             }
 
-            return *active;
+            return m_active.is_set(bsl::to_umax(tls.ppid));
         }
 
         /// <!-- description -->
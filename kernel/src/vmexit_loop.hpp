@@ -25,13 +25,17 @@
 #ifndef VMEXIT_LOOP_HPP
 #define VMEXIT_LOOP_HPP
 
+#include <dispatch_exit_filter.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
+#include <trace_ring_t.hpp>
+#include <trace_ring_write.hpp>
 #include <vmexit_log_t.hpp>
 #include <vps_pool_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/exit_code.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -57,6 +61,8 @@ namespace mk
         ext_t &mut_ext,
         vmexit_log_t &mut_log) noexcept -> bsl::exit_code
     {
+        trace_ring_write(mut_tls, loader::TRACE_EVENT_VMENTRY);
+
         auto const exit_reason{
             mut_vps_pool.run(mut_tls, mut_intrinsic, mut_log, bsl::to_u16(mut_tls.active_vpsid))};
         if (bsl::unlikely(!exit_reason)) {
@@ -64,6 +70,20 @@ namespace mk
             return bsl::exit_failure;
         }
 
+        trace_ring_write(mut_tls, loader::TRACE_EVENT_VMEXIT, exit_reason);
+
+        /// NOTE:
+        /// - VMExits that the extension registered an exit filter for are
+        ///   handled here without calling the extension, which saves the
+        ///   cost of switching to the extension and back.
+        ///
+
+        if (dispatch_exit_filter(mut_tls, mut_intrinsic, mut_vps_pool, exit_reason)) {
+            return bsl::exit_success;
+        }
+
+        bsl::touch();
+
         auto const ret{mut_ext.vmexit(mut_tls, mut_intrinsic, exit_reason)};
         if (bsl::unlikely(!ret)) {
             bsl::print<bsl::V>() << bsl::here();
@@ -25,8 +25,7 @@
 #ifndef VP_POOL_T_HPP
 #define VP_POOL_T_HPP
 
-#include "lock_guard_t.hpp"
-#include "spinlock_t.hpp"
+#include "id_bitmap_t.hpp"
 
 #include <bf_constants.hpp>
 #include <tls_t.hpp>
@@ -49,12 +48,22 @@ namespace mk
     /// <!-- description -->
     ///   @brief Defines the microkernel's VP pool
     ///
+    /// <!-- notes -->
+    ///   @note The IDs of the vp_ts that are not free (i.e., allocated or
+    ///     zombies) are tracked using an id_bitmap_t, which is how a free
+    ///     vp_t is found without a lock or a search of the entire pool.
+    ///     Each VM also has an id_bitmap_t of the vp_ts that are assigned
+    ///     to it, which is how is_assigned_to_vm() answers without a
+    ///     search of the entire pool.
+    ///
     class vp_pool_t final
     {
         /// @brief stores the pool of vp_ts
         bsl::array<vp_t, HYPERVISOR_MAX_VPS.get()> m_pool{};
-        /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock{};
+        /// @brief stores which of the vp_ts are not free
+        id_bitmap_t<HYPERVISOR_MAX_VPS.get()> m_ids{};
+        /// @brief stores which of the vp_ts are assigned to each VM
+        bsl::array<id_bitmap_t<HYPERVISOR_MAX_VPS.get()>, HYPERVISOR_MAX_VMS.get()> m_assigned{};
 
     public:
         /// <!-- description -->
@@ -134,24 +143,34 @@ namespace mk
             tls_t const &tls, bsl::safe_uint16 const &vmid, bsl::safe_uint16 const &ppid) noexcept
             -> bsl::safe_uint16
         {
-            lock_guard_t mut_lock{tls, m_lock};
+            auto const id{m_ids.allocate()};
+            if (bsl::unlikely(!id)) {
+                bsl::error() << "vp pool out of vps\n" << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
 
-            vp_t *pmut_mut_vp{};
-            for (auto const elem : m_pool) {
-                if (elem.data->is_deallocated()) {
-                    pmut_mut_vp = elem.data;
-                    break;
+            auto *const pmut_vp{m_pool.at_if(id)};
+            auto const vpid{pmut_vp->allocate(tls, vmid, ppid)};
+            if (bsl::unlikely(!vpid)) {
+                if (!pmut_vp->is_zombie()) {
+                    m_ids.clear(id);
+                }
+                else {
+                    bsl::touch();
                 }
 
-                bsl::touch();
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uint16::failure();
             }
 
-            if (bsl::unlikely(nullptr == pmut_mut_vp)) {
-                bsl::error() << "vp pool out of vps\n" << bsl::here();
+            auto *const pmut_assigned{m_assigned.at_if(bsl::to_umax(vmid))};
+            if (bsl::unlikely_assert(nullptr == pmut_assigned)) {
+                bsl::error() << "invalid vmid\n" << bsl::here();
                 return bsl::safe_uint16::failure();
             }
 
-            return pmut_mut_vp->allocate(tls, vmid, ppid);
+            pmut_assigned->set(id);
+            return vpid;
         }
 
         /// <!-- description -->
@@ -183,7 +202,24 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
-            return pmut_vp->deallocate(tls, vps_pool);
+            auto const vmid{pmut_vp->assigned_vm()};
+
+            auto const ret{pmut_vp->deallocate(tls, vps_pool)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            auto *const pmut_assigned{m_assigned.at_if(bsl::to_umax(vmid))};
+            if (bsl::unlikely_assert(nullptr == pmut_assigned)) {
+                bsl::error() << "invalid vmid\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            pmut_assigned->clear(bsl::to_umax(vpid));
+            m_ids.clear(bsl::to_umax(vpid));
+
+            return ret;
         }
 
         /// <!-- description -->
@@ -211,7 +247,20 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
+            /// NOTE:
+            /// - A zombie can never be allocated again, so its ID is
+            ///   marked as taken for good (which it already is if the
+            ///   vp_t was allocated when it was zombified).
+            ///
+
             pmut_vp->zombify();
+            if (pmut_vp->is_zombie()) {
+                m_ids.set(bsl::to_umax(vpid));
+            }
+            else {
+                bsl::touch();
+            }
+
             return bsl::errc_success;
         }
 
@@ -342,15 +391,18 @@ namespace mk
                 return bsl::safe_uint16::failure();
             }
 
-            for (auto const elem : m_pool) {
-                if (elem.data->assigned_vm() == vmid) {
-                    return elem.data->id();
-                }
+            auto const *const assigned{m_assigned.at_if(bsl::to_umax(vmid))};
+            if (bsl::unlikely_assert(nullptr == assigned)) {
+                bsl::error() << "invalid vmid\n" << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
 
-                bsl::touch();
+            auto const vpid{assigned->first_set()};
+            if (!vpid) {
+                return bsl::safe_uint16::failure();
             }
 
-            return bsl::safe_uint16::failure();
+            return bsl::to_u16(vpid);
         }
 
         /// <!-- description -->
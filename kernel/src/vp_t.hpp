@@ -25,6 +25,8 @@
 #ifndef VP_T_HPP
 #define VP_T_HPP
 
+#include "id_bitmap_t.hpp"
+
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <tls_t.hpp>
@@ -57,7 +59,28 @@ namespace mk
         /// @brief stores the ID of the PP this vp_t is assigned to
         bsl::safe_uint16 m_assigned_ppid{syscall::BF_INVALID_ID};
         /// @brief stores the ID of the PP this vp_t is active on
-        bsl::safe_uint16 m_active_ppid{bsl::safe_uint16::failure()};
+        id_bitmap_t<HYPERVISOR_MAX_PPS.get()> m_active{};
+
+        /// <!-- description -->
+        ///   @brief Returns the ID of the PP that this vp_t is active on.
+        ///     If the vp_t is inactive, this function returns
+        ///     bsl::safe_uint16::failure()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the ID of the PP that this vp_t is active on.
+        ///     If the vp_t is inactive, this function returns
+        ///     bsl::safe_uint16::failure()
+        ///
+        [[nodiscard]] constexpr auto
+        active_ppid() const noexcept -> bsl::safe_uint16
+        {
+            auto const ppid{m_active.first_set()};
+            if (!ppid) {
+                return bsl::safe_uint16::failure();
+            }
+
+            return bsl::to_u16(ppid);
+        }
 
     public:
         /// <!-- description -->
@@ -133,11 +156,12 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely(m_active_ppid)) {
+            auto const active_ppid{this->active_ppid()};
+            if (bsl::unlikely(active_ppid)) {
                 bsl::error() << "vp "                      // --
                              << bsl::hex(m_id)             // --
                              << " is active on pp "        // --
-                             << bsl::hex(m_active_ppid)    // --
+                             << bsl::hex(active_ppid)      // --
                              << " and therefore vp "       // --
                              << bsl::hex(m_id)             // --
                              << " cannot be destroyed"     // --
@@ -333,11 +357,12 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely(m_active_ppid)) {
+            auto const active_ppid{this->active_ppid()};
+            if (bsl::unlikely(active_ppid)) {
                 bsl::error() << "vp "                      // --
                              << bsl::hex(m_id)             // --
                              << " is active on pp "        // --
-                             << bsl::hex(m_active_ppid)    // --
+                             << bsl::hex(active_ppid)      // --
                              << " and therefore vp "       // --
                              << bsl::hex(m_id)             // --
                              << " cannot be destroyed"     // --
@@ -477,11 +502,12 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            if (bsl::unlikely(m_active_ppid)) {
+            auto const active_ppid{this->active_ppid()};
+            if (bsl::unlikely(active_ppid)) {
                 bsl::error() << "vp "                                 // --
                              << bsl::hex(m_id)                        // --
                              << " is already the active vp on pp "    // --
-                             << bsl::hex(m_active_ppid)               // --
+                             << bsl::hex(active_ppid)                 // --
                              << bsl::endl                             // --
                              << bsl::here();                          // --
 
@@ -489,7 +515,7 @@ namespace mk
             }
 
             mut_tls.active_vpid = m_id.get();
-            m_active_ppid = mut_tls.ppid;
+            m_active.set(bsl::to_umax(mut_tls.ppid));
 
             return bsl::errc_success;
         }
@@ -542,7 +568,7 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            if (bsl::unlikely_assert(!m_active_ppid)) {
+            if (bsl::unlikely_assert(!this->active_ppid())) {
                 bsl::error() << "vp "                // --
                              << bsl::hex(m_id)       // --
                              << " is not active "    // --
@@ -552,7 +578,7 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            if (bsl::unlikely_assert(mut_tls.ppid != m_active_ppid)) {
+            if (bsl::unlikely_assert(!m_active.is_set(bsl::to_umax(mut_tls.ppid)))) {
                 bsl::error() << "vp "                      // --
                              << bsl::hex(m_id)             // --
                              << " is not active on pp "    // --
@@ -564,7 +590,7 @@ namespace mk
             }
 
             mut_tls.active_vpid = syscall::BF_INVALID_ID.get();
-            m_active_ppid = bsl::safe_uint16::failure();
+            m_active.clear(bsl::to_umax(mut_tls.ppid));
 
             return bsl::errc_success;
         }
@@ -584,7 +610,7 @@ namespace mk
         is_active(tls_t const &tls) const noexcept -> bsl::safe_uint16
         {
             bsl::discard(tls);
-            return m_active_ppid;
+            return this->active_ppid();
         }
 
         /// <!-- description -->
@@ -599,7 +625,7 @@ namespace mk
         [[nodiscard]] constexpr auto
         is_active_on_current_pp(tls_t const &tls) const noexcept -> bool
         {
-            return tls.ppid == m_active_ppid;
+            return m_active.is_set(bsl::to_umax(tls.ppid));
         }
 
         /// <!-- description -->
@@ -676,11 +702,12 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            if (bsl::unlikely(m_active_ppid)) {
+            auto const active_ppid{this->active_ppid()};
+            if (bsl::unlikely(active_ppid)) {
                 bsl::error() << "vp "                        // --
                              << bsl::hex(m_id)               // --
                              << " is still active on pp "    // --
-                             << bsl::hex(m_active_ppid)      // --
+                             << bsl::hex(active_ppid)        // --
                              << bsl::endl                    // --
                              << bsl::here();                 // --
 
@@ -25,10 +25,11 @@
 #ifndef VPS_POOL_T_HPP
 #define VPS_POOL_T_HPP
 
-#include "lock_guard_t.hpp"
-#include "spinlock_t.hpp"
+#include "exit_filter_table_t.hpp"
+#include "id_bitmap_t.hpp"
 
 #include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
 #include <bf_reg_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
@@ -40,6 +41,7 @@
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally_assert.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unlikely_assert.hpp>
 
@@ -52,12 +54,24 @@ namespace mk
     /// <!-- description -->
     ///   @brief Defines the microkernel's VPS pool
     ///
+    /// <!-- notes -->
+    ///   @note The IDs of the vps_ts that are not free (i.e., allocated or
+    ///     zombies) are tracked using an id_bitmap_t, which is how a free
+    ///     vps_t is found without a lock or a search of the entire pool.
+    ///     Each VP also has an id_bitmap_t of the vps_ts that are assigned
+    ///     to it, which is how is_assigned_to_vp() answers without a
+    ///     search of the entire pool.
+    ///
     class vps_pool_t final
     {
         /// @brief stores the pool of vps_ts
         bsl::array<vps_t, HYPERVISOR_MAX_VPSS.get()> m_pool{};
-        /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock{};
+        /// @brief stores which of the vps_ts are not free
+        id_bitmap_t<HYPERVISOR_MAX_VPSS.get()> m_ids{};
+        /// @brief stores which of the vps_ts are assigned to each VP
+        bsl::array<id_bitmap_t<HYPERVISOR_MAX_VPSS.get()>, HYPERVISOR_MAX_VPS.get()> m_assigned{};
+        /// @brief stores the exit filters of each vps_t
+        bsl::array<exit_filter_table_t, HYPERVISOR_MAX_VPSS.get()> m_exit_filters{};
 
     public:
         /// <!-- description -->
@@ -143,24 +157,34 @@ namespace mk
             bsl::safe_uint16 const &vpid,
             bsl::safe_uint16 const &ppid) noexcept -> bsl::safe_uint16
         {
-            lock_guard_t mut_lock{mut_tls, m_lock};
+            auto const id{m_ids.allocate()};
+            if (bsl::unlikely(!id)) {
+                bsl::error() << "vps pool out of vpss\n" << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
 
-            vps_t *pmut_mut_vps{};
-            for (auto const elem : m_pool) {
-                if (elem.data->is_deallocated()) {
-                    pmut_mut_vps = elem.data;
-                    break;
+            auto *const pmut_vps{m_pool.at_if(id)};
+            auto const vpsid{pmut_vps->allocate(mut_tls, mut_intrinsic, mut_page_pool, vpid, ppid)};
+            if (bsl::unlikely(!vpsid)) {
+                if (!pmut_vps->is_zombie()) {
+                    m_ids.clear(id);
+                }
+                else {
+                    bsl::touch();
                 }
 
-                bsl::touch();
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uint16::failure();
             }
 
-            if (bsl::unlikely(nullptr == pmut_mut_vps)) {
-                bsl::error() << "vps pool out of vpss\n" << bsl::here();
+            auto *const pmut_assigned{m_assigned.at_if(bsl::to_umax(vpid))};
+            if (bsl::unlikely_assert(nullptr == pmut_assigned)) {
+                bsl::error() << "invalid vpid\n" << bsl::here();
                 return bsl::safe_uint16::failure();
             }
 
-            return pmut_mut_vps->allocate(mut_tls, mut_intrinsic, mut_page_pool, vpid, ppid);
+            pmut_assigned->set(id);
+            return vpsid;
         }
 
         /// <!-- description -->
@@ -192,7 +216,25 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
-            return pmut_vps->deallocate(mut_tls, mut_page_pool);
+            auto const vpid{pmut_vps->assigned_vp()};
+
+            auto const ret{pmut_vps->deallocate(mut_tls, mut_page_pool)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            auto *const pmut_assigned{m_assigned.at_if(bsl::to_umax(vpid))};
+            if (bsl::unlikely_assert(nullptr == pmut_assigned)) {
+                bsl::error() << "invalid vpid\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            pmut_assigned->clear(bsl::to_umax(vpsid));
+            m_exit_filters.at_if(bsl::to_umax(vpsid))->clear();
+            m_ids.clear(bsl::to_umax(vpsid));
+
+            return ret;
         }
 
         /// <!-- description -->
@@ -220,7 +262,20 @@ namespace mk
                 return bsl::errc_index_out_of_bounds;
             }
 
+            /// NOTE:
+            /// - A zombie can never be allocated again, so its ID is
+            ///   marked as taken for good (which it already is if the
+            ///   vps_t was allocated when it was zombified).
+            ///
+
             pmut_vps->zombify();
+            if (pmut_vps->is_zombie()) {
+                m_ids.set(bsl::to_umax(vpsid));
+            }
+            else {
+                bsl::touch();
+            }
+
             return bsl::errc_success;
         }
 
@@ -351,15 +406,18 @@ namespace mk
                 return bsl::safe_uint16::failure();
             }
 
-            for (auto const elem : m_pool) {
-                if (elem.data->assigned_vp() == vpid) {
-                    return elem.data->id();
-                }
+            auto const *const assigned{m_assigned.at_if(bsl::to_umax(vpid))};
+            if (bsl::unlikely(nullptr == assigned)) {
+                bsl::error() << "invalid vpid\n" << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
 
-                bsl::touch();
+            auto const vpsid{assigned->first_set()};
+            if (!vpsid) {
+                return bsl::safe_uint16::failure();
             }
 
-            return bsl::safe_uint16::failure();
+            return bsl::to_u16(vpsid);
         }
 
         /// <!-- description -->
@@ -778,6 +836,142 @@ namespace mk
             return pmut_vps->advance_ip(mut_tls, mut_intrinsic);
         }
 
+        /// <!-- description -->
+        ///   @brief Replaces the exit filters of the requested VPS with the
+        ///     provided exit filters. An empty list removes all of the
+        ///     exit filters, handing every VMExit to the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param vpsid the ID of the VPS to set the exit filters for
+        ///   @param filters the exit filters to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_exit_filters(
+            tls_t const &tls,
+            bsl::safe_uint16 const &vpsid,
+            bsl::span<syscall::bf_exit_filter_t const> const &filters) noexcept -> bsl::errc_type
+        {
+            auto const *const vps{m_pool.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely(nullptr == vps)) {
+                bsl::error()
+                    << "vpsid "                                                              // --
+                    << bsl::hex(vpsid)                                                       // --
+                    << " is invalid or greater than or equal to the HYPERVISOR_MAX_VPSS "    // --
+                    << bsl::hex(HYPERVISOR_MAX_VPSS)                                         // --
+                    << bsl::endl                                                             // --
+                    << bsl::here();                                                          // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!vps->is_allocated())) {
+                bsl::error() << "vps "                 // --
+                             << bsl::hex(vpsid)        // --
+                             << " is not allocated"    // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - The filters are read by the PP that the VPS is active on
+            ///   without a lock, so they can only be changed by that PP,
+            ///   or while the VPS is not active at all.
+            ///
+
+            auto const active_ppid{vps->is_active(tls)};
+            if (bsl::unlikely(active_ppid && !vps->is_active_on_current_pp(tls))) {
+                bsl::error() << "vps "                                   // --
+                             << bsl::hex(vpsid)                          // --
+                             << " is active on pp "                      // --
+                             << bsl::hex(active_ppid)                    // --
+                             << " and its exit filters cannot be set"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
+
+                return bsl::errc_failure;
+            }
+
+            return m_exit_filters.at_if(bsl::to_umax(vpsid))->set(filters);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first exit filter of the
+        ///     requested VPS that matches the provided VMExit, or
+        ///     bsl::safe_uintmax::failure() if no filter matched.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid the ID of the VPS that generated the VMExit
+        ///   @param exit_reason the exit reason of the VMExit
+        ///   @param qual the exit qualification of the VMExit
+        ///   @param regs the guest's ECX:EAX
+        ///   @return Returns the index of the first exit filter of the
+        ///     requested VPS that matches the provided VMExit, or
+        ///     bsl::safe_uintmax::failure() if no filter matched.
+        ///
+        [[nodiscard]] constexpr auto
+        match_exit_filter(
+            bsl::safe_uint16 const &vpsid,
+            bsl::safe_uintmax const &exit_reason,
+            bsl::safe_uintmax const &qual,
+            bsl::safe_uintmax const &regs) noexcept -> bsl::safe_uintmax
+        {
+            auto *const pmut_filters{m_exit_filters.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely_assert(nullptr == pmut_filters)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            return pmut_filters->match(exit_reason, qual, regs);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested exit filter of the requested VPS,
+        ///     or a nullptr if the VPS ID or the index is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid the ID of the VPS to get the exit filter from
+        ///   @param idx the index of the exit filter to get
+        ///   @return Returns the requested exit filter of the requested VPS,
+        ///     or a nullptr if the VPS ID or the index is invalid.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_filter(bsl::safe_uint16 const &vpsid, bsl::safe_uintmax const &idx) const noexcept
+            -> syscall::bf_exit_filter_t const *
+        {
+            auto const *const filters{m_exit_filters.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely_assert(nullptr == filters)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return nullptr;
+            }
+
+            return filters->at(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hit for the requested exit filter of the
+        ///     requested VPS (see exit_filter_table_t::record_hit).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid the ID of the VPS the exit filter belongs to
+        ///   @param idx the index of the exit filter that was used
+        ///
+        constexpr void
+        record_exit_filter_hit(bsl::safe_uint16 const &vpsid, bsl::safe_uintmax const &idx) noexcept
+        {
+            auto *const pmut_filters{m_exit_filters.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely_assert(nullptr == pmut_filters)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return;
+            }
+
+            pmut_filters->record_hit(idx);
+        }
+
         /// <!-- description -->
         ///   @brief Clears the requested VPS's internal cache. Note that this
         ///     is a hardware specific function and doesn't change the actual
@@ -840,6 +1034,7 @@ namespace mk
             }
 
             vps->dump(mut_tls, intrinsic);
+            m_exit_filters.at_if(bsl::to_umax(vpsid))->dump();
         }
     };
 }
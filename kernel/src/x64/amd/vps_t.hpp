@@ -29,9 +29,12 @@
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <fpu_t.hpp>
 #include <general_purpose_regs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <timestamp.hpp>
+#include <tlb_tag_t.hpp>
 #include <tls_t.hpp>
 #include <vmcb_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -84,6 +87,40 @@ namespace mk
         return (attrib & mask1) | ((attrib & mask2) << shift);
     }
 
+    /// @brief defines the VMCB clean bit for the intercepts, TSC offset and pause filter
+    constexpr auto VMCB_CLEAN_I{0x00000001_u32};
+    /// @brief defines the VMCB clean bit for the IOPM and MSRPM base addresses
+    constexpr auto VMCB_CLEAN_IOPM{0x00000002_u32};
+    /// @brief defines the VMCB clean bit for the guest ASID
+    constexpr auto VMCB_CLEAN_ASID{0x00000004_u32};
+    /// @brief defines the VMCB clean bit for the virtual TPR and interrupt controls
+    constexpr auto VMCB_CLEAN_TPR{0x00000008_u32};
+    /// @brief defines the VMCB clean bit for nested paging (NP_ENABLE, nCR3, gPAT)
+    constexpr auto VMCB_CLEAN_NP{0x00000010_u32};
+    /// @brief defines the VMCB clean bit for CR0, CR3, CR4 and EFER
+    constexpr auto VMCB_CLEAN_CRX{0x00000020_u32};
+    /// @brief defines the VMCB clean bit for DR6 and DR7
+    constexpr auto VMCB_CLEAN_DRX{0x00000040_u32};
+    /// @brief defines the VMCB clean bit for the GDTR and IDTR
+    constexpr auto VMCB_CLEAN_DT{0x00000080_u32};
+    /// @brief defines the VMCB clean bit for CS, DS, SS, ES and the CPL
+    constexpr auto VMCB_CLEAN_SEG{0x00000100_u32};
+    /// @brief defines the VMCB clean bit for CR2
+    constexpr auto VMCB_CLEAN_CR2{0x00000200_u32};
+    /// @brief defines the VMCB clean bit for DBGCTL and the LBR MSRs
+    constexpr auto VMCB_CLEAN_LBR{0x00000400_u32};
+    /// @brief defines the VMCB clean bit for the AVIC fields
+    constexpr auto VMCB_CLEAN_AVIC{0x00000800_u32};
+    /// @brief defines all of the VMCB clean bits that the microkernel tracks
+    constexpr auto VMCB_CLEAN_ALL{0x00000FFF_u32};
+    /// @brief defines the exit code returned when VMRUN fails its consistency checks
+    constexpr auto VMEXIT_INVALID{0xFFFFFFFFFFFFFFFF_umax};
+
+    /// @brief defines the CPUID leaf that reports the number of ASIDs
+    constexpr auto CPUID_SVM_FEATURES{0x8000000A_u64};
+    /// @brief defines the TLB control value that flushes all ASIDs
+    constexpr auto TLB_CONTROL_FLUSH_ALL{0x1_u8};
+
     /// @class mk::vps_t
     ///
     /// <!-- description -->
@@ -112,6 +149,197 @@ namespace mk
         bsl::safe_uintmax m_host_vmcb_phys{bsl::safe_uintmax::failure()};
         /// @brief stores the general purpose registers
         general_purpose_regs_t m_gprs{};
+        /// @brief stores the ID of the PP the guest VMCB was last run on
+        bsl::safe_uint16 m_vmcb_ppid{bsl::safe_uint16::failure()};
+        /// @brief stores the ASID assigned to this VPS
+        tlb_tag_t m_tlb_tag{};
+        /// @brief stores the x87/SSE/AVX state of this VPS
+        fpu_t m_fpu{};
+
+        /// <!-- description -->
+        ///   @brief Returns the VMCB clean bits that must be cleared when
+        ///     the provided register is written. Registers that the CPU
+        ///     always reloads on VMRUN (e.g., RIP, RSP, RAX, RFLAGS and the
+        ///     VMLOAD state) return 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the bf_reg_t that is being written
+        ///   @return Returns the VMCB clean bits that must be cleared when
+        ///     the provided register is written.
+        ///
+        [[nodiscard]] static constexpr auto
+        vmcb_clean_bits_for(syscall::bf_reg_t const reg) noexcept -> bsl::safe_uint32
+        {
+            switch (reg) {
+                case syscall::bf_reg_t::bf_reg_t_intercept_cr_read:
+                case syscall::bf_reg_t::bf_reg_t_intercept_cr_write:
+                case syscall::bf_reg_t::bf_reg_t_intercept_dr_read:
+                case syscall::bf_reg_t::bf_reg_t_intercept_dr_write:
+                case syscall::bf_reg_t::bf_reg_t_intercept_exception:
+                case syscall::bf_reg_t::bf_reg_t_intercept_instruction1:
+                case syscall::bf_reg_t::bf_reg_t_intercept_instruction2:
+                case syscall::bf_reg_t::bf_reg_t_intercept_instruction3:
+                case syscall::bf_reg_t::bf_reg_t_pause_filter_threshold:
+                case syscall::bf_reg_t::bf_reg_t_pause_filter_count:
+                case syscall::bf_reg_t::bf_reg_t_tsc_offset: {
+                    return VMCB_CLEAN_I;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_iopm_base_pa:
+                case syscall::bf_reg_t::bf_reg_t_msrpm_base_pa: {
+                    return VMCB_CLEAN_IOPM;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_guest_asid: {
+                    return VMCB_CLEAN_ASID;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_virtual_interrupt_a: {
+                    return VMCB_CLEAN_TPR;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_ctls1:
+                case syscall::bf_reg_t::bf_reg_t_n_cr3:
+                case syscall::bf_reg_t::bf_reg_t_g_pat: {
+                    return VMCB_CLEAN_NP;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_efer:
+                case syscall::bf_reg_t::bf_reg_t_cr0:
+                case syscall::bf_reg_t::bf_reg_t_cr3:
+                case syscall::bf_reg_t::bf_reg_t_cr4: {
+                    return VMCB_CLEAN_CRX;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_dr6:
+                case syscall::bf_reg_t::bf_reg_t_dr7: {
+                    return VMCB_CLEAN_DRX;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_gdtr_selector:
+                case syscall::bf_reg_t::bf_reg_t_gdtr_attrib:
+                case syscall::bf_reg_t::bf_reg_t_gdtr_limit:
+                case syscall::bf_reg_t::bf_reg_t_gdtr_base:
+                case syscall::bf_reg_t::bf_reg_t_idtr_selector:
+                case syscall::bf_reg_t::bf_reg_t_idtr_attrib:
+                case syscall::bf_reg_t::bf_reg_t_idtr_limit:
+                case syscall::bf_reg_t::bf_reg_t_idtr_base: {
+                    return VMCB_CLEAN_DT;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_es_selector:
+                case syscall::bf_reg_t::bf_reg_t_es_attrib:
+                case syscall::bf_reg_t::bf_reg_t_es_limit:
+                case syscall::bf_reg_t::bf_reg_t_es_base:
+                case syscall::bf_reg_t::bf_reg_t_cs_selector:
+                case syscall::bf_reg_t::bf_reg_t_cs_attrib:
+                case syscall::bf_reg_t::bf_reg_t_cs_limit:
+                case syscall::bf_reg_t::bf_reg_t_cs_base:
+                case syscall::bf_reg_t::bf_reg_t_ss_selector:
+                case syscall::bf_reg_t::bf_reg_t_ss_attrib:
+                case syscall::bf_reg_t::bf_reg_t_ss_limit:
+                case syscall::bf_reg_t::bf_reg_t_ss_base:
+                case syscall::bf_reg_t::bf_reg_t_ds_selector:
+                case syscall::bf_reg_t::bf_reg_t_ds_attrib:
+                case syscall::bf_reg_t::bf_reg_t_ds_limit:
+                case syscall::bf_reg_t::bf_reg_t_ds_base:
+                case syscall::bf_reg_t::bf_reg_t_cpl: {
+                    return VMCB_CLEAN_SEG;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cr2: {
+                    return VMCB_CLEAN_CR2;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_ctls2:
+                case syscall::bf_reg_t::bf_reg_t_dbgctl:
+                case syscall::bf_reg_t::bf_reg_t_br_from:
+                case syscall::bf_reg_t::bf_reg_t_br_to:
+                case syscall::bf_reg_t::bf_reg_t_lastexcpfrom:
+                case syscall::bf_reg_t::bf_reg_t_lastexcpto: {
+                    return VMCB_CLEAN_LBR;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_avic_apic_bar:
+                case syscall::bf_reg_t::bf_reg_t_avic_apic_backing_page_ptr:
+                case syscall::bf_reg_t::bf_reg_t_avic_logical_table_ptr:
+                case syscall::bf_reg_t::bf_reg_t_avic_physical_table_ptr: {
+                    return VMCB_CLEAN_AVIC;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the provided VMCB clean bits, telling the CPU
+        ///     that it must reload the associated VMCB fields on the
+        ///     next VMRUN.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bits the VMCB clean bits to clear
+        ///
+        constexpr void
+        mark_vmcb_dirty(bsl::safe_uint32 const &bits) noexcept
+        {
+            m_guest_vmcb->vmcb_clean_bits &= (~bits).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives this VPS a new ASID if the ASID it has is stale
+        ///     (i.e., it has never run, it was last run on a different PP,
+        ///     or the current PP ran out of ASIDs). If the current PP ran
+        ///     out of ASIDs, the TLB control field is set so that the next
+        ///     VMRUN flushes all ASIDs before any of them are used again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsics to use
+        ///   @return Returns true if the TLB control field was changed and
+        ///     must be restored after the next VMRUN, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        update_asid(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept -> bool
+        {
+            if (!m_tlb_tag.is_stale(mut_tls)) {
+                return false;
+            }
+
+            bsl::safe_uint64 mut_rax{CPUID_SVM_FEATURES};
+            bsl::safe_uint64 mut_rbx{};
+            bsl::safe_uint64 mut_rcx{};
+            bsl::safe_uint64 mut_rdx{};
+            mut_intrinsic.cpuid(mut_rax, mut_rbx, mut_rcx, mut_rdx);
+
+            /// NOTE:
+            /// - CPUID reports the number of ASIDs, and ASID 0 is reserved
+            ///   for the host, so the largest ASID is one less.
+            ///
+
+            bool mut_flush_all{};
+            if (mut_rbx > TLB_TAG_MIN) {
+                mut_flush_all = m_tlb_tag.assign(mut_tls, bsl::to_umax(mut_rbx) - 1_umax);
+            }
+            else {
+                mut_flush_all = m_tlb_tag.assign(mut_tls, TLB_TAG_MIN);
+            }
+
+            m_guest_vmcb->guest_asid = bsl::to_u32(m_tlb_tag.get()).get();
+            this->mark_vmcb_dirty(VMCB_CLEAN_ASID);
+
+            if (mut_flush_all) {
+                m_guest_vmcb->tlb_control = TLB_CONTROL_FLUSH_ALL.get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_flush_all;
+        }
 
         /// <!-- description -->
         ///   @brief Returns the row color based on the value of "val"
@@ -174,6 +402,88 @@ namespace mk
             bsl::print() << bsl::rst << bsl::endl;
         }
 
+        /// <!-- description -->
+        ///   @brief Copies the information about the VMExit that just
+        ///     occurred into the extension's TLS block, which allows an
+        ///     extension to handle most VMExits without using the read
+        ///     syscalls. On AMD, the qualification is exitinfo1, the
+        ///     instruction information is exitinfo2 and the instruction
+        ///     length is nrip - rip (or 0 if nrip is not provided).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @param exit_reason the exit reason of the VMExit
+        ///
+        constexpr void
+        exit_info_to_tls(intrinsic_t const &intrinsic, bsl::safe_uintmax const &exit_reason)
+            const noexcept
+        {
+            auto const rip{bsl::to_u64(m_guest_vmcb->rip)};
+            auto const nrip{bsl::to_u64(m_guest_vmcb->nrip)};
+
+            bsl::safe_uint64 mut_len{};
+            if (nrip > rip) {
+                mut_len = nrip - rip;
+            }
+            else {
+                bsl::touch();
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_REASON, bsl::to_u64(exit_reason));
+            intrinsic.set_tls_reg(
+                syscall::TLS_OFFSET_EXIT_QUALIFICATION, bsl::to_u64(m_guest_vmcb->exitinfo1));
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_INSTR_LEN, mut_len);
+            intrinsic.set_tls_reg(
+                syscall::TLS_OFFSET_EXIT_INSTR_INFO, bsl::to_u64(m_guest_vmcb->exitinfo2));
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_RIP, rip);
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_RSP, bsl::to_u64(m_guest_vmcb->rsp));
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_RFLAGS, bsl::to_u64(m_guest_vmcb->rflags));
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_CR3, bsl::to_u64(m_guest_vmcb->cr3));
+
+            auto const seq{intrinsic.tls_reg(syscall::TLS_OFFSET_EXIT_SEQ)};
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_SEQ, seq + 1_u64);
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes any fields that the extension marked as dirty
+        ///     in its TLS block back to this VPS, and then clears the
+        ///     dirty mask.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///
+        constexpr void
+        write_back_from_tls(intrinsic_t const &intrinsic) noexcept
+        {
+            auto const dirty{intrinsic.tls_reg(syscall::TLS_OFFSET_DIRTY)};
+            if (dirty.is_zero()) {
+                return;
+            }
+
+            if (!(dirty & syscall::TLS_DIRTY_RIP).is_zero()) {
+                m_guest_vmcb->rip = intrinsic.tls_reg(syscall::TLS_OFFSET_RIP).get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!(dirty & syscall::TLS_DIRTY_RSP).is_zero()) {
+                m_guest_vmcb->rsp = intrinsic.tls_reg(syscall::TLS_OFFSET_RSP).get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!(dirty & syscall::TLS_DIRTY_RFLAGS).is_zero()) {
+                m_guest_vmcb->rflags = intrinsic.tls_reg(syscall::TLS_OFFSET_RFLAGS).get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_DIRTY, {});
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this vps_t
@@ -247,6 +557,9 @@ namespace mk
             }
 
             m_gprs = {};
+            m_vmcb_ppid = bsl::safe_uint16::failure();
+            m_tlb_tag.reset();
+            m_fpu.deallocate(mut_tls, mut_page_pool);
 
             m_host_vmcb_phys = bsl::safe_uintmax::failure();
             mut_page_pool.deallocate(mut_tls, m_host_vmcb, ALLOCATE_TAG_HOST_VMCB);
@@ -386,6 +699,7 @@ namespace mk
             }
 
             bsl::finally mut_cleanup_on_error{[this, &mut_tls, &mut_page_pool]() noexcept -> void {
+                m_fpu.deallocate(mut_tls, mut_page_pool);
                 m_host_vmcb_phys = bsl::safe_uintmax::failure();
                 mut_page_pool.deallocate(mut_tls, m_host_vmcb, ALLOCATE_TAG_HOST_VMCB);
                 m_host_vmcb = {};
@@ -420,6 +734,11 @@ namespace mk
                 return bsl::safe_uint16::failure();
             }
 
+            if (bsl::unlikely(!m_fpu.allocate(mut_tls, mut_page_pool))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
+
             m_assigned_vpid = vpid;
             m_assigned_ppid = ppid;
             m_allocated = allocated_status_t::allocated;
@@ -484,6 +803,9 @@ namespace mk
             }
 
             m_gprs = {};
+            m_vmcb_ppid = bsl::safe_uint16::failure();
+            m_tlb_tag.reset();
+            m_fpu.deallocate(mut_tls, mut_page_pool);
 
             m_host_vmcb_phys = bsl::safe_uintmax::failure();
             mut_page_pool.deallocate(mut_tls, m_host_vmcb, ALLOCATE_TAG_HOST_VMCB);
@@ -743,6 +1065,9 @@ namespace mk
             m_gprs.r14 = intrinsic.tls_reg(syscall::TLS_OFFSET_R14).get();
             m_gprs.r15 = intrinsic.tls_reg(syscall::TLS_OFFSET_R15).get();
 
+            this->write_back_from_tls(intrinsic);
+            m_fpu.save(mut_tls, intrinsic);
+
             mut_tls.active_vpsid = syscall::BF_INVALID_ID.get();
             m_active_ppid = bsl::safe_uint16::failure();
 
@@ -952,6 +1277,8 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
+            m_fpu.init_as_root(tls, mut_intrinsic);
+
             if (tls.active_vpsid == m_id) {
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, bsl::to_u64(state.rax));
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RBX, bsl::to_u64(state.rbx));
@@ -1057,6 +1384,10 @@ namespace mk
             m_guest_vmcb->g_pat = state.ia32_pat;
             m_guest_vmcb->dbgctl = state.ia32_debugctl;
 
+            this->mark_vmcb_dirty(
+                VMCB_CLEAN_NP | VMCB_CLEAN_CRX | VMCB_CLEAN_DRX | VMCB_CLEAN_DT | VMCB_CLEAN_SEG |
+                VMCB_CLEAN_CR2 | VMCB_CLEAN_LBR);
+
             return bsl::errc_success;
         }
 
@@ -1064,7 +1395,7 @@ namespace mk
         ///   @brief Stores the VPS state in the provided state save.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param tls the current TLS block
+        ///   @param mut_tls the current TLS block
         ///   @param intrinsic the intrinsics to use
         ///   @param mut_state the state save to store the VPS state to
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
@@ -1072,7 +1403,7 @@ namespace mk
         ///
         [[nodiscard]] constexpr auto
         vps_to_state_save(
-            tls_t const &tls,
+            tls_t &mut_tls,
             intrinsic_t const &intrinsic,
             loader::state_save_t &mut_state) const noexcept -> bsl::errc_type
         {
@@ -1091,20 +1422,22 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
-            if (bsl::unlikely(tls.ppid != m_assigned_ppid)) {
+            if (bsl::unlikely(mut_tls.ppid != m_assigned_ppid)) {
                 bsl::error() << "vp "                                  // --
                              << bsl::hex(m_id)                         // --
                              << " is assigned to pp "                  // --
                              << bsl::hex(m_assigned_ppid)              // --
                              << " and cannot be operated on by pp "    // --
-                             << bsl::hex(tls.ppid)                     // --
+                             << bsl::hex(mut_tls.ppid)                     // --
                              << bsl::endl                              // --
                              << bsl::here();                           // --
 
                 return bsl::errc_precondition;
             }
 
-            if (tls.active_vpsid == m_id) {
+            m_fpu.promote(mut_tls, intrinsic);
+
+            if (mut_tls.active_vpsid == m_id) {
                 mut_state.rax = intrinsic.tls_reg(syscall::TLS_OFFSET_RAX).get();
                 mut_state.rbx = intrinsic.tls_reg(syscall::TLS_OFFSET_RBX).get();
                 mut_state.rcx = intrinsic.tls_reg(syscall::TLS_OFFSET_RCX).get();
@@ -1833,6 +2166,8 @@ namespace mk
                 return bsl::errc_precondition;
             }
 
+            this->mark_vmcb_dirty(vmcb_clean_bits_for(reg));
+
             switch (reg) {
                 case syscall::bf_reg_t::bf_reg_t_rax: {
                     if (tls.active_vpsid == m_id) {
@@ -2051,6 +2386,7 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_guest_asid: {
                     m_guest_vmcb->guest_asid = bsl::to_u32(val).get();
+                    m_tlb_tag.reset();
                     return bsl::errc_success;
                 }
 
@@ -2494,18 +2830,16 @@ namespace mk
         ///     will return the VMExit reason.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param tls the current TLS block
+        ///   @param mut_tls the current TLS block
         ///   @param mut_intrinsic the intrinsics to use
         ///   @param mut_log the VMExit log to use
         ///   @return Returns the VMExit reason on success, or
         ///     bsl::safe_uintmax::failure() on failure.
         ///
         [[nodiscard]] constexpr auto
-        run(tls_t const &tls, intrinsic_t &mut_intrinsic, vmexit_log_t &mut_log) noexcept
+        run(tls_t &mut_tls, intrinsic_t &mut_intrinsic, vmexit_log_t &mut_log) noexcept
             -> bsl::safe_uintmax
         {
-            bsl::discard(mut_intrinsic);
-
             if (bsl::unlikely_assert(!m_id)) {
                 bsl::error() << "vps_t not initialized\n" << bsl::here();
                 return bsl::safe_uintmax::failure();
@@ -2521,28 +2855,71 @@ namespace mk
                 return bsl::safe_uintmax::failure();
             }
 
-            if (bsl::unlikely_assert(tls.ppid != m_assigned_ppid)) {
+            if (bsl::unlikely_assert(mut_tls.ppid != m_assigned_ppid)) {
                 bsl::error() << "vp "                        // --
                              << bsl::hex(m_id)               // --
                              << " is assigned to pp "        // --
                              << bsl::hex(m_assigned_ppid)    // --
                              << " and cannot run by pp "     // --
-                             << bsl::hex(tls.ppid)           // --
+                             << bsl::hex(mut_tls.ppid)           // --
                              << bsl::endl                    // --
                              << bsl::here();                 // --
 
                 return bsl::safe_uintmax::failure();
             }
 
+            m_fpu.load(mut_tls, mut_intrinsic);
+
+            bsl::safe_uintmax mut_cycles{};
+            if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
+                mut_cycles = bsl::to_umax(timestamp());
+            }
+
+            this->write_back_from_tls(mut_intrinsic);
+
+            /// NOTE:
+            /// - The CPU is only allowed to use the VMCB state that it
+            ///   cached if the VMCB was last run on this same PP, so if
+            ///   this VPS was migrated, a full reload is forced.
+            ///
+
+            if (mut_tls.ppid != m_vmcb_ppid) {
+                this->mark_vmcb_dirty(VMCB_CLEAN_ALL);
+                m_vmcb_ppid = mut_tls.ppid;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const tlb_control{m_guest_vmcb->tlb_control};
+            bool const flushed_all{this->update_asid(mut_tls, mut_intrinsic)};
+
             bsl::safe_uintmax const exit_reason{intrinsic_vmrun(
                 m_guest_vmcb, m_guest_vmcb_phys.get(), m_host_vmcb, m_host_vmcb_phys.get())};
 
+            if (flushed_all) {
+                m_guest_vmcb->tlb_control = tlb_control;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(VMEXIT_INVALID == exit_reason)) {
+                this->mark_vmcb_dirty(VMCB_CLEAN_ALL);
+            }
+            else {
+                m_guest_vmcb->vmcb_clean_bits = VMCB_CLEAN_ALL.get();
+            }
+
+            this->exit_info_to_tls(mut_intrinsic, exit_reason);
+
             if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
+                mut_cycles = bsl::to_umax(timestamp()) - mut_cycles;
                 mut_log.add(
-                    bsl::to_u16(tls.ppid),
-                    {bsl::to_u16(tls.active_vmid),
-                     bsl::to_u16(tls.active_vpid),
-                     bsl::to_u16(tls.active_vpsid),
+                    bsl::to_u16(mut_tls.ppid),
+                    {bsl::to_u16(mut_tls.active_vmid),
+                     bsl::to_u16(mut_tls.active_vpid),
+                     bsl::to_u16(mut_tls.active_vpsid),
                      bsl::to_umax(exit_reason),
                      bsl::to_umax(m_guest_vmcb->exitinfo1),
                      bsl::to_umax(m_guest_vmcb->exitinfo2),
@@ -2563,7 +2940,8 @@ namespace mk
                      mut_intrinsic.tls_reg(syscall::TLS_OFFSET_R14),
                      mut_intrinsic.tls_reg(syscall::TLS_OFFSET_R15),
                      bsl::to_umax(m_guest_vmcb->rsp),
-                     bsl::to_umax(m_guest_vmcb->rip)});
+                     bsl::to_umax(m_guest_vmcb->rip),
+                     mut_cycles});
             }
 
             /// TODO:
@@ -25,6 +25,7 @@
 #ifndef DISPATCH_ESR_HPP
 #define DISPATCH_ESR_HPP
 
+#include <dispatch_esr_device_not_available.hpp>
 #include <dispatch_esr_nmi.hpp>
 #include <dispatch_esr_page_fault.hpp>
 #include <ext_t.hpp>
@@ -266,6 +267,14 @@ namespace mk
                 break;
             }
 
+            case EXCEPTION_VECTOR_7.get(): {
+                if (bsl::likely(dispatch_esr_device_not_available(mut_tls, mut_intrinsic))) {
+                    return bsl::exit_success;
+                }
+
+                break;
+            }
+
             case EXCEPTION_VECTOR_14.get(): {
                 if (bsl::likely(dispatch_esr_page_fault(mut_tls, mut_page_pool, pmut_ext))) {
                     return bsl::exit_success;
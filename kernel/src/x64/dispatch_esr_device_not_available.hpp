@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef DISPATCH_ESR_DEVICE_NOT_AVAILABLE_HPP
+#define DISPATCH_ESR_DEVICE_NOT_AVAILABLE_HPP
+
+#include <fpu_t.hpp>
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Provides the main entry point for #NM exceptions. The
+    ///     microkernel sets CR0.TS while the FPU contains a VPS's state
+    ///     that has not been saved yet (see fpu_t). If the microkernel or
+    ///     an extension uses a vector instruction, the VPS's state is
+    ///     saved, and the FPU is given to the host in its initial state
+    ///     (i.e., the host never sees the VPS's vector registers or MXCSR).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_intrinsic the intrinsics to use
+    ///   @return Returns bsl::errc_success if the exception was handled,
+    ///     bsl::errc_failure otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_esr_device_not_available(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        -> bsl::errc_type
+    {
+        /// NOTE:
+        /// - If CR0.TS was not set, this #NM was not caused by the lazy
+        ///   FPU switch and there is nothing we can do about it.
+        ///
+
+        if ((bsl::to_u64(mut_tls.esr_cr0) & FPU_CR0_TS).is_zero()) {
+            return bsl::errc_failure;
+        }
+
+        if (nullptr == mut_tls.fpu_owner) {
+            mut_intrinsic.clts();
+            return bsl::errc_success;
+        }
+
+        fpu_t::release(mut_tls, mut_intrinsic);
+        mut_intrinsic.xrstor_init(FPU_XSAVE_MASK);
+
+        return bsl::errc_success;
+    }
+}
+
+#endif
@@ -0,0 +1,186 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_EXIT_FILTER_HPP
+#define DISPATCH_EXIT_FILTER_HPP
+
+#include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+#include <vps_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+#include <bsl/unlikely_assert.hpp>
+
+namespace mk
+{
+    /// @brief the lower 32 bits of a 64 bit register
+    constexpr auto EXIT_FILTER_LOWER_MASK{0x00000000FFFFFFFF_u64};
+    /// @brief the upper 32 bits of a 64 bit register
+    constexpr auto EXIT_FILTER_UPPER_MASK{0xFFFFFFFF00000000_u64};
+    /// @brief the number of bits to shift to get the upper 32 bits
+    constexpr auto EXIT_FILTER_UPPER_SHIFT{32_u64};
+
+    /// <!-- description -->
+    ///   @brief Emulates CPUID for the active VPS. The guest's EAX and ECX
+    ///     are given to CPUID, and the lower half of each result is
+    ///     ANDed with its mask from the filter before it is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_intrinsic the intrinsics to use
+    ///   @param filter the filter that matched the VMExit
+    ///
+    constexpr void
+    exit_filter_cpuid(intrinsic_t &mut_intrinsic, syscall::bf_exit_filter_t const &filter) noexcept
+    {
+        auto mut_rax{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX)};
+        auto mut_rbx{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RBX)};
+        auto mut_rcx{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX)};
+        auto mut_rdx{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RDX)};
+
+        mut_intrinsic.cpuid(mut_rax, mut_rbx, mut_rcx, mut_rdx);
+
+        auto const data0{bsl::to_u64(filter.data0)};
+        auto const data1{bsl::to_u64(filter.data1)};
+
+        mut_rax &= (EXIT_FILTER_UPPER_MASK | (data0 & EXIT_FILTER_LOWER_MASK));
+        mut_rbx &= (EXIT_FILTER_UPPER_MASK | (data0 >> EXIT_FILTER_UPPER_SHIFT));
+        mut_rcx &= (EXIT_FILTER_UPPER_MASK | (data1 & EXIT_FILTER_LOWER_MASK));
+        mut_rdx &= (EXIT_FILTER_UPPER_MASK | (data1 >> EXIT_FILTER_UPPER_SHIFT));
+
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, mut_rax);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RBX, mut_rbx);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, mut_rcx);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RDX, mut_rdx);
+    }
+
+    /// <!-- description -->
+    ///   @brief Emulates RDMSR for the active VPS by returning the value
+    ///     stored in the filter in EDX:EAX.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_intrinsic the intrinsics to use
+    ///   @param filter the filter that matched the VMExit
+    ///
+    constexpr void
+    exit_filter_rdmsr(intrinsic_t &mut_intrinsic, syscall::bf_exit_filter_t const &filter) noexcept
+    {
+        auto const data0{bsl::to_u64(filter.data0)};
+
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, data0 & EXIT_FILTER_LOWER_MASK);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RDX, data0 >> EXIT_FILTER_UPPER_SHIFT);
+    }
+
+    /// <!-- description -->
+    ///   @brief Applies the exit filters of the active VPS to the VMExit
+    ///     that just occurred. If a filter handles the VMExit, the filter's
+    ///     action is emulated, the VPS's IP is advanced and the VMExit is
+    ///     complete, meaning the extension is never called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_intrinsic the intrinsics to use
+    ///   @param mut_vps_pool the VPS pool to use
+    ///   @param exit_reason the exit reason of the VMExit
+    ///   @return Returns true if the VMExit was handled by a filter, false
+    ///     if the VMExit must be handed to the extension.
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_exit_filter(
+        tls_t &mut_tls,
+        intrinsic_t &mut_intrinsic,
+        vps_pool_t &mut_vps_pool,
+        bsl::safe_uintmax const &exit_reason) noexcept -> bool
+    {
+        auto const vpsid{bsl::to_u16(mut_tls.active_vpsid)};
+
+        /// NOTE:
+        /// - The exit qualification was stored in the TLS block by the
+        ///   VPS when the VMExit occurred (see TLS_OFFSET_EXIT_QUALIFICATION),
+        ///   and the guest's GPRs are always in the TLS block while the VPS
+        ///   is active, so nothing needs to be read from the VMCS/VMCB.
+        ///
+
+        auto const qual{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_EXIT_QUALIFICATION)};
+        auto const rax{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX)};
+        auto const rcx{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX)};
+        auto const regs{(rcx << EXIT_FILTER_UPPER_SHIFT) | (rax & EXIT_FILTER_LOWER_MASK)};
+
+        auto const idx{mut_vps_pool.match_exit_filter(vpsid, exit_reason, qual, regs)};
+        if (!idx) {
+            return false;
+        }
+
+        auto const *const filter{mut_vps_pool.exit_filter(vpsid, idx)};
+        if (bsl::unlikely_assert(nullptr == filter)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return false;
+        }
+
+        if (syscall::BF_EXIT_FILTER_ACTION_EXT == bsl::to_u64(filter->action)) {
+            mut_vps_pool.record_exit_filter_hit(vpsid, idx);
+            return false;
+        }
+
+        /// NOTE:
+        /// - The IP is advanced before the GPRs are changed so that if
+        ///   it fails, the extension is given the VMExit untouched. The
+        ///   hit is only counted once the IP was advanced, so a VMExit
+        ///   that ends up with the extension is never reported as
+        ///   short-circuited.
+        ///
+
+        auto const ret{mut_vps_pool.advance_ip(mut_tls, mut_intrinsic, vpsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return false;
+        }
+
+        mut_vps_pool.record_exit_filter_hit(vpsid, idx);
+
+        switch (filter->action) {
+            case syscall::BF_EXIT_FILTER_ACTION_CPUID.get(): {
+                exit_filter_cpuid(mut_intrinsic, *filter);
+                break;
+            }
+
+            case syscall::BF_EXIT_FILTER_ACTION_RDMSR.get(): {
+                exit_filter_rdmsr(mut_intrinsic, *filter);
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif
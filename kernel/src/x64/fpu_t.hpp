@@ -0,0 +1,314 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef FPU_T_HPP
+#define FPU_T_HPP
+
+#include <allocate_tags.hpp>
+#include <intrinsic_t.hpp>
+#include <page_pool_t.hpp>
+#include <page_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief defines the XSAVE state components the microkernel switches
+    ///   (x87, SSE, AVX, opmask, ZMM_Hi256 and Hi16_ZMM). All of these fit
+    ///   in a single page using the standard format.
+    constexpr auto FPU_XSAVE_MASK{0x00000000000000E7_u64};
+    /// @brief defines the CR0.TS bit
+    constexpr auto FPU_CR0_TS{0x0000000000000008_u64};
+    /// @brief defines where MXCSR is stored in an XSAVE area
+    constexpr auto FPU_XSAVE_MXCSR_OFFSET{24_umax};
+    /// @brief defines where MXCSR_MASK is stored in an XSAVE area
+    constexpr auto FPU_XSAVE_MXCSR_MASK_OFFSET{28_umax};
+    /// @brief defines the power-on value of MXCSR (all exceptions masked)
+    constexpr auto FPU_MXCSR_INIT{0x00001F80_u32};
+    /// @brief defines the MXCSR_MASK stored in a new XSAVE area
+    constexpr auto FPU_MXCSR_MASK_INIT{0x0000FFFF_u32};
+
+    /// @class mk::fpu_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the x87/SSE/AVX state of a VPS and switches it
+    ///     lazily. After a VMExit, the VPS's state is left in the FPU and
+    ///     CR0.TS is set. If the microkernel or an extension never uses a
+    ///     vector instruction before the VPS is run again, nothing is
+    ///     saved or restored. The first vector instruction generates a
+    ///     #NM, which saves the VPS's state into its XSAVE area (see
+    ///     fpu_t::release) and gives the FPU to the host. The state is
+    ///     then restored the next time the VPS is run.
+    ///
+    ///     The TLS block's fpu_owner field points to the XSAVE area whose
+    ///     state is currently in the FPU and has not been saved yet, and
+    ///     CR0.TS is set only while fpu_owner is not a nullptr. A VPS's
+    ///     state is always saved before it is made inactive, so fpu_owner
+    ///     never points to a VPS that could be destroyed.
+    ///
+    ///     If CR4.OSXSAVE is not set, there is no XSAVE area and all of
+    ///     these functions do nothing.
+    ///
+    class fpu_t final
+    {
+        /// @brief stores the XSAVE area used to save the VPS's state
+        page_t *m_xsave{};
+
+        /// <!-- description -->
+        ///   @brief Stores the provided 32 bit value in the XSAVE area at
+        ///     the provided offset (the XSAVE area is little endian).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_area the XSAVE area to store the value in
+        ///   @param offset the offset in the XSAVE area to store it at
+        ///   @param val the value to store
+        ///
+        static constexpr void
+        set_u32(
+            page_t *const pmut_area,
+            bsl::safe_uintmax const &offset,
+            bsl::safe_uint32 const &val) noexcept
+        {
+            constexpr auto bytes{4_umax};
+            constexpr auto bits_per_byte{8_u32};
+            constexpr auto byte_mask{0xFF_u32};
+
+            for (bsl::safe_uintmax mut_i{}; mut_i < bytes; ++mut_i) {
+                auto const shift{bsl::to_u32(mut_i) * bits_per_byte};
+                auto const byte{bsl::to_u8((val >> shift) & byte_mask)};
+                *pmut_area->data.at_if(offset + mut_i) = byte.get();
+            }
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Saves the state in the FPU to the XSAVE area that owns
+        ///     it (if any), leaving the FPU to the host with CR0.TS clear.
+        ///     This is what the #NM handler executes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsics to use
+        ///
+        static constexpr void
+        release(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            if (nullptr == mut_tls.fpu_owner) {
+                return;
+            }
+
+            intrinsic.clts();
+            intrinsic.xsave(mut_tls.fpu_owner, FPU_XSAVE_MASK);
+            mut_tls.fpu_owner = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates the XSAVE area for this fpu_t. A newly
+        ///     allocated XSAVE area is zeroed, and XSTATE_BV being 0 tells
+        ///     XRSTOR to put every state component into its initial
+        ///     configuration. MXCSR is the exception, as XRSTOR always
+        ///     loads it from the XSAVE area, and an MXCSR of 0 unmasks
+        ///     every SIMD exception. MXCSR is therefore set to its power-on
+        ///     value, the same as the XSAVE area used by xrstor_init.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page pool to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        allocate(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept -> bsl::errc_type
+        {
+            if (bsl::to_umax(mut_tls.xsave_enabled).is_zero()) {
+                return bsl::errc_success;
+            }
+
+            m_xsave = mut_page_pool.template allocate<page_t>(mut_tls, ALLOCATE_TAG_XSAVE);
+            if (bsl::unlikely(nullptr == m_xsave)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            set_u32(m_xsave, FPU_XSAVE_MXCSR_OFFSET, FPU_MXCSR_INIT);
+            set_u32(m_xsave, FPU_XSAVE_MXCSR_MASK_OFFSET, FPU_MXCSR_MASK_INIT);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Deallocates the XSAVE area for this fpu_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page pool to use
+        ///
+        constexpr void
+        deallocate(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
+        {
+            if (nullptr == m_xsave) {
+                return;
+            }
+
+            if (mut_tls.fpu_owner == m_xsave) {
+                mut_tls.fpu_owner = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            mut_page_pool.deallocate(mut_tls, m_xsave, ALLOCATE_TAG_XSAVE);
+            m_xsave = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Saves the state that is currently in the FPU into this
+        ///     fpu_t's XSAVE area. This is used by init_as_root, as the
+        ///     state in the FPU is the root OS's state at that point.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsics to use
+        ///
+        constexpr void
+        init_as_root(tls_t const &tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            if (nullptr == m_xsave) {
+                return;
+            }
+
+            /// NOTE:
+            /// - If the FPU is owned by another VPS, the root OS's state
+            ///   has already been replaced, and the XSAVE area is left in
+            ///   its initial state.
+            ///
+
+            if (nullptr != tls.fpu_owner) {
+                return;
+            }
+
+            mut_intrinsic.xsave(m_xsave, FPU_XSAVE_MASK);
+        }
+
+        /// <!-- description -->
+        ///   @brief Makes sure the FPU contains this fpu_t's state and that
+        ///     CR0.TS is set. This must be called right before the VPS is
+        ///     run. If this fpu_t already owns the FPU (i.e., nothing used
+        ///     a vector instruction since the last VMExit), nothing needs
+        ///     to be done.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsics to use
+        ///
+        constexpr void
+        load(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            if (nullptr == m_xsave) {
+                return;
+            }
+
+            if (mut_tls.fpu_owner == m_xsave) {
+                return;
+            }
+
+            release(mut_tls, mut_intrinsic);
+            mut_intrinsic.xrstor(m_xsave, FPU_XSAVE_MASK);
+
+            mut_tls.fpu_owner = m_xsave;
+            mut_intrinsic.stts();
+        }
+
+        /// <!-- description -->
+        ///   @brief Saves this fpu_t's state if it is still in the FPU. This
+        ///     must be called when the VPS is made inactive.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsics to use
+        ///
+        constexpr void
+        save(tls_t &mut_tls, intrinsic_t const &intrinsic) const noexcept
+        {
+            if (nullptr == m_xsave) {
+                return;
+            }
+
+            if (mut_tls.fpu_owner != m_xsave) {
+                return;
+            }
+
+            release(mut_tls, intrinsic);
+        }
+
+        /// <!-- description -->
+        ///   @brief Makes sure the FPU contains this fpu_t's state before
+        ///     the VPS is promoted (i.e., when the microkernel is stopped
+        ///     and the root OS continues to execute without it).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsics to use
+        ///
+        constexpr void
+        promote(tls_t &mut_tls, intrinsic_t const &intrinsic) const noexcept
+        {
+            if (nullptr == m_xsave) {
+                return;
+            }
+
+            if (mut_tls.fpu_owner != m_xsave) {
+                release(mut_tls, intrinsic);
+                intrinsic.xrstor(m_xsave, FPU_XSAVE_MASK);
+            }
+            else {
+                intrinsic.clts();
+            }
+
+            mut_tls.fpu_owner = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the XSAVE area for this fpu_t, or a nullptr if
+        ///     XSAVE is not enabled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the XSAVE area for this fpu_t, or a nullptr if
+        ///     XSAVE is not enabled.
+        ///
+        [[nodiscard]] constexpr auto
+        xsave_area() const noexcept -> page_t const *
+        {
+            return m_xsave;
+        }
+    };
+}
+
+#endif
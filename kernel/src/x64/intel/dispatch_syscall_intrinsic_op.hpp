@@ -29,10 +29,12 @@
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
 #include <tls_t.hpp>
+#include <vps_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -71,14 +73,31 @@ namespace mk
     syscall_intrinsic_op_wrmsr(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
         -> syscall::bf_status_t
     {
-        auto const ret{mut_intrinsic.wrmsr(
-            bsl::to_u32_unsafe(mut_tls.ext_reg1), bsl::to_u64(mut_tls.ext_reg2))};
+        auto const msr{bsl::to_u32_unsafe(mut_tls.ext_reg1)};
+        auto const ret{mut_intrinsic.wrmsr(msr, bsl::to_u64(mut_tls.ext_reg2))};
 
         if (bsl::unlikely(!ret)) {
             bsl::print<bsl::V>() << bsl::here();
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
         }
 
+        /// NOTE:
+        /// - intrinsic_vmrun only writes the guest's IA32_CSTAR and
+        ///   IA32_KERNEL_GS_BASE when they are different from what the
+        ///   TLS block says is loaded, so the TLS block has to be kept
+        ///   up to date.
+        ///
+
+        if (IA32_CSTAR == msr) {
+            mut_tls.ia32_cstar = mut_tls.ext_reg2;
+        }
+        else if (IA32_KERNEL_GS_BASE == msr) {
+            mut_tls.ia32_kernel_gs_base = mut_tls.ext_reg2;
+        }
+        else {
+            bsl::touch();
+        }
+
         return syscall::BF_STATUS_SUCCESS;
     }
 
@@ -26,6 +26,7 @@
 #define INTRINSIC_HPP
 
 #include <invept_descriptor_t.hpp>
+#include <invpcid_descriptor_t.hpp>
 #include <invvpid_descriptor_t.hpp>
 
 #include <bsl/array.hpp>
@@ -48,6 +49,15 @@ namespace mk
     ///
     extern "C" void intrinsic_invlpg(bsl::uint64 const val) noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::invpcid
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param desc n/a
+    ///   @param type n/a
+    ///
+    extern "C" void intrinsic_invpcid(void const *const desc, bsl::uint64 const type) noexcept;
+
     /// <!-- description -->
     ///   @brief Implements intrinsic_t::es_selector
     ///
@@ -175,6 +185,57 @@ namespace mk
     ///
     extern "C" void intrinsic_halt() noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::clts
+    ///
+    extern "C" void intrinsic_clts() noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::stts
+    ///
+    extern "C" void intrinsic_stts() noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::xsave
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_area n/a
+    ///   @param mask n/a
+    ///
+    extern "C" void intrinsic_xsave(void *const pmut_area, bsl::uint64 const mask) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::xrstor
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param area n/a
+    ///   @param mask n/a
+    ///
+    extern "C" void intrinsic_xrstor(void const *const area, bsl::uint64 const mask) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::xrstor_init
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mask n/a
+    ///
+    extern "C" void intrinsic_xrstor_init(bsl::uint64 const mask) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::cpuid
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_rax n/a
+    ///   @param pmut_rbx n/a
+    ///   @param pmut_rcx n/a
+    ///   @param pmut_rdx n/a
+    ///
+    extern "C" void intrinsic_cpuid(
+        bsl::uint64 *const pmut_rax,
+        bsl::uint64 *const pmut_rbx,
+        bsl::uint64 *const pmut_rcx,
+        bsl::uint64 *const pmut_rdx) noexcept;
+
     /// <!-- description -->
     ///   @brief Implements intrinsic_t::rdmsr
     ///
@@ -363,6 +424,59 @@ namespace mk
             intrinsic_invlpg(val.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates TLB entries tagged with a PCID. Only call
+        ///     this function if CR4.PCIDE is set, which the loader only does
+        ///     if the CPU supports both PCID and INVPCID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pcid the PCID to invalidate (ignored by the all-context
+        ///     types)
+        ///   @param addr the virtual address to invalidate (only used by
+        ///     INVPCID_TYPE_INDIVIDUAL_ADDRESS)
+        ///   @param type the INVPCID type (see the Intel SDM for details)
+        ///
+        static constexpr void
+        invpcid(
+            bsl::safe_uint64 const &pcid,
+            bsl::safe_uint64 const &addr,
+            bsl::safe_uint64 const &type) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            if (bsl::unlikely(!pcid)) {
+                bsl::error() << "invalid pcid "    // --
+                             << bsl::hex(pcid)     // --
+                             << bsl::endl          // --
+                             << bsl::here();       // --
+
+                return;
+            }
+
+            if (bsl::unlikely(!addr)) {
+                bsl::error() << "invalid addr "    // --
+                             << bsl::hex(addr)     // --
+                             << bsl::endl          // --
+                             << bsl::here();       // --
+
+                return;
+            }
+
+            if (bsl::unlikely(!type)) {
+                bsl::error() << "invalid type "    // --
+                             << bsl::hex(type)     // --
+                             << bsl::endl          // --
+                             << bsl::here();       // --
+
+                return;
+            }
+
+            invpcid_descriptor_t const desc{pcid.get(), addr.get()};
+            intrinsic_invpcid(&desc, type.get());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of ES
         ///
@@ -663,6 +777,115 @@ namespace mk
             intrinsic_halt();
         }
 
+        /// <!-- description -->
+        ///   @brief Clears CR0.TS, allowing x87/SSE/AVX instructions to
+        ///     execute without generating a #NM.
+        ///
+        static constexpr void
+        clts() noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            intrinsic_clts();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets CR0.TS, causing the next x87/SSE/AVX instruction
+        ///     to generate a #NM.
+        ///
+        static constexpr void
+        stts() noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            intrinsic_stts();
+        }
+
+        /// <!-- description -->
+        ///   @brief Saves the state components in "mask" (that are also
+        ///     enabled in XCR0) to the provided XSAVE area using the
+        ///     standard format. CR0.TS must be clear.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_area the 64 byte aligned XSAVE area to save to
+        ///   @param mask the state components to save
+        ///
+        static constexpr void
+        xsave(void *const pmut_area, bsl::safe_uint64 const &mask) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            intrinsic_xsave(pmut_area, mask.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores the state components in "mask" (that are also
+        ///     enabled in XCR0) from the provided XSAVE area. CR0.TS must
+        ///     be clear.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param area the 64 byte aligned XSAVE area to restore from
+        ///   @param mask the state components to restore
+        ///
+        static constexpr void
+        xrstor(void const *const area, bsl::safe_uint64 const &mask) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            intrinsic_xrstor(area, mask.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Puts the state components in "mask" (that are also
+        ///     enabled in XCR0) into their initial configuration, with
+        ///     MXCSR set to its power-on value. CR0.TS must be clear.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mask the state components to initialize
+        ///
+        static constexpr void
+        xrstor_init(bsl::safe_uint64 const &mask) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            intrinsic_xrstor_init(mask.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Executes the CPUID instruction given the provided EAX
+        ///     and ECX and returns the results. Only the lower half of each
+        ///     register is touched.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_rax the index used by CPUID, returns resulting rax
+        ///   @param mut_rbx returns resulting rbx
+        ///   @param mut_rcx the subindex used by CPUID, returns the resulting rcx
+        ///   @param mut_rdx returns resulting rdx
+        ///
+        static constexpr void
+        cpuid(
+            bsl::safe_uint64 &mut_rax,
+            bsl::safe_uint64 &mut_rbx,
+            bsl::safe_uint64 &mut_rcx,
+            bsl::safe_uint64 &mut_rdx) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            intrinsic_cpuid(mut_rax.data(), mut_rbx.data(), mut_rcx.data(), mut_rdx.data());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of requested MSR
         ///
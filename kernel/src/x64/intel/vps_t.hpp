@@ -29,9 +29,12 @@
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <fpu_t.hpp>
 #include <general_purpose_regs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <timestamp.hpp>
+#include <tlb_tag_t.hpp>
 #include <tls_t.hpp>
 #include <vmcs_missing_registers_t.hpp>
 #include <vmcs_t.hpp>
@@ -79,6 +82,38 @@ namespace mk
     /// @brief defines the IA32_KERNEL_GS_BASE MSR
     constexpr auto IA32_KERNEL_GS_BASE{0xC0000102_u32};
 
+    /// @brief defines the VMCS field cache index of the guest RIP
+    constexpr auto VMCS_CACHE_GUEST_RIP{0_umax};
+    /// @brief defines the VMCS field cache index of the guest RSP
+    constexpr auto VMCS_CACHE_GUEST_RSP{1_umax};
+    /// @brief defines the VMCS field cache index of the guest RFLAGS
+    constexpr auto VMCS_CACHE_GUEST_RFLAGS{2_umax};
+    /// @brief defines the VMCS field cache index of the exit qualification
+    constexpr auto VMCS_CACHE_EXIT_QUALIFICATION{3_umax};
+    /// @brief defines the VMCS field cache index of the instruction length
+    constexpr auto VMCS_CACHE_VMEXIT_INSTRUCTION_LENGTH{4_umax};
+    /// @brief defines the total number of fields in the VMCS field cache
+    constexpr auto VMCS_CACHE_SIZE{5_umax};
+    /// @brief defines the bits of the exit reason that hold the basic exit reason
+    constexpr auto VMCS_BASIC_EXIT_REASON_MASK{0xFFFF_umax};
+    /// @brief defines the number of exit reasons the exit information mask covers
+    constexpr auto EXIT_INFO_MASK_BITS{64_umax};
+
+    /// @brief defines the IA32_VMX_EPT_VPID_CAP MSR
+    constexpr auto IA32_VMX_EPT_VPID_CAP{0x48C_u32};
+    /// @brief defines the IA32_VMX_EPT_VPID_CAP bit for INVVPID support
+    constexpr auto IA32_VMX_EPT_VPID_CAP_INVVPID{0x0000000100000000_u64};
+    /// @brief defines the IA32_VMX_EPT_VPID_CAP bits for INVVPID all-context support
+    constexpr auto IA32_VMX_EPT_VPID_CAP_INVVPID_ALL{0x0000040100000000_u64};
+    /// @brief defines the IA32_VMX_EPT_VPID_CAP bits for INVVPID single-context support
+    constexpr auto IA32_VMX_EPT_VPID_CAP_INVVPID_SINGLE{0x0000020100000000_u64};
+    /// @brief defines the INVVPID type that invalidates a single VPID
+    constexpr auto INVVPID_SINGLE_CONTEXT{0x1_u64};
+    /// @brief defines the INVVPID type that invalidates all VPIDs other than 0
+    constexpr auto INVVPID_ALL_CONTEXT{0x2_u64};
+    /// @brief defines the largest VPID that can be given to a VPS
+    constexpr auto VPID_MAX{0xFFFF_umax};
+
     /// @class mk::vps_t
     ///
     /// <!-- description -->
@@ -106,6 +141,17 @@ namespace mk
         /// @brief stores the general purpose registers
         general_purpose_regs_t m_gprs{};
 
+        /// @brief stores the cached values of frequently used VMCS fields
+        mutable bsl::array<bsl::uint64, VMCS_CACHE_SIZE.get()> m_vmcs_cache{};
+        /// @brief stores which fields in m_vmcs_cache are valid (1 bit each)
+        mutable bsl::safe_uintmax m_vmcs_cache_valid{};
+        /// @brief stores which fields in m_vmcs_cache need to be written
+        bsl::safe_uintmax m_vmcs_cache_dirty{};
+        /// @brief stores the VPID assigned to this VPS
+        tlb_tag_t m_tlb_tag{};
+        /// @brief stores the x87/SSE/AVX state of this VPS
+        fpu_t m_fpu{};
+
         /// <!-- description -->
         ///   @brief Returns the row color based on the value of "val"
         ///
@@ -398,6 +444,525 @@ namespace mk
             return ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the VMCS field encoding of the provided VMCS
+        ///     field cache index.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the VMCS field cache index to get the encoding for
+        ///   @return Returns the VMCS field encoding of the provided VMCS
+        ///     field cache index, or bsl::safe_uintmax::failure() if the
+        ///     index is invalid.
+        ///
+        [[nodiscard]] static constexpr auto
+        vmcs_cache_field(bsl::safe_uintmax const &idx) noexcept -> bsl::safe_uintmax
+        {
+            switch (idx.get()) {
+                case VMCS_CACHE_GUEST_RIP.get(): {
+                    return VMCS_GUEST_RIP;
+                }
+
+                case VMCS_CACHE_GUEST_RSP.get(): {
+                    return VMCS_GUEST_RSP;
+                }
+
+                case VMCS_CACHE_GUEST_RFLAGS.get(): {
+                    return VMCS_GUEST_RFLAGS;
+                }
+
+                case VMCS_CACHE_EXIT_QUALIFICATION.get(): {
+                    return VMCS_EXIT_QUALIFICATION;
+                }
+
+                case VMCS_CACHE_VMEXIT_INSTRUCTION_LENGTH.get(): {
+                    return VMCS_VMEXIT_INSTRUCTION_LENGTH;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return bsl::safe_uintmax::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads a field from the VMCS field cache. If the field is
+        ///     not in the cache yet, it is read from the VMCS (which must be
+        ///     loaded) and added to the cache. The cache is emptied each
+        ///     time this VPS is run, so a field is read from the VMCS at
+        ///     most once per VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @param idx the VMCS field cache index of the field to read
+        ///   @param pmut_val where to store the value of the field
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        vmcs_cache_read(
+            intrinsic_t const &intrinsic,
+            bsl::safe_uintmax const &idx,
+            bsl::uint64 *const pmut_val) const noexcept -> bsl::errc_type
+        {
+            auto *const pmut_cached{m_vmcs_cache.at_if(idx)};
+            if (bsl::unlikely_assert(nullptr == pmut_cached)) {
+                bsl::error() << "invalid vmcs cache index "    // --
+                             << bsl::hex(idx)                  // --
+                             << bsl::endl                      // --
+                             << bsl::here();                   // --
+
+                return bsl::errc_index_out_of_bounds;
+            }
+
+            auto const bit{1_umax << idx};
+            if ((m_vmcs_cache_valid & bit).is_zero()) {
+                auto const ret{intrinsic.vmread64(vmcs_cache_field(idx), pmut_cached)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                m_vmcs_cache_valid |= bit;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *pmut_val = *pmut_cached;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes a field to the VMCS field cache. The field is
+        ///     only written to the VMCS by vmcs_cache_flush() right before
+        ///     this VPS is run, so multiple writes to the same field only
+        ///     result in a single VMWRITE.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the VMCS field cache index of the field to write
+        ///   @param val the value to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        vmcs_cache_write(bsl::safe_uintmax const &idx, bsl::safe_uint64 const &val) noexcept
+            -> bsl::errc_type
+        {
+            auto *const pmut_cached{m_vmcs_cache.at_if(idx)};
+            if (bsl::unlikely_assert(nullptr == pmut_cached)) {
+                bsl::error() << "invalid vmcs cache index "    // --
+                             << bsl::hex(idx)                  // --
+                             << bsl::endl                      // --
+                             << bsl::here();                   // --
+
+                return bsl::errc_index_out_of_bounds;
+            }
+
+            auto const bit{1_umax << idx};
+            *pmut_cached = val.get();
+            m_vmcs_cache_valid |= bit;
+            m_vmcs_cache_dirty |= bit;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes a field from the VMCS field cache. This is used
+        ///     when the field is written directly to the VMCS.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the VMCS field cache index of the field to remove
+        ///
+        constexpr void
+        vmcs_cache_evict(bsl::safe_uintmax const &idx) noexcept
+        {
+            auto const bit{1_umax << idx};
+            m_vmcs_cache_valid &= ~bit;
+            m_vmcs_cache_dirty &= ~bit;
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives this VPS a new VPID if the VPID it has is stale
+        ///     (i.e., it has never run, it was last run on a different PP,
+        ///     or the current PP ran out of VPIDs). If the current PP ran out
+        ///     of VPIDs, all VPIDs on this PP are flushed using INVVPID
+        ///     before any of them are handed out again. If the CPU does not
+        ///     support an all-context INVVPID, the new VPID is flushed on
+        ///     its own using a single-context INVVPID instead. The VMCS must
+        ///     be loaded.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsics to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        update_vpid(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept -> bsl::errc_type
+        {
+            if (!m_tlb_tag.is_stale(mut_tls)) {
+                return bsl::errc_success;
+            }
+
+            constexpr auto invvpid_all{IA32_VMX_EPT_VPID_CAP_INVVPID_ALL};
+            constexpr auto invvpid_single{IA32_VMX_EPT_VPID_CAP_INVVPID_SINGLE};
+
+            bool const flush_all{m_tlb_tag.assign(mut_tls, VPID_MAX)};
+            auto const vpid{bsl::to_u16(m_tlb_tag.get())};
+
+            /// NOTE:
+            /// - If the CPU does not support VPIDs, this MSR does not
+            ///   exist (or does not report INVVPID support) and there is
+            ///   nothing to flush.
+            /// - If the CPU supports an all-context INVVPID, every VPID on
+            ///   this PP is flushed once when a new generation starts.
+            /// - Otherwise, the VPID that was just handed out is flushed
+            ///   with a single-context INVVPID. VPIDs are only handed out
+            ///   when a VPS's VPID is stale, and every VPID is flushed
+            ///   this way before it is used in a new generation, so no VPS
+            ///   sees TLB entries left behind by the last VPS that had
+            ///   its VPID.
+            /// - If the flush fails, the VPID is given up (and a failed
+            ///   all-context flush starts another generation) so that the
+            ///   VPS does not run with it and the flush is tried again the
+            ///   next time the VPS runs.
+            ///
+
+            auto const cap{mut_intrinsic.rdmsr(IA32_VMX_EPT_VPID_CAP)};
+            if (!cap || (cap & IA32_VMX_EPT_VPID_CAP_INVVPID).is_zero()) {
+                bsl::touch();
+            }
+            else if ((cap & invvpid_all) == invvpid_all) {
+                if (flush_all) {
+                    auto const ret{mut_intrinsic.invvpid({}, {}, INVVPID_ALL_CONTEXT)};
+                    if (bsl::unlikely(!ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        mut_tls.tlb_tag_next = {};
+                        m_tlb_tag.reset();
+                        return ret;
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else if ((cap & invvpid_single) == invvpid_single) {
+                auto const ret{mut_intrinsic.invvpid({}, vpid, INVVPID_SINGLE_CONTEXT)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    m_tlb_tag.reset();
+                    return ret;
+                }
+            }
+            else {
+                bsl::error() << "the cpu cannot flush vpid "    // --
+                             << bsl::hex(vpid)                  // --
+                             << " with invvpid"                 // --
+                             << bsl::endl                       // --
+                             << bsl::here();                    // --
+
+                m_tlb_tag.reset();
+                return bsl::errc_unsupported;
+            }
+
+            return mut_intrinsic.vmwrite16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, vpid);
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes all of the dirty fields in the VMCS field cache
+        ///     to the VMCS (which must be loaded) and then empties the
+        ///     cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_intrinsic the intrinsics to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        vmcs_cache_flush(intrinsic_t &mut_intrinsic) noexcept -> bsl::errc_type
+        {
+            if (m_vmcs_cache_dirty.is_zero()) {
+                m_vmcs_cache_valid = {};
+                return bsl::errc_success;
+            }
+
+            for (auto const elem : m_vmcs_cache) {
+                if ((m_vmcs_cache_dirty & (1_umax << elem.index)).is_zero()) {
+                    continue;
+                }
+
+                auto const ret{
+                    mut_intrinsic.vmwrite64(vmcs_cache_field(elem.index), bsl::to_u64(*elem.data))};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+            }
+
+            m_vmcs_cache_valid = {};
+            m_vmcs_cache_dirty = {};
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of a field for dumping, preferring a
+        ///     value that is waiting in the VMCS field cache to be written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @param idx the VMCS field cache index of the field to read
+        ///   @return Returns the value of the field
+        ///
+        [[nodiscard]] constexpr auto
+        vmcs_cache_peek(intrinsic_t const &intrinsic, bsl::safe_uintmax const &idx) const noexcept
+            -> bsl::safe_uint64
+        {
+            if ((m_vmcs_cache_dirty & (1_umax << idx)).is_zero()) {
+                return intrinsic.vmread64_quiet(vmcs_cache_field(idx));
+            }
+
+            return bsl::to_u64(*m_vmcs_cache.at_if(idx));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TLS offset that the provided VMCS field
+        ///     cache index is shared with the extension at.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the VMCS field cache index to get the TLS offset for
+        ///   @return Returns the TLS offset that the provided VMCS field
+        ///     cache index is shared with the extension at, or
+        ///     bsl::safe_uint64::failure() if the index is invalid.
+        ///
+        [[nodiscard]] static constexpr auto
+        vmcs_cache_tls_offset(bsl::safe_uintmax const &idx) noexcept -> bsl::safe_uint64
+        {
+            switch (idx.get()) {
+                case VMCS_CACHE_GUEST_RIP.get(): {
+                    return syscall::TLS_OFFSET_RIP;
+                }
+
+                case VMCS_CACHE_GUEST_RSP.get(): {
+                    return syscall::TLS_OFFSET_RSP;
+                }
+
+                case VMCS_CACHE_GUEST_RFLAGS.get(): {
+                    return syscall::TLS_OFFSET_RFLAGS;
+                }
+
+                case VMCS_CACHE_EXIT_QUALIFICATION.get(): {
+                    return syscall::TLS_OFFSET_EXIT_QUALIFICATION;
+                }
+
+                case VMCS_CACHE_VMEXIT_INSTRUCTION_LENGTH.get(): {
+                    return syscall::TLS_OFFSET_EXIT_INSTR_LEN;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return bsl::safe_uint64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies the fields of the VMExit that just occurred that
+        ///     are only shared when the extension asks for them (i.e., all
+        ///     of the fields other than the reason and qualification) into
+        ///     the extension's TLS block. The VMCS must be loaded.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        full_exit_info_to_tls(intrinsic_t const &intrinsic) const noexcept -> bsl::errc_type
+        {
+            bsl::safe_uint64 mut_val{};
+
+            for (bsl::safe_uintmax mut_i{}; mut_i < VMCS_CACHE_SIZE; ++mut_i) {
+                if (VMCS_CACHE_EXIT_QUALIFICATION == mut_i) {
+                    continue;
+                }
+
+                auto const ret{this->vmcs_cache_read(intrinsic, mut_i, mut_val.data())};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                intrinsic.set_tls_reg(vmcs_cache_tls_offset(mut_i), mut_val);
+            }
+
+            auto mut_ret{intrinsic.vmread64(VMCS_VMEXIT_INSTRUCTION_INFORMATION, mut_val.data())};
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_INSTR_INFO, mut_val);
+
+            mut_ret = intrinsic.vmread64(VMCS_GUEST_CR3, mut_val.data());
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_CR3, mut_val);
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the extension asked for all of the
+        ///     VMExit information to be shared for the provided exit
+        ///     reason, by setting the exit reason's bit in the exit
+        ///     information mask of its TLS block.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @param exit_reason the exit reason of the VMExit
+        ///   @return Returns true if the extension asked for all of the
+        ///     VMExit information to be shared for the provided exit reason
+        ///
+        [[nodiscard]] static constexpr auto
+        wants_full_exit_info(
+            intrinsic_t const &intrinsic, bsl::safe_uintmax const &exit_reason) noexcept -> bool
+        {
+            auto const basic{exit_reason & VMCS_BASIC_EXIT_REASON_MASK};
+            if (basic >= EXIT_INFO_MASK_BITS) {
+                return false;
+            }
+
+            auto const mask{intrinsic.tls_reg(syscall::TLS_OFFSET_EXIT_INFO_MASK)};
+            return !(mask & (1_u64 << bsl::to_u64(basic))).is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies the information about the VMExit that just
+        ///     occurred into the extension's TLS block, which allows an
+        ///     extension to handle most VMExits without using the read
+        ///     syscalls. Note that the VMCS must be loaded.
+        ///
+        ///     Every field costs a VMREAD, so only the exit reason and the
+        ///     exit qualification are shared on every VMExit. The rest of
+        ///     the fields are only shared for the exit reasons that the
+        ///     extension opted into using the exit information mask. For
+        ///     all other exit reasons, the extension reads them on demand
+        ///     using bf_vps_op_read, which goes through the VMCS field
+        ///     cache, so each field is still read at most once.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @param exit_reason the exit reason of the VMExit
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info_to_tls(intrinsic_t const &intrinsic, bsl::safe_uintmax const &exit_reason)
+            const noexcept -> bsl::errc_type
+        {
+            bsl::safe_uint64 mut_val{};
+
+            auto const ret{
+                this->vmcs_cache_read(intrinsic, VMCS_CACHE_EXIT_QUALIFICATION, mut_val.data())};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_QUALIFICATION, mut_val);
+
+            if (wants_full_exit_info(intrinsic, exit_reason)) {
+                auto const full{this->full_exit_info_to_tls(intrinsic)};
+                if (bsl::unlikely(!full)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return full;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_REASON, bsl::to_u64(exit_reason));
+
+            auto const seq{intrinsic.tls_reg(syscall::TLS_OFFSET_EXIT_SEQ)};
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_EXIT_SEQ, seq + 1_u64);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes any fields that the extension marked as dirty
+        ///     in its TLS block back to this VPS, and then clears the
+        ///     dirty mask. The fields are written to the VMCS field cache,
+        ///     so the VMCS does not need to be loaded.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsics to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write_back_from_tls(intrinsic_t const &intrinsic) noexcept -> bsl::errc_type
+        {
+            auto const dirty{intrinsic.tls_reg(syscall::TLS_OFFSET_DIRTY)};
+            if (dirty.is_zero()) {
+                return bsl::errc_success;
+            }
+
+            bsl::errc_type mut_ret{};
+
+            if (!(dirty & syscall::TLS_DIRTY_RIP).is_zero()) {
+                mut_ret = this->vmcs_cache_write(
+                    VMCS_CACHE_GUEST_RIP, intrinsic.tls_reg(syscall::TLS_OFFSET_RIP));
+                if (bsl::unlikely(!mut_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return mut_ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!(dirty & syscall::TLS_DIRTY_RSP).is_zero()) {
+                mut_ret = this->vmcs_cache_write(
+                    VMCS_CACHE_GUEST_RSP, intrinsic.tls_reg(syscall::TLS_OFFSET_RSP));
+                if (bsl::unlikely(!mut_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return mut_ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!(dirty & syscall::TLS_DIRTY_RFLAGS).is_zero()) {
+                mut_ret = this->vmcs_cache_write(
+                    VMCS_CACHE_GUEST_RFLAGS, intrinsic.tls_reg(syscall::TLS_OFFSET_RFLAGS));
+                if (bsl::unlikely(!mut_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return mut_ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            intrinsic.set_tls_reg(syscall::TLS_OFFSET_DIRTY, {});
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief This is executed on each core when a VPS is first
         ///     allocated, and ensures the VMCS contains the current host
@@ -492,7 +1057,12 @@ namespace mk
                 return mut_ret;
             }
 
-            mut_ret = mut_intrinsic.vmwrite64(VMCS_HOST_CR0, mut_intrinsic.cr0());
+            /// NOTE:
+            /// - CR0.TS is always set on a VMExit so that the VPS's FPU
+            ///   state is only saved if the host uses it (see fpu_t).
+            ///
+
+            mut_ret = mut_intrinsic.vmwrite64(VMCS_HOST_CR0, mut_intrinsic.cr0() | FPU_CR0_TS);
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
@@ -650,6 +1220,10 @@ namespace mk
 
             m_gprs = {};
             m_vmcs_missing_registers = {};
+            m_vmcs_cache_valid = {};
+            m_vmcs_cache_dirty = {};
+            m_tlb_tag.reset();
+            m_fpu.deallocate(mut_tls, mut_page_pool);
 
             m_vmcs_phys = bsl::safe_uintmax::failure();
             mut_page_pool.deallocate(mut_tls, m_vmcs, ALLOCATE_TAG_VMCS);
@@ -783,6 +1357,7 @@ namespace mk
             }
 
             bsl::finally mut_cleanup_on_error{[this, &mut_tls, &mut_page_pool]() noexcept -> void {
+                m_fpu.deallocate(mut_tls, mut_page_pool);
                 m_vmcs_phys = bsl::safe_uintmax::failure();
                 mut_page_pool.deallocate(mut_tls, m_vmcs, ALLOCATE_TAG_VMCS);
                 m_vmcs = {};
@@ -800,6 +1375,11 @@ namespace mk
                 return bsl::safe_uint16::failure();
             }
 
+            if (bsl::unlikely(!m_fpu.allocate(mut_tls, mut_page_pool))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uint16::failure();
+            }
+
             auto const ret{this->init_vmcs(mut_tls, mut_intrinsic)};
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
@@ -871,6 +1451,10 @@ namespace mk
 
             m_gprs = {};
             m_vmcs_missing_registers = {};
+            m_vmcs_cache_valid = {};
+            m_vmcs_cache_dirty = {};
+            m_tlb_tag.reset();
+            m_fpu.deallocate(mut_tls, mut_page_pool);
 
             m_vmcs_phys = bsl::safe_uintmax::failure();
             mut_page_pool.deallocate(mut_tls, m_vmcs, ALLOCATE_TAG_VMCS);
@@ -1126,6 +1710,14 @@ namespace mk
             m_gprs.r14 = intrinsic.tls_reg(syscall::TLS_OFFSET_R14).get();
             m_gprs.r15 = intrinsic.tls_reg(syscall::TLS_OFFSET_R15).get();
 
+            auto const ret{this->write_back_from_tls(intrinsic)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            m_fpu.save(mut_tls, intrinsic);
+
             mut_tls.active_vpsid = syscall::BF_INVALID_ID.get();
             m_active_ppid = bsl::safe_uint16::failure();
 
@@ -1341,6 +1933,10 @@ namespace mk
                 return mut_ret;
             }
 
+            m_vmcs_cache_valid = {};
+            m_vmcs_cache_dirty = {};
+            m_fpu.init_as_root(mut_tls, mut_intrinsic);
+
             if (mut_tls.active_vpsid == m_id) {
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, bsl::to_u64(state.rax));
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RBX, bsl::to_u64(state.rbx));
@@ -1689,6 +2285,8 @@ namespace mk
                 return mut_ret;
             }
 
+            m_fpu.promote(mut_tls, intrinsic);
+
             if (mut_tls.active_vpsid == m_id) {
                 mut_state.rax = intrinsic.tls_reg(syscall::TLS_OFFSET_RAX).get();
                 mut_state.rbx = intrinsic.tls_reg(syscall::TLS_OFFSET_RBX).get();
@@ -1724,19 +2322,19 @@ namespace mk
                 mut_state.r15 = m_gprs.r15;
             }
 
-            mut_ret = intrinsic.vmread64(VMCS_GUEST_RSP, &mut_state.rsp);
+            mut_ret = this->vmcs_cache_read(intrinsic, VMCS_CACHE_GUEST_RSP, &mut_state.rsp);
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
             }
 
-            mut_ret = intrinsic.vmread64(VMCS_GUEST_RIP, &mut_state.rip);
+            mut_ret = this->vmcs_cache_read(intrinsic, VMCS_CACHE_GUEST_RIP, &mut_state.rip);
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
             }
 
-            mut_ret = intrinsic.vmread64(VMCS_GUEST_RFLAGS, &mut_state.rflags);
+            mut_ret = this->vmcs_cache_read(intrinsic, VMCS_CACHE_GUEST_RFLAGS, &mut_state.rflags);
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
@@ -2568,7 +3166,8 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_vmexit_instruction_length: {
-                    mut_ret = intrinsic.vmread64(VMCS_VMEXIT_INSTRUCTION_LENGTH, mut_val.data());
+                    mut_ret = this->vmcs_cache_read(
+                        intrinsic, VMCS_CACHE_VMEXIT_INSTRUCTION_LENGTH, mut_val.data());
                     break;
                 }
 
@@ -2734,7 +3333,8 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_exit_qualification: {
-                    mut_ret = intrinsic.vmread64(VMCS_EXIT_QUALIFICATION, mut_val.data());
+                    mut_ret = this->vmcs_cache_read(
+                        intrinsic, VMCS_CACHE_EXIT_QUALIFICATION, mut_val.data());
                     break;
                 }
 
@@ -2834,17 +3434,20 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_rsp: {
-                    mut_ret = intrinsic.vmread64(VMCS_GUEST_RSP, mut_val.data());
+                    mut_ret = this->vmcs_cache_read(
+                        intrinsic, VMCS_CACHE_GUEST_RSP, mut_val.data());
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_rip: {
-                    mut_ret = intrinsic.vmread64(VMCS_GUEST_RIP, mut_val.data());
+                    mut_ret = this->vmcs_cache_read(
+                        intrinsic, VMCS_CACHE_GUEST_RIP, mut_val.data());
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_rflags: {
-                    mut_ret = intrinsic.vmread64(VMCS_GUEST_RFLAGS, mut_val.data());
+                    mut_ret = this->vmcs_cache_read(
+                        intrinsic, VMCS_CACHE_GUEST_RFLAGS, mut_val.data());
                     break;
                 }
 
@@ -3127,6 +3730,7 @@ namespace mk
                 case syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier: {
                     mut_ret = mut_intrinsic.vmwrite16(
                         VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, bsl::to_u16(val));
+                    m_tlb_tag.reset();
                     break;
                 }
 
@@ -3532,6 +4136,7 @@ namespace mk
                 case syscall::bf_reg_t::bf_reg_t_vmexit_instruction_length: {
                     mut_ret =
                         mut_intrinsic.vmwrite32(VMCS_VMEXIT_INSTRUCTION_LENGTH, bsl::to_u32(val));
+                    this->vmcs_cache_evict(VMCS_CACHE_VMEXIT_INSTRUCTION_LENGTH);
                     break;
                 }
 
@@ -3709,6 +4314,7 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_exit_qualification: {
                     mut_ret = mut_intrinsic.vmwrite64(VMCS_EXIT_QUALIFICATION, bsl::to_u64(val));
+                    this->vmcs_cache_evict(VMCS_CACHE_EXIT_QUALIFICATION);
                     break;
                 }
 
@@ -3808,17 +4414,17 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_rsp: {
-                    mut_ret = mut_intrinsic.vmwrite64(VMCS_GUEST_RSP, bsl::to_u64(val));
+                    mut_ret = this->vmcs_cache_write(VMCS_CACHE_GUEST_RSP, bsl::to_u64(val));
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_rip: {
-                    mut_ret = mut_intrinsic.vmwrite64(VMCS_GUEST_RIP, bsl::to_u64(val));
+                    mut_ret = this->vmcs_cache_write(VMCS_CACHE_GUEST_RIP, bsl::to_u64(val));
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_rflags: {
-                    mut_ret = mut_intrinsic.vmwrite64(VMCS_GUEST_RFLAGS, bsl::to_u64(val));
+                    mut_ret = this->vmcs_cache_write(VMCS_CACHE_GUEST_RFLAGS, bsl::to_u64(val));
                     break;
                 }
 
@@ -3906,7 +4512,36 @@ namespace mk
                 return bsl::safe_uintmax::failure();
             }
 
+            auto const tagged{this->update_vpid(mut_tls, mut_intrinsic)};
+            if (bsl::unlikely(!tagged)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            auto const written{this->write_back_from_tls(mut_intrinsic)};
+            if (bsl::unlikely(!written)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            auto const flushed{this->vmcs_cache_flush(mut_intrinsic)};
+            if (bsl::unlikely(!flushed)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
+            m_fpu.load(mut_tls, mut_intrinsic);
+
+            bsl::safe_uintmax mut_cycles{};
+            if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
+                mut_cycles = bsl::to_umax(timestamp());
+            }
+
             bsl::safe_uintmax const exit_reason{intrinsic_vmrun(&m_vmcs_missing_registers)};
+            if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
+                mut_cycles = bsl::to_umax(timestamp()) - mut_cycles;
+            }
+
             if (bsl::unlikely(exit_reason > invalid_exit_reason)) {
                 bsl::error() << "vmlaunch/vmresume failed with error code "    // --
                              << (exit_reason & (~invalid_exit_reason))         // --
@@ -3916,6 +4551,12 @@ namespace mk
                 return bsl::safe_uintmax::failure();
             }
 
+            auto const shared{this->exit_info_to_tls(mut_intrinsic, exit_reason)};
+            if (bsl::unlikely(!shared)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::failure();
+            }
+
             if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
                 mut_log.add(
                     bsl::to_u16(mut_tls.ppid),
@@ -3942,7 +4583,8 @@ namespace mk
                      mut_intrinsic.tls_reg(syscall::TLS_OFFSET_R14),
                      mut_intrinsic.tls_reg(syscall::TLS_OFFSET_R15),
                      mut_intrinsic.vmread64_quiet(VMCS_GUEST_RSP),
-                     mut_intrinsic.vmread64_quiet(VMCS_GUEST_RIP)});
+                     mut_intrinsic.vmread64_quiet(VMCS_GUEST_RIP),
+                     mut_cycles});
             }
 
             /// TODO:
@@ -4003,19 +4645,20 @@ namespace mk
                 return mut_ret;
             }
 
-            mut_ret = mut_intrinsic.vmread64(VMCS_GUEST_RIP, mut_rip.data());
+            mut_ret = this->vmcs_cache_read(mut_intrinsic, VMCS_CACHE_GUEST_RIP, mut_rip.data());
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
             }
 
-            mut_ret = mut_intrinsic.vmread64(VMCS_VMEXIT_INSTRUCTION_LENGTH, mut_len.data());
+            mut_ret = this->vmcs_cache_read(
+                mut_intrinsic, VMCS_CACHE_VMEXIT_INSTRUCTION_LENGTH, mut_len.data());
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
             }
 
-            mut_ret = mut_intrinsic.vmwrite64(VMCS_GUEST_RIP, mut_rip + mut_len);
+            mut_ret = this->vmcs_cache_write(VMCS_CACHE_GUEST_RIP, mut_rip + mut_len);
             if (bsl::unlikely_assert(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return mut_ret;
@@ -4442,9 +5085,9 @@ namespace mk
             this->dump_field("idtr_base ", intrinsic.vmread64_quiet(VMCS_GUEST_IDTR_BASE));
             this->dump_field("dr6 ", bsl::make_safe(m_vmcs_missing_registers.guest_dr6));
             this->dump_field("dr7 ", intrinsic.vmread64_quiet(VMCS_GUEST_DR7));
-            this->dump_field("rsp ", intrinsic.vmread64_quiet(VMCS_GUEST_RSP));
-            this->dump_field("rip ", intrinsic.vmread64_quiet(VMCS_GUEST_RIP));
-            this->dump_field("rflags ", intrinsic.vmread64_quiet(VMCS_GUEST_RFLAGS));
+            this->dump_field("rsp ", this->vmcs_cache_peek(intrinsic, VMCS_CACHE_GUEST_RSP));
+            this->dump_field("rip ", this->vmcs_cache_peek(intrinsic, VMCS_CACHE_GUEST_RIP));
+            this->dump_field("rflags ", this->vmcs_cache_peek(intrinsic, VMCS_CACHE_GUEST_RFLAGS));
             this->dump_field("guest_pending_debug_exceptions ", intrinsic.vmread64_quiet(VMCS_GUEST_PENDING_DEBUG_EXCEPTIONS));
             this->dump_field("ia32_sysenter_esp ", intrinsic.vmread64_quiet(VMCS_GUEST_IA32_SYSENTER_ESP));
             this->dump_field("ia32_sysenter_eip ", intrinsic.vmread64_quiet(VMCS_GUEST_IA32_SYSENTER_EIP));
@@ -29,6 +29,7 @@
 #include <ext_tcb_t.hpp>
 #include <intrinsic_t.hpp>
 #include <lock_guard_t.hpp>
+#include <lock_tags.hpp>
 #include <map_page_flags.hpp>
 #include <page_pool_t.hpp>
 #include <page_t.hpp>
@@ -43,11 +44,14 @@
 #include <spinlock_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstr_type.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/fmt.hpp>
+#include <bsl/is_constant_evaluated.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
@@ -55,6 +59,17 @@
 
 namespace mk
 {
+    /// @brief defines the size of a page mapped by a pdte_t (2 MiB)
+    constexpr auto RPT_PAGE_SIZE_2M{0x200000_umax};
+    /// @brief defines the size of a page mapped by a pdpte_t (1 GiB)
+    constexpr auto RPT_PAGE_SIZE_1G{0x40000000_umax};
+    /// @brief defines the largest PCID that can be stored in CR3
+    constexpr auto RPT_MAX_PCID{0xFFF_umax};
+    /// @brief defines the CR3 bit that preserves the TLB of the PCID
+    constexpr auto RPT_CR3_NOFLUSH{0x8000000000000000_umax};
+    /// @brief defines the generation of an RPT that has never changed
+    constexpr auto RPT_FIRST_GENERATION{1_umax};
+
     /// @class mk::root_page_table_t
     ///
     /// <!-- description -->
@@ -67,8 +82,71 @@ namespace mk
         pml4t_t *m_pml4t{};
         /// @brief stores the physical address of the pml4t
         bsl::safe_uintmax m_pml4t_phys{bsl::safe_uintmax::failure()};
+        /// @brief stores the PCID used when CR4.PCIDE is set
+        bsl::safe_uintmax m_pcid{};
+        /// @brief incremented each time a mapping is removed or changed
+        bsl::uint64 m_generation{RPT_FIRST_GENERATION.get()};
+        /// @brief stores the generation each PP last activated (0 == never)
+        bsl::array<bsl::uint64, HYPERVISOR_MAX_PPS.get()> m_pp_generations{};
         /// @brief safe guards operations on the RPT.
-        mutable spinlock_t m_lock{};
+        mutable spinlock_t m_lock{LOCK_TAG_ROOT_PAGE_TABLE};
+
+        /// <!-- description -->
+        ///   @brief Atomically reads the provided generation. The
+        ///     generations are shared between PPs without holding the
+        ///     RPT's lock, so they are always accessed atomically.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gen the generation to read
+        ///   @return Returns the value of the provided generation
+        ///
+        [[nodiscard]] static constexpr auto
+        load_generation(bsl::uint64 const *const gen) noexcept -> bsl::safe_uintmax
+        {
+            if (bsl::is_constant_evaluated()) {
+                return bsl::to_umax(*gen);
+            }
+
+            return bsl::to_umax(__atomic_load_n(gen, __ATOMIC_ACQUIRE));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically stores the provided value into the provided
+        ///     generation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_gen the generation to store to
+        ///   @param val the value to store
+        ///
+        static constexpr void
+        store_generation(bsl::uint64 *const pmut_gen, bsl::safe_uintmax const &val) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                *pmut_gen = bsl::to_u64(val).get();
+                return;
+            }
+
+            __atomic_store_n(pmut_gen, bsl::to_u64(val).get(), __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks this RPT as changed by incrementing its
+        ///     generation. This must be done after the page tables are
+        ///     changed so that a PP that sees the new generation also
+        ///     sees the change.
+        ///
+        constexpr void
+        next_generation() noexcept
+        {
+            constexpr auto one{1_u64};
+
+            if (bsl::is_constant_evaluated()) {
+                m_generation = (bsl::to_u64(m_generation) + one).get();
+                return;
+            }
+
+            __atomic_add_fetch(&m_generation, one.get(), __ATOMIC_RELEASE);
+        }
 
         /// <!-- description -->
         ///   @brief Returns the index of the last entry present in a page
@@ -299,12 +377,22 @@ namespace mk
         {
             constexpr auto disabled{0_umax};
             for (auto const elem : get_pdpt(mut_page_pool, pmut_pml4te)->entries) {
-                if (disabled != elem.data->p) {
-                    remove_pdt(mut_tls, mut_page_pool, elem.data);
+                if (disabled == elem.data->p) {
+                    continue;
                 }
-                else {
-                    bsl::touch();
+
+                /// NOTE:
+                /// - Large pages are never allocated from the page pool
+                ///   (they are always mapped using MAP_PAGE_NO_AUTO_RELEASE)
+                ///   and they do not point to a table, so there is nothing
+                ///   to release.
+                ///
+
+                if (disabled != elem.data->ps) {
+                    continue;
                 }
+
+                remove_pdt(mut_tls, mut_page_pool, elem.data);
             }
 
             mut_page_pool.deallocate(
@@ -364,6 +452,35 @@ namespace mk
             return (virt >> shft) & mask;
         }
 
+        /// <!-- description -->
+        ///   @brief Given a pdpte_t or pdte_t that maps a large page, this
+        ///     function outputs the flags associated with the entry. Large
+        ///     pages are always mapped using MAP_PAGE_NO_AUTO_RELEASE.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam ENTRY_CONCEPT the type of entry to output
+        ///   @param entry the entry to output
+        ///   @param size a string describing the size of the large page
+        ///
+        template<typename ENTRY_CONCEPT>
+        static constexpr void
+        output_large_page(ENTRY_CONCEPT const *const entry, bsl::cstr_type const size) noexcept
+        {
+            constexpr auto disabled{0_umax};
+
+            bsl::print() << bsl::rst << " (";
+
+            if (disabled != entry->rw) {
+                bsl::print() << bsl::grn << "RW, ";
+            }
+            else {
+                bsl::print() << bsl::grn << "RX, ";
+            }
+
+            bsl::print() << bsl::grn << size << ", manual";
+            bsl::print() << bsl::rst << ')';
+        }
+
         /// <!-- description -->
         ///   @brief Given a pdpte_t, this function outputs the flags
         ///     associated with the entry
@@ -374,7 +491,16 @@ namespace mk
         static constexpr void
         output_pdpte(pdpte_t const *const entry) noexcept
         {
+            constexpr auto disabled{0_umax};
+
             bsl::print() << bsl::hex(entry->phys << HYPERVISOR_PAGE_SHIFT);
+            if (disabled != entry->ps) {
+                output_large_page(entry, "1G");
+            }
+            else {
+                bsl::touch();
+            }
+
             bsl::print() << bsl::rst << bsl::endl;
         }
 
@@ -407,6 +533,10 @@ namespace mk
                 bsl::print() << bsl::blu;
                 output_pdpte(elem.data);
 
+                if (disabled != elem.data->ps) {
+                    continue;
+                }
+
                 dump_pdt(
                     page_pool,
                     get_pdt(page_pool, elem.data),
@@ -463,12 +593,15 @@ namespace mk
         {
             constexpr auto disabled{0_umax};
             for (auto const elem : get_pdt(mut_page_pool, pmut_pdpte)->entries) {
-                if (disabled != elem.data->p) {
-                    remove_pt(mut_tls, mut_page_pool, elem.data);
+                if (disabled == elem.data->p) {
+                    continue;
                 }
-                else {
-                    bsl::touch();
+
+                if (disabled != elem.data->ps) {
+                    continue;
                 }
+
+                remove_pt(mut_tls, mut_page_pool, elem.data);
             }
 
             mut_page_pool.deallocate(
@@ -537,7 +670,16 @@ namespace mk
         static constexpr void
         output_pdte(pdte_t const *const entry) noexcept
         {
+            constexpr auto disabled{0_umax};
+
             bsl::print() << bsl::hex(entry->phys << HYPERVISOR_PAGE_SHIFT);
+            if (disabled != entry->ps) {
+                output_large_page(entry, "2M");
+            }
+            else {
+                bsl::touch();
+            }
+
             bsl::print() << bsl::rst << bsl::endl;
         }
 
@@ -574,6 +716,10 @@ namespace mk
                 bsl::print() << bsl::blu;
                 output_pdte(elem.data);
 
+                if (disabled != elem.data->ps) {
+                    continue;
+                }
+
                 dump_pt(
                     get_pt(page_pool, elem.data),
                     is_pml4te_last_index,
@@ -1064,96 +1210,89 @@ namespace mk
             m_pml4t = {};
         }
 
-    public:
         /// <!-- description -->
-        ///   @brief Initializes this root_page_table_t
+        ///   @brief Returns true if the provided address is aligned to the
+        ///     provided size.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
-        ///   @param mut_page_pool the page_pool_t to use
-        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
-        ///     and friends otherwise
+        ///   @param addr the address to query
+        ///   @param size the alignment to check (must be a power of 2)
+        ///   @return Returns true if the provided address is aligned to the
+        ///     provided size.
         ///
-        [[nodiscard]] constexpr auto
-        initialize(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept -> bsl::errc_type
+        [[nodiscard]] static constexpr auto
+        is_aligned_to(bsl::safe_uintmax const &addr, bsl::safe_uintmax const &size) noexcept
+            -> bool
         {
-            if (bsl::unlikely_assert(m_pml4t_phys)) {
-                bsl::error() << "root_page_table_t already initialized\n" << bsl::here();
-                return bsl::errc_failure;
-            }
-
-            bsl::finally mut_release_on_error{[this, &mut_tls, &mut_page_pool]() noexcept -> void {
-                this->release(mut_tls, mut_page_pool);
-            }};
-
-            m_pml4t = mut_page_pool.template allocate<pml4t_t>(mut_tls, ALLOCATE_TAG_PML4TS);
-            if (bsl::unlikely(nullptr == m_pml4t)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return bsl::errc_failure;
-            }
-
-            m_pml4t_phys = mut_page_pool.virt_to_phys(m_pml4t);
-            if (bsl::unlikely_assert(!m_pml4t_phys)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return bsl::errc_failure;
-            }
-
-            mut_release_on_error.ignore();
-            return bsl::errc_success;
+            constexpr auto one{1_umax};
+            constexpr auto aligned{0_umax};
+            return (addr & (size - one)) == aligned;
         }
 
         /// <!-- description -->
-        ///   @brief Releases all of the resources used by the RPT.
+        ///   @brief Sets the read/write and execute bits of the provided
+        ///     leaf entry using the provided flags.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
-        ///   @param mut_page_pool the page_pool_t to use
+        ///   @tparam ENTRY_CONCEPT the type of entry to set
+        ///   @param pmut_entry the entry to set
+        ///   @param flags defines how memory should be mapped
         ///
-        constexpr void
-        release(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
+        template<typename ENTRY_CONCEPT>
+        static constexpr void
+        set_flags(ENTRY_CONCEPT *const pmut_entry, bsl::safe_uintmax const &flags) noexcept
         {
-            lock_guard_t mut_lock{mut_tls, m_lock};
-            this->release_tables(mut_tls, mut_page_pool);
-        }
+            constexpr auto enable{1_umax};
+            constexpr auto disable{0_umax};
 
-        /// <!-- description -->
-        ///   @brief Returns true if this RPT is initialized.
-        ///
-        /// <!-- inputs/outputs -->
-        ///   @return Returns true if this RPT is initialized.
-        ///
-        [[nodiscard]] constexpr auto
-        is_initialized() const noexcept -> bool
-        {
-            return !!m_pml4t_phys;
+            if (!(flags & MAP_PAGE_WRITE).is_zero()) {
+                pmut_entry->rw = enable.get();
+            }
+            else {
+                pmut_entry->rw = disable.get();
+            }
+
+            if (!(flags & MAP_PAGE_EXECUTE).is_zero()) {
+                pmut_entry->nx = disable.get();
+            }
+            else {
+                pmut_entry->nx = enable.get();
+            }
         }
 
         /// <!-- description -->
-        ///   @brief Sets the current root page table to this root page table.
+        ///   @brief Given a pdpte_t or a pdte_t, this function turns the
+        ///     entry into a large page that maps the provided physical
+        ///     address using the provided flags.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param tls the current TLS block
-        ///   @param mut_intrinsic the intrinsic_t to use
-        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
-        ///     and friends otherwise
+        ///   @tparam ENTRY_CONCEPT the type of entry to set
+        ///   @param pmut_entry the entry to set
+        ///   @param phys the physical address to map
+        ///   @param flags defines how memory should be mapped
         ///
-        [[nodiscard]] constexpr auto
-        activate(tls_t const &tls, intrinsic_t &mut_intrinsic) const noexcept -> bsl::errc_type
+        template<typename ENTRY_CONCEPT>
+        static constexpr void
+        set_large_page(
+            ENTRY_CONCEPT *const pmut_entry,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &flags) noexcept
         {
-            bsl::discard(tls);
+            constexpr auto enable{1_umax};
 
-            if (bsl::unlikely_assert(!m_pml4t_phys)) {
-                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
-                return bsl::errc_failure;
-            }
+            pmut_entry->phys = (phys >> HYPERVISOR_PAGE_SHIFT).get();
+            pmut_entry->p = enable.get();
+            pmut_entry->us = enable.get();
+            pmut_entry->ps = enable.get();
 
-            mut_intrinsic.set_cr3(m_pml4t_phys);
-            return bsl::errc_success;
+            set_flags(pmut_entry, flags);
         }
 
         /// <!-- description -->
-        ///   @brief Maps a page into the root page table being managed
-        ///     by this class.
+        ///   @brief Maps a 2M or 1G page into the root page table being
+        ///     managed by this class. Large pages are always mapped using
+        ///     MAP_PAGE_NO_AUTO_RELEASE as they are not allocated from the
+        ///     page pool.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
@@ -1162,18 +1301,21 @@ namespace mk
         ///     too.
         ///   @param page_phys the physical address to map.
         ///   @param page_flags defines how memory should be mapped
-        ///   @param auto_release defines what auto release tag to use
-        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
-        ///     and friends otherwise
+        ///   @param page_size either RPT_PAGE_SIZE_2M or RPT_PAGE_SIZE_1G
+        ///   @return Returns bsl::errc_success on success. Returns
+        ///     bsl::errc_unsupported if part of the range is already mapped
+        ///     using a smaller page size, bsl::errc_already_exists if the
+        ///     range is already mapped using a large page, and
+        ///     bsl::errc_failure and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        map_page(
+        map_large_page(
             tls_t &mut_tls,
             page_pool_t &mut_page_pool,
             bsl::safe_uintmax const &page_virt,
             bsl::safe_uintmax const &page_phys,
             bsl::safe_uintmax const &page_flags,
-            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+            bsl::safe_uintmax const &page_size) noexcept -> bsl::errc_type
         {
             constexpr auto disabled{0_umax};
             lock_guard_t mut_lock{mut_tls, m_lock};
@@ -1192,11 +1334,13 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely_assert(!this->is_page_aligned(page_virt))) {
-                bsl::error() << "virtual address is not page aligned "    // --
-                             << bsl::hex(page_virt)                       // --
-                             << bsl::endl                                 // --
-                             << bsl::here();                              // --
+            if (bsl::unlikely_assert(!is_aligned_to(page_virt, page_size))) {
+                bsl::error() << "virtual address "       // --
+                             << bsl::hex(page_virt)      // --
+                             << " is not aligned to "    // --
+                             << bsl::hex(page_size)      // --
+                             << bsl::endl                // --
+                             << bsl::here();             // --
 
                 return bsl::errc_failure;
             }
@@ -1210,11 +1354,13 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely_assert(!this->is_page_aligned(page_phys))) {
-                bsl::error() << "physical address is not page aligned "    // --
-                             << bsl::hex(page_phys)                        // --
-                             << bsl::endl                                  // --
-                             << bsl::here();                               // --
+            if (bsl::unlikely_assert(!is_aligned_to(page_phys, page_size))) {
+                bsl::error() << "physical address "      // --
+                             << bsl::hex(page_phys)      // --
+                             << " is not aligned to "    // --
+                             << bsl::hex(page_size)      // --
+                             << bsl::endl                // --
+                             << bsl::here();             // --
 
                 return bsl::errc_failure;
             }
@@ -1244,24 +1390,6 @@ namespace mk
                 bsl::touch();
             }
 
-            if (bsl::unlikely_assert(!auto_release)) {
-                bsl::error() << "invalid auto release "    // --
-                             << auto_release               // --
-                             << bsl::endl                  // --
-                             << bsl::here();               // --
-
-                return bsl::errc_failure;
-            }
-
-            if (bsl::unlikely_assert(!(auto_release < MAP_PAGE_AUTO_RELEASE_MAX))) {
-                bsl::error() << "invalid auto release "    // --
-                             << auto_release               // --
-                             << bsl::endl                  // --
-                             << bsl::here();               // --
-
-                return bsl::errc_failure;
-            }
-
             auto *const pmut_pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
             if (disabled == pmut_pml4te->p) {
                 if (bsl::unlikely(!this->add_pdpt(mut_tls, mut_page_pool, pmut_pml4te))) {
@@ -1274,11 +1402,8 @@ namespace mk
             else {
 
                 /// NOTE:
-                /// - The loader doesn't map in the memory associated with
-                ///   the microkernel's page tables. This means this code
-                ///   cannot walk any pages mapped to the microkernel, it
-                ///   can only alias these pages. For this reason, mapping
-                ///   must always take place on userspace specific memory.
+                /// - See map_page for more details. Mapping must always
+                ///   take place on userspace specific memory.
                 ///
 
                 if (disabled == pmut_pml4te->us) {
@@ -1294,8 +1419,36 @@ namespace mk
                 bsl::touch();
             }
 
+            /// NOTE:
+            /// - If part of the range is already mapped using a table, we
+            ///   return bsl::errc_unsupported without reporting an error.
+            ///   This tells map_pages() to fall back to a smaller page size
+            ///   as any existing table is either in use, or was left behind
+            ///   by a previous unmap (tables are only released when the
+            ///   root page table itself is released).
+            ///
+
             auto *const pmut_pdpt{get_pdpt(mut_page_pool, pmut_pml4te)};
             auto *const pmut_pdpte{pmut_pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (RPT_PAGE_SIZE_1G == page_size) {
+                if (disabled == pmut_pdpte->p) {
+                    set_large_page(pmut_pdpte, page_phys, page_flags);
+                    return bsl::errc_success;
+                }
+
+                if (disabled == pmut_pdpte->ps) {
+                    return bsl::errc_unsupported;
+                }
+
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " already mapped"      // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::errc_already_exists;
+            }
+
             if (disabled == pmut_pdpte->p) {
                 if (bsl::unlikely(!this->add_pdt(mut_tls, mut_page_pool, pmut_pdpte))) {
                     bsl::print<bsl::V>() << bsl::here();
@@ -1305,97 +1458,1821 @@ namespace mk
                 bsl::touch();
             }
             else {
+                if (bsl::unlikely(disabled != pmut_pdpte->ps)) {
+                    bsl::error() << "virtual address "     // --
+                                 << bsl::hex(page_virt)    // --
+                                 << " already mapped"      // --
+                                 << bsl::endl              // --
+                                 << bsl::here();           // --
+
+                    return bsl::errc_already_exists;
+                }
+
                 bsl::touch();
             }
 
             auto *const pmut_pdt{get_pdt(mut_page_pool, pmut_pdpte)};
             auto *const pmut_pdte{pmut_pdt->entries.at_if(this->pdto(page_virt))};
             if (disabled == pmut_pdte->p) {
-                if (bsl::unlikely(!this->add_pt(mut_tls, mut_page_pool, pmut_pdte))) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return bsl::errc_failure;
-                }
-
-                bsl::touch();
+                set_large_page(pmut_pdte, page_phys, page_flags);
+                return bsl::errc_success;
             }
-            else {
-                bsl::touch();
+
+            if (disabled == pmut_pdte->ps) {
+                return bsl::errc_unsupported;
             }
 
-            auto *const pmut_pt{get_pt(mut_page_pool, pmut_pdte)};
-            auto *const pmut_pte{pmut_pt->entries.at_if(this->pto(page_virt))};
-            if (bsl::unlikely(disabled != pmut_pte->p)) {
+            bsl::error() << "virtual address "     // --
+                         << bsl::hex(page_virt)    // --
+                         << " already mapped"      // --
+                         << bsl::endl              // --
+                         << bsl::here();           // --
+
+            return bsl::errc_already_exists;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the leaf entry that maps the provided virtual
+        ///     address. If the address is mapped using a large page, the
+        ///     large page is only unmapped if the entire large page falls
+        ///     within the range being unmapped. Partially unmapping a
+        ///     large page is not supported. The caller must hold the lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to unmap
+        ///   @param bytes the total number of bytes left in the range being
+        ///     unmapped, starting at page_virt
+        ///   @param auto_release the auto release tag the page was mapped with
+        ///   @return Returns the total number of bytes that were unmapped
+        ///     on success, or bsl::safe_uintmax::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_leaf(
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto disabled{0_umax};
+
+            auto *const pmut_pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pml4te->p || disabled == pmut_pml4te->us)) {
                 bsl::error() << "virtual address "     // --
                              << bsl::hex(page_virt)    // --
-                             << " already mapped"      // --
+                             << " is not mapped"       // --
                              << bsl::endl              // --
                              << bsl::here();           // --
 
-                return bsl::errc_already_exists;
+                return bsl::safe_uintmax::failure();
             }
 
-            constexpr auto enable{1_umax};
-            constexpr auto disable{0_umax};
-
+            auto *const pmut_pdpt{get_pdpt(page_pool, pmut_pml4te)};
+            auto *const pmut_pdpte{pmut_pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pdpte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            if (disabled != pmut_pdpte->ps) {
+                if (bsl::unlikely(!this->can_unmap_large_page(
+                        page_virt, bytes, RPT_PAGE_SIZE_1G, auto_release))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                *pmut_pdpte = {};
+                return RPT_PAGE_SIZE_1G;
+            }
+
+            auto *const pmut_pdt{get_pdt(page_pool, pmut_pdpte)};
+            auto *const pmut_pdte{pmut_pdt->entries.at_if(this->pdto(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pdte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            if (disabled != pmut_pdte->ps) {
+                if (bsl::unlikely(!this->can_unmap_large_page(
+                        page_virt, bytes, RPT_PAGE_SIZE_2M, auto_release))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                *pmut_pdte = {};
+                return RPT_PAGE_SIZE_2M;
+            }
+
+            auto *const pmut_pt{get_pt(page_pool, pmut_pdte)};
+            auto *const pmut_pte{pmut_pt->entries.at_if(this->pto(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            if (bsl::unlikely(bsl::to_umax(pmut_pte->auto_release) != auto_release)) {
+                bsl::error() << "virtual address "                      // --
+                             << bsl::hex(page_virt)                     // --
+                             << " was not mapped with auto release "    // --
+                             << auto_release                            // --
+                             << bsl::endl                               // --
+                             << bsl::here();                            // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            *pmut_pte = {};
+            return HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a large page of the provided size that
+        ///     maps page_virt can be unmapped given the remaining bytes in
+        ///     the range being unmapped and the provided auto release tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_virt the virtual address to unmap
+        ///   @param bytes the total number of bytes left in the range being
+        ///     unmapped, starting at page_virt
+        ///   @param page_size the size of the large page
+        ///   @param auto_release the auto release tag the page was mapped with
+        ///   @return Returns true if the large page can be unmapped
+        ///
+        [[nodiscard]] static constexpr auto
+        can_unmap_large_page(
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &page_size,
+            bsl::safe_uintmax const &auto_release) noexcept -> bool
+        {
+            if (bsl::unlikely(MAP_PAGE_NO_AUTO_RELEASE != auto_release)) {
+                bsl::error() << "virtual address "                      // --
+                             << bsl::hex(page_virt)                     // --
+                             << " was not mapped with auto release "    // --
+                             << auto_release                            // --
+                             << bsl::endl                               // --
+                             << bsl::here();                            // --
+
+                return false;
+            }
+
+            if (bsl::unlikely(!covers_large_page(page_virt, bytes, page_size))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the range that starts at page_virt
+        ///     covers the entire large page of the provided size that
+        ///     maps page_virt. Large pages cannot be partially unmapped
+        ///     or protected.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_virt the virtual address of the large page
+        ///   @param bytes the total number of bytes left in the range,
+        ///     starting at page_virt
+        ///   @param page_size the size of the large page
+        ///   @return Returns true if the range covers the large page
+        ///
+        [[nodiscard]] static constexpr auto
+        covers_large_page(
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &page_size) noexcept -> bool
+        {
+            if (bsl::unlikely(!is_aligned_to(page_virt, page_size) || bytes < page_size)) {
+                bsl::error() << "virtual address "                          // --
+                             << bsl::hex(page_virt)                         // --
+                             << " is mapped using a large page of size "    // --
+                             << bsl::hex(page_size)                         // --
+                             << " which cannot be partially changed"        // --
+                             << bsl::endl                                   // --
+                             << bsl::here();                                // --
+
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of the leaf entry that maps the
+        ///     provided virtual address. If the address is mapped using a
+        ///     large page, the entire large page must fall within the
+        ///     range being protected. The caller must hold the lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to protect
+        ///   @param bytes the total number of bytes left in the range being
+        ///     protected, starting at page_virt
+        ///   @param flags the new flags to map the page with
+        ///   @return Returns the total number of bytes that were protected
+        ///     on success, or bsl::safe_uintmax::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        protect_leaf(
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags) noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto disabled{0_umax};
+
+            auto *const pmut_pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pml4te->p || disabled == pmut_pml4te->us)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            auto *const pmut_pdpt{get_pdpt(page_pool, pmut_pml4te)};
+            auto *const pmut_pdpte{pmut_pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pdpte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            if (disabled != pmut_pdpte->ps) {
+                if (bsl::unlikely(!covers_large_page(page_virt, bytes, RPT_PAGE_SIZE_1G))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                set_flags(pmut_pdpte, flags);
+                return RPT_PAGE_SIZE_1G;
+            }
+
+            auto *const pmut_pdt{get_pdt(page_pool, pmut_pdpte)};
+            auto *const pmut_pdte{pmut_pdt->entries.at_if(this->pdto(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pdte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            if (disabled != pmut_pdte->ps) {
+                if (bsl::unlikely(!covers_large_page(page_virt, bytes, RPT_PAGE_SIZE_2M))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                set_flags(pmut_pdte, flags);
+                return RPT_PAGE_SIZE_2M;
+            }
+
+            auto *const pmut_pt{get_pt(page_pool, pmut_pdte)};
+            auto *const pmut_pte{pmut_pt->entries.at_if(this->pto(page_virt))};
+            if (bsl::unlikely(disabled == pmut_pte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::safe_uintmax::failure();
+            }
+
+            set_flags(pmut_pte, flags);
+            return HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps the leaf entry for the provided virtual address
+        ///     if it is not already mapped. If the virtual address is
+        ///     already mapped (using any page size), the mapping is left
+        ///     as is and skipped. The caller must hold the lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to map
+        ///   @param page_phys the physical address to map
+        ///   @param bytes the total number of bytes left in the range being
+        ///     populated, starting at page_virt
+        ///   @param flags defines how memory should be mapped
+        ///   @param use_2m if true, 2M pages are used where possible
+        ///   @return Returns the total number of bytes that were mapped or
+        ///     skipped on success, or bsl::safe_uintmax::failure() on
+        ///     failure.
+        ///
+        [[nodiscard]] constexpr auto
+        populate_leaf(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags,
+            bool const use_2m) noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto one{1_umax};
+            constexpr auto disabled{0_umax};
+
+            auto *const pmut_pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (disabled == pmut_pml4te->p) {
+                if (bsl::unlikely(!this->add_pdpt(mut_tls, mut_page_pool, pmut_pml4te))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                bsl::touch();
+            }
+            else {
+
+                /// NOTE:
+                /// - See map_page for more details. Mapping must always
+                ///   take place on userspace specific memory.
+                ///
+
+                if (disabled == pmut_pml4te->us) {
+                    bsl::error() << "attempt to map the userspace address "              // --
+                                 << bsl::hex(page_virt)                                  // --
+                                 << " in an address range owned by the kernel failed"    // --
+                                 << bsl::endl                                            // --
+                                 << bsl::here();                                         // --
+
+                    return bsl::safe_uintmax::failure();
+                }
+
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - Existing large pages are skipped up to the next large
+            ///   page boundary. The range is physically contiguous, so
+            ///   the remaining bytes never need to be checked here.
+            ///
+
+            auto *const pmut_pdpt{get_pdpt(mut_page_pool, pmut_pml4te)};
+            auto *const pmut_pdpte{pmut_pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (disabled == pmut_pdpte->p) {
+                if (bsl::unlikely(!this->add_pdt(mut_tls, mut_page_pool, pmut_pdpte))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                bsl::touch();
+            }
+            else {
+                if (disabled != pmut_pdpte->ps) {
+                    return RPT_PAGE_SIZE_1G - (page_virt & (RPT_PAGE_SIZE_1G - one));
+                }
+
+                bsl::touch();
+            }
+
+            auto *const pmut_pdt{get_pdt(mut_page_pool, pmut_pdpte)};
+            auto *const pmut_pdte{pmut_pdt->entries.at_if(this->pdto(page_virt))};
+            if (disabled == pmut_pdte->p) {
+                bool mut_use_2m{use_2m};
+                mut_use_2m = mut_use_2m && !(bytes < RPT_PAGE_SIZE_2M);
+                mut_use_2m = mut_use_2m && is_aligned_to(page_virt, RPT_PAGE_SIZE_2M);
+                mut_use_2m = mut_use_2m && is_aligned_to(page_phys, RPT_PAGE_SIZE_2M);
+
+                if (mut_use_2m) {
+                    set_large_page(pmut_pdte, page_phys, flags);
+                    return RPT_PAGE_SIZE_2M;
+                }
+
+                if (bsl::unlikely(!this->add_pt(mut_tls, mut_page_pool, pmut_pdte))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::failure();
+                }
+
+                bsl::touch();
+            }
+            else {
+                if (disabled != pmut_pdte->ps) {
+                    return RPT_PAGE_SIZE_2M - (page_virt & (RPT_PAGE_SIZE_2M - one));
+                }
+
+                bsl::touch();
+            }
+
+            auto *const pmut_pt{get_pt(mut_page_pool, pmut_pdte)};
+            auto *const pmut_pte{pmut_pt->entries.at_if(this->pto(page_virt))};
+            if (disabled != pmut_pte->p) {
+                return HYPERVISOR_PAGE_SIZE;
+            }
+
+            constexpr auto enable{1_umax};
+
+            pmut_pte->phys = (page_phys >> HYPERVISOR_PAGE_SHIFT).get();
+            pmut_pte->p = enable.get();
+            pmut_pte->us = enable.get();
+            pmut_pte->auto_release = MAP_PAGE_NO_AUTO_RELEASE.get();
+
+            set_flags(pmut_pte, flags);
+            return HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the 4k leaf entry that maps the provided virtual
+        ///     address if it was mapped using MAP_PAGE_NO_AUTO_RELEASE.
+        ///     Anything else (including large pages and addresses that are
+        ///     not mapped) is skipped. The caller must hold the lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to reclaim
+        ///   @return Returns true if the page was unmapped, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reclaim_leaf(page_pool_t const &page_pool, bsl::safe_uintmax const &page_virt) noexcept
+            -> bool
+        {
+            constexpr auto disabled{0_umax};
+
+            auto *const pmut_pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (disabled == pmut_pml4te->p || disabled == pmut_pml4te->us) {
+                return false;
+            }
+
+            auto *const pmut_pdpt{get_pdpt(page_pool, pmut_pml4te)};
+            auto *const pmut_pdpte{pmut_pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (disabled == pmut_pdpte->p || disabled != pmut_pdpte->ps) {
+                return false;
+            }
+
+            auto *const pmut_pdt{get_pdt(page_pool, pmut_pdpte)};
+            auto *const pmut_pdte{pmut_pdt->entries.at_if(this->pdto(page_virt))};
+            if (disabled == pmut_pdte->p || disabled != pmut_pdte->ps) {
+                return false;
+            }
+
+            auto *const pmut_pt{get_pt(page_pool, pmut_pdte)};
+            auto *const pmut_pte{pmut_pt->entries.at_if(this->pto(page_virt))};
+            if (disabled == pmut_pte->p) {
+                return false;
+            }
+
+            if (bsl::to_umax(pmut_pte->auto_release) != MAP_PAGE_NO_AUTO_RELEASE) {
+                return false;
+            }
+
+            *pmut_pte = {};
+            return true;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Initializes this root_page_table_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        initialize(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t already initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            bsl::finally mut_release_on_error{[this, &mut_tls, &mut_page_pool]() noexcept -> void {
+                this->release(mut_tls, mut_page_pool);
+            }};
+
+            m_pml4t = mut_page_pool.template allocate<pml4t_t>(mut_tls, ALLOCATE_TAG_PML4TS);
+            if (bsl::unlikely(nullptr == m_pml4t)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            m_pml4t_phys = mut_page_pool.virt_to_phys(m_pml4t);
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            mut_release_on_error.ignore();
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases all of the resources used by the RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        release(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+            this->release_tables(mut_tls, mut_page_pool);
+
+            /// NOTE:
+            /// - The RPT (and its PCID) might be initialized again, so any
+            ///   PP that used the old tables must flush the TLB the next
+            ///   time it activates this RPT.
+            ///
+
+            this->next_generation();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this RPT is initialized.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this RPT is initialized.
+        ///
+        [[nodiscard]] constexpr auto
+        is_initialized() const noexcept -> bool
+        {
+            return !!m_pml4t_phys;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the current root page table to this root page table.
+        ///     If this RPT changed since the current PP last activated it,
+        ///     the TLB entries associated with this RPT are flushed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        activate(tls_t const &tls, intrinsic_t &mut_intrinsic) noexcept -> bsl::errc_type
+        {
+            constexpr auto disabled{0_umax};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto *const pmut_pp_generation{m_pp_generations.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_pp_generation)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - When PCIDs are enabled, the TLB entries tagged with this
+            ///   RPT's PCID are kept, which is what makes switching between
+            ///   RPTs cheap. If this RPT changed since this PP last used it,
+            ///   CR3 is loaded without the no-flush bit, which flushes the
+            ///   TLB entries tagged with this RPT's PCID (and only those).
+            /// - When PCIDs are disabled, loading CR3 always flushes the
+            ///   TLB, so there is nothing else to do.
+            /// - The generation is read before CR3 is loaded, and this PP
+            ///   only records it once CR3 is loaded, so another PP never
+            ///   sees this PP at a generation whose flush has not happened
+            ///   yet. If another PP changes this RPT in between, this PP
+            ///   will flush again the next time it activates this RPT,
+            ///   which is safe.
+            ///
+
+            auto const generation{load_generation(&m_generation)};
+            auto const pp_generation{load_generation(pmut_pp_generation)};
+            if (disabled == tls.pcid_enabled) {
+                mut_intrinsic.set_cr3(m_pml4t_phys);
+            }
+            else if (!pp_generation.is_zero() && pp_generation != generation) {
+                mut_intrinsic.set_cr3(m_pml4t_phys | m_pcid);
+            }
+            else {
+                mut_intrinsic.set_cr3(m_pml4t_phys | m_pcid | RPT_CR3_NOFLUSH);
+            }
+
+            store_generation(pmut_pp_generation, generation);
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this RPT was changed (i.e., memory was
+        ///     unmapped or protected) since the current PP last activated
+        ///     it, meaning the TLB of the current PP might still contain
+        ///     stale entries for this RPT. PPs that never activated this
+        ///     RPT cannot have stale entries, and as such, never need to
+        ///     flush the TLB because of changes made to this RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the current PP must flush the TLB
+        ///     entries associated with this RPT before using it again.
+        ///
+        [[nodiscard]] constexpr auto
+        is_stale(tls_t const &tls) const noexcept -> bool
+        {
+            auto const *const pp_generation{m_pp_generations.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pp_generation)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return true;
+            }
+
+            auto const generation{load_generation(pp_generation)};
+            if (generation.is_zero()) {
+                return false;
+            }
+
+            return generation != load_generation(&m_generation);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the current generation of this RPT. The
+        ///     generation is incremented each time memory is unmapped or
+        ///     protected, so the generation returned after unmapping
+        ///     memory identifies that unmap (see is_flushed).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current generation of this RPT
+        ///
+        [[nodiscard]] constexpr auto
+        generation() const noexcept -> bsl::safe_uintmax
+        {
+            return load_generation(&m_generation);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every PP other than the current PP
+        ///     either never activated this RPT, or activated it again
+        ///     after it reached the provided generation, meaning that no
+        ///     other PP can still have TLB entries for memory that was
+        ///     unmapped before this RPT reached the provided generation.
+        ///     The current PP is skipped as it is up to the PP that unmaps
+        ///     memory to flush it from its own TLB.
+        ///
+        /// <!-- notes -->
+        ///   @note A PP reads the generation before it loads CR3, and only
+        ///     records it once CR3 is loaded (see activate). A PP that is
+        ///     in the middle of being activated still shows its older
+        ///     generation, so it is reported as not flushed, which is safe.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param generation the generation to check against
+        ///   @return Returns true if every other PP flushed the TLB entries
+        ///     this RPT had before it reached the provided generation
+        ///
+        [[nodiscard]] constexpr auto
+        is_flushed(tls_t const &tls, bsl::safe_uintmax const &generation) const noexcept
+            -> bool
+        {
+            for (auto const pp_generation : m_pp_generations) {
+                if (pp_generation.index == bsl::to_umax(tls.ppid)) {
+                    continue;
+                }
+
+                auto const pp_gen{load_generation(pp_generation.data)};
+                if (pp_gen.is_zero()) {
+                    continue;
+                }
+
+                if (pp_gen < generation) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells this RPT that the current PP already flushed the
+        ///     TLB entries for the change that brought this RPT to the
+        ///     provided generation (e.g., using invlpg or INVPCID). If that
+        ///     was the only change the current PP had not flushed yet, the
+        ///     current PP is up to date again, and will not flush all of
+        ///     this RPT's TLB entries the next time it activates it.
+        ///     Otherwise, this does nothing.
+        ///
+        /// <!-- notes -->
+        ///   @note Only the current PP ever writes its own generation, so
+        ///     there is no need to take the lock. If another PP changes
+        ///     this RPT after the change the current PP flushed, the
+        ///     provided generation is no longer right after the current
+        ///     PP's generation, and the current PP stays stale, which is
+        ///     safe.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param generation the generation this RPT reached with the
+        ///     change that the current PP flushed
+        ///
+        constexpr void
+        mark_flushed(tls_t const &tls, bsl::safe_uintmax const &generation) noexcept
+        {
+            auto *const pmut_pp_generation{m_pp_generations.at_if(bsl::to_umax(tls.ppid))};
+            if (bsl::unlikely_assert(nullptr == pmut_pp_generation)) {
+                bsl::error() << "invalid ppid "       // --
+                             << bsl::hex(tls.ppid)    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return;
+            }
+
+            auto const pp_generation{load_generation(pmut_pp_generation)};
+            if (pp_generation.is_zero()) {
+                return;
+            }
+
+            if (pp_generation + 1_umax != generation) {
+                return;
+            }
+
+            store_generation(pmut_pp_generation, generation);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the PCID used by this RPT when CR4.PCIDE is set.
+        ///     PCID 0 is used by the microkernel's system RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pcid the PCID to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_pcid(bsl::safe_uintmax const &pcid) noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(!pcid)) {
+                bsl::error() << "invalid pcid "    // --
+                             << bsl::hex(pcid)     // --
+                             << bsl::endl          // --
+                             << bsl::here();       // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(pcid > RPT_MAX_PCID)) {
+                bsl::error() << "invalid pcid "    // --
+                             << bsl::hex(pcid)     // --
+                             << bsl::endl          // --
+                             << bsl::here();       // --
+
+                return bsl::errc_failure;
+            }
+
+            m_pcid = pcid;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PCID used by this RPT when CR4.PCIDE is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the PCID used by this RPT when CR4.PCIDE is set.
+        ///
+        [[nodiscard]] constexpr auto
+        pcid() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_pcid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a page into the root page table being managed
+        ///     by this class.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to map the physical address
+        ///     too.
+        ///   @param page_phys the physical address to map.
+        ///   @param page_flags defines how memory should be mapped
+        ///   @param auto_release defines what auto release tag to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_page(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys,
+            bsl::safe_uintmax const &page_flags,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            constexpr auto disabled{0_umax};
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(page_virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(page_virt)              // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!this->is_page_aligned(page_virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(page_virt)                       // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(page_phys.is_zero_or_invalid())) {
+                bsl::error() << "physical address is invalid "    // --
+                             << bsl::hex(page_phys)               // --
+                             << bsl::endl                         // --
+                             << bsl::here();                      // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!this->is_page_aligned(page_phys))) {
+                bsl::error() << "physical address is not page aligned "    // --
+                             << bsl::hex(page_phys)                        // --
+                             << bsl::endl                                  // --
+                             << bsl::here();                               // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(page_flags.is_zero_or_invalid())) {
+                bsl::error() << "invalid flags "        // --
+                             << bsl::hex(page_flags)    // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return bsl::errc_failure;
+            }
+
+            if ((page_flags & MAP_PAGE_WRITE).is_pos()) {
+                if (bsl::unlikely_assert((page_flags & MAP_PAGE_EXECUTE).is_pos())) {
+                    bsl::error() << "invalid page_flags "    // --
+                                 << bsl::hex(page_flags)     // --
+                                 << bsl::endl                // --
+                                 << bsl::here();             // --
+
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely_assert(!auto_release)) {
+                bsl::error() << "invalid auto release "    // --
+                             << auto_release               // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!(auto_release < MAP_PAGE_AUTO_RELEASE_MAX))) {
+                bsl::error() << "invalid auto release "    // --
+                             << auto_release               // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return bsl::errc_failure;
+            }
+
+            auto *const pmut_pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (disabled == pmut_pml4te->p) {
+                if (bsl::unlikely(!this->add_pdpt(mut_tls, mut_page_pool, pmut_pml4te))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+
+                /// NOTE:
+                /// - The loader doesn't map in the memory associated with
+                ///   the microkernel's page tables. This means this code
+                ///   cannot walk any pages mapped to the microkernel, it
+                ///   can only alias these pages. For this reason, mapping
+                ///   must always take place on userspace specific memory.
+                ///
+
+                if (disabled == pmut_pml4te->us) {
+                    bsl::error() << "attempt to map the userspace address "              // --
+                                 << bsl::hex(page_virt)                                  // --
+                                 << " in an address range owned by the kernel failed"    // --
+                                 << bsl::endl                                            // --
+                                 << bsl::here();                                         // --
+
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
+            auto *const pmut_pdpt{get_pdpt(mut_page_pool, pmut_pml4te)};
+            auto *const pmut_pdpte{pmut_pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (disabled == pmut_pdpte->p) {
+                if (bsl::unlikely(!this->add_pdt(mut_tls, mut_page_pool, pmut_pdpte))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+                if (bsl::unlikely(disabled != pmut_pdpte->ps)) {
+                    bsl::error() << "virtual address "     // --
+                                 << bsl::hex(page_virt)    // --
+                                 << " already mapped"      // --
+                                 << bsl::endl              // --
+                                 << bsl::here();           // --
+
+                    return bsl::errc_already_exists;
+                }
+
+                bsl::touch();
+            }
+
+            auto *const pmut_pdt{get_pdt(mut_page_pool, pmut_pdpte)};
+            auto *const pmut_pdte{pmut_pdt->entries.at_if(this->pdto(page_virt))};
+            if (disabled == pmut_pdte->p) {
+                if (bsl::unlikely(!this->add_pt(mut_tls, mut_page_pool, pmut_pdte))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+                if (bsl::unlikely(disabled != pmut_pdte->ps)) {
+                    bsl::error() << "virtual address "     // --
+                                 << bsl::hex(page_virt)    // --
+                                 << " already mapped"      // --
+                                 << bsl::endl              // --
+                                 << bsl::here();           // --
+
+                    return bsl::errc_already_exists;
+                }
+
+                bsl::touch();
+            }
+
+            auto *const pmut_pt{get_pt(mut_page_pool, pmut_pdte)};
+            auto *const pmut_pte{pmut_pt->entries.at_if(this->pto(page_virt))};
+            if (bsl::unlikely(disabled != pmut_pte->p)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " already mapped"      // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::errc_already_exists;
+            }
+
+            constexpr auto enable{1_umax};
+
             pmut_pte->phys = (page_phys >> HYPERVISOR_PAGE_SHIFT).get();
             pmut_pte->p = enable.get();
             pmut_pte->us = enable.get();
             pmut_pte->auto_release = auto_release.get();
 
-            if (!(page_flags & MAP_PAGE_WRITE).is_zero()) {
-                pmut_pte->rw = enable.get();
+            set_flags(pmut_pte, page_flags);
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a page into the root page table being managed
+        ///     by this class. This version allows for unaligned virtual and
+        ///     physical addresses and will perform the alignment for you.
+        ///     Note that you should only use this function if you actually
+        ///     need unaligned support to ensure alignment mistakes are not
+        ///     accidentally introduced.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to map the physical address
+        ///     too.
+        ///   @param page_phys the physical address to map. If the physical
+        ///     address is set to 0, map_page will use the page pool to
+        ///     determine the physical address.
+        ///   @param page_flags defines how memory should be mapped
+        ///   @param auto_release defines what auto release tag to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_page_unaligned(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys,
+            bsl::safe_uintmax const &page_flags,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            return this->map_page(
+                mut_tls,
+                mut_page_pool,
+                this->page_aligned(page_virt),
+                this->page_aligned(page_phys),
+                page_flags,
+                auto_release);
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a page from the root page table being managed
+        ///     by this class. The page is only unmapped if it was mapped
+        ///     using the provided auto release tag, which allows the caller
+        ///     to prove that it owns the mapping. The physical page itself
+        ///     is not freed (that is up to the caller), and neither are any
+        ///     of the page tables that were used to map the page. It is
+        ///     also up to the caller to flush the TLB of the current PP.
+        ///     Any other PP that used this RPT will flush the TLB the next
+        ///     time it activates this RPT (see is_stale for details).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to unmap
+        ///   @param auto_release the auto release tag the page was mapped with
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_page(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(page_virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(page_virt)              // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(page_virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(page_virt)                       // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!(auto_release < MAP_PAGE_AUTO_RELEASE_MAX))) {
+                bsl::error() << "invalid auto release "    // --
+                             << auto_release               // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return bsl::errc_failure;
+            }
+
+            auto const bytes{
+                this->unmap_leaf(page_pool, page_virt, HYPERVISOR_PAGE_SIZE, auto_release)};
+            if (bsl::unlikely(!bytes)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            this->next_generation();
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a 2M page into the root page table being managed
+        ///     by this class. Large pages are always mapped using
+        ///     MAP_PAGE_NO_AUTO_RELEASE, meaning the caller owns the memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the 2M aligned virtual address to map the
+        ///     physical address too.
+        ///   @param page_phys the 2M aligned physical address to map.
+        ///   @param page_flags defines how memory should be mapped
+        ///   @return Returns bsl::errc_success on success. Returns
+        ///     bsl::errc_unsupported if part of the range is already mapped
+        ///     using 4k pages, and bsl::errc_failure and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_page_2m(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys,
+            bsl::safe_uintmax const &page_flags) noexcept -> bsl::errc_type
+        {
+            return this->map_large_page(
+                mut_tls, mut_page_pool, page_virt, page_phys, page_flags, RPT_PAGE_SIZE_2M);
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a 1G page into the root page table being managed
+        ///     by this class. Large pages are always mapped using
+        ///     MAP_PAGE_NO_AUTO_RELEASE, meaning the caller owns the memory.
+        ///
+        /// <!-- notes -->
+        ///   @note Not all CPUs support 1G pages. It is up to the caller to
+        ///     make sure CPUID.80000001H:EDX.Page1GB[bit 26] is set before
+        ///     calling this function. For this reason, map_pages() never
+        ///     uses 1G pages on its own.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the 1G aligned virtual address to map the
+        ///     physical address too.
+        ///   @param page_phys the 1G aligned physical address to map.
+        ///   @param page_flags defines how memory should be mapped
+        ///   @return Returns bsl::errc_success on success. Returns
+        ///     bsl::errc_unsupported if part of the range is already mapped
+        ///     using smaller pages, and bsl::errc_failure and friends
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_page_1g(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys,
+            bsl::safe_uintmax const &page_flags) noexcept -> bsl::errc_type
+        {
+            return this->map_large_page(
+                mut_tls, mut_page_pool, page_virt, page_phys, page_flags, RPT_PAGE_SIZE_1G);
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a physically contiguous range of memory into the
+        ///     root page table being managed by this class. If the range
+        ///     is mapped using MAP_PAGE_NO_AUTO_RELEASE, 2M pages are used
+        ///     wherever both the virtual and physical addresses are 2M
+        ///     aligned and at least 2M of the range is left. Everything
+        ///     else is mapped using 4k pages.
+        ///
+        /// <!-- notes -->
+        ///   @note If an error occurs, the part of the range that was
+        ///     already mapped remains mapped. It is up to the caller to
+        ///     unmap it using unmap_pages().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param virt the page aligned virtual address to map the
+        ///     physical address too.
+        ///   @param phys the page aligned physical address to map.
+        ///   @param bytes the total number of bytes to map (must be page
+        ///     aligned)
+        ///   @param flags defines how memory should be mapped
+        ///   @param auto_release defines what auto release tag to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_pages(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(bytes.is_zero_or_invalid())) {
+                bsl::error() << "invalid number of bytes "    // --
+                             << bsl::hex(bytes)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!this->is_page_aligned(bytes))) {
+                bsl::error() << "number of bytes is not page aligned "    // --
+                             << bsl::hex(bytes)                           // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            bsl::safe_uintmax mut_offs{};
+            while (mut_offs < bytes) {
+                auto const page_virt{virt + mut_offs};
+                auto const page_phys{phys + mut_offs};
+
+                bool mut_use_2m{MAP_PAGE_NO_AUTO_RELEASE == auto_release};
+                mut_use_2m = mut_use_2m && !(bytes - mut_offs < RPT_PAGE_SIZE_2M);
+                mut_use_2m = mut_use_2m && is_aligned_to(page_virt, RPT_PAGE_SIZE_2M);
+                mut_use_2m = mut_use_2m && is_aligned_to(page_phys, RPT_PAGE_SIZE_2M);
+
+                if (mut_use_2m) {
+                    auto const ret{
+                        this->map_page_2m(mut_tls, mut_page_pool, page_virt, page_phys, flags)};
+
+                    if (ret) {
+                        mut_offs += RPT_PAGE_SIZE_2M;
+                        continue;
+                    }
+
+                    if (bsl::unlikely(bsl::errc_unsupported != ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return ret;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto const ret{this->map_page(
+                    mut_tls, mut_page_pool, page_virt, page_phys, flags, auto_release)};
+
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                mut_offs += HYPERVISOR_PAGE_SIZE;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range of memory from the root page table being
+        ///     managed by this class. Each page is only unmapped if it was
+        ///     mapped using the provided auto release tag (see unmap_page
+        ///     for more details). Large pages are unmapped as a whole, which
+        ///     means that a large page can only be unmapped if the range
+        ///     covers the entire large page. It is up to the caller to flush
+        ///     the TLB of the current PP (see unmap_page for details).
+        ///
+        /// <!-- notes -->
+        ///   @note If an error occurs, the part of the range that was
+        ///     already unmapped remains unmapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the page aligned virtual address to unmap
+        ///   @param bytes the total number of bytes to unmap (must be page
+        ///     aligned)
+        ///   @param auto_release the auto release tag the range was mapped
+        ///     with
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_pages(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(virt)                   // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(virt)                            // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(bytes.is_zero_or_invalid())) {
+                bsl::error() << "invalid number of bytes "    // --
+                             << bsl::hex(bytes)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(bytes))) {
+                bsl::error() << "number of bytes is not page aligned "    // --
+                             << bsl::hex(bytes)                           // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!(auto_release < MAP_PAGE_AUTO_RELEASE_MAX))) {
+                bsl::error() << "invalid auto release "    // --
+                             << auto_release               // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return bsl::errc_failure;
             }
-            else {
-                pmut_pte->rw = disable.get();
+
+            /// NOTE:
+            /// - Part of the range might be unmapped even if an error
+            ///   occurs, so the generation is always incremented.
+            ///
+
+            bsl::finally mut_next_generation{[this]() noexcept -> void {
+                this->next_generation();
+            }};
+
+            bsl::safe_uintmax mut_offs{};
+            while (mut_offs < bytes) {
+                auto const unmapped{
+                    this->unmap_leaf(page_pool, virt + mut_offs, bytes - mut_offs, auto_release)};
+
+                if (bsl::unlikely(!unmapped)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_offs += unmapped;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of a range of memory that is already
+        ///     mapped into the root page table being managed by this class.
+        ///     Large pages are protected as a whole, which means that a large
+        ///     page can only be protected if the range covers the entire
+        ///     large page. It is up to the caller to flush the TLB of the
+        ///     current PP (see unmap_page for details).
+        ///
+        /// <!-- notes -->
+        ///   @note If an error occurs, the part of the range that was
+        ///     already protected keeps its new flags.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the page aligned virtual address to protect
+        ///   @param bytes the total number of bytes to protect (must be page
+        ///     aligned)
+        ///   @param flags defines how memory should be mapped
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        protect_pages(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags) noexcept -> bsl::errc_type
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
             }
 
-            if (!(page_flags & MAP_PAGE_EXECUTE).is_zero()) {
-                pmut_pte->nx = disable.get();
+            if (bsl::unlikely(virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(virt)                   // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
             }
-            else {
-                pmut_pte->nx = enable.get();
+
+            if (bsl::unlikely(!this->is_page_aligned(virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(virt)                            // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(bytes.is_zero_or_invalid())) {
+                bsl::error() << "invalid number of bytes "    // --
+                             << bsl::hex(bytes)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(bytes))) {
+                bsl::error() << "number of bytes is not page aligned "    // --
+                             << bsl::hex(bytes)                           // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(flags.is_zero_or_invalid())) {
+                bsl::error() << "invalid flags "    // --
+                             << bsl::hex(flags)     // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely((flags & MAP_PAGE_WRITE).is_pos() &&
+                              (flags & MAP_PAGE_EXECUTE).is_pos())) {
+                bsl::error() << "invalid flags "    // --
+                             << bsl::hex(flags)     // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - Part of the range might be protected even if an error
+            ///   occurs, so the generation is always incremented.
+            ///
+
+            bsl::finally mut_next_generation{[this]() noexcept -> void {
+                this->next_generation();
+            }};
+
+            bsl::safe_uintmax mut_offs{};
+            while (mut_offs < bytes) {
+                auto const protected_bytes{
+                    this->protect_leaf(page_pool, virt + mut_offs, bytes - mut_offs, flags)};
+
+                if (bsl::unlikely(!protected_bytes)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_offs += protected_bytes;
             }
 
             return bsl::errc_success;
         }
 
         /// <!-- description -->
-        ///   @brief Maps a page into the root page table being managed
-        ///     by this class. This version allows for unaligned virtual and
-        ///     physical addresses and will perform the alignment for you.
-        ///     Note that you should only use this function if you actually
-        ///     need unaligned support to ensure alignment mistakes are not
-        ///     accidentally introduced.
+        ///   @brief Maps a physically contiguous range of memory into the
+        ///     root page table being managed by this class, skipping any
+        ///     part of the range that is already mapped. Unlike map_pages(),
+        ///     the lock is only acquired once for the entire range, and
+        ///     existing mappings are not reported as an error, which makes
+        ///     this function suitable for pre-populating a direct map. The
+        ///     range is always mapped using MAP_PAGE_NO_AUTO_RELEASE.
+        ///
+        /// <!-- notes -->
+        ///   @note If an error occurs, the part of the range that was
+        ///     already mapped remains mapped.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
-        ///   @param page_virt the virtual address to map the physical address
-        ///     too.
-        ///   @param page_phys the physical address to map. If the physical
-        ///     address is set to 0, map_page will use the page pool to
-        ///     determine the physical address.
-        ///   @param page_flags defines how memory should be mapped
-        ///   @param auto_release defines what auto release tag to use
+        ///   @param virt the page aligned virtual address to map the
+        ///     physical address too.
+        ///   @param phys the page aligned physical address to map.
+        ///   @param bytes the total number of bytes to map (must be page
+        ///     aligned)
+        ///   @param flags defines how memory should be mapped
+        ///   @param use_2m if true, 2M pages are used wherever both the
+        ///     virtual and physical addresses are 2M aligned and at least
+        ///     2M of the range is left. Otherwise only 4k pages are used.
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        map_page_unaligned(
+        populate_pages(
             tls_t &mut_tls,
             page_pool_t &mut_page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &bytes,
+            bsl::safe_uintmax const &flags,
+            bool const use_2m) noexcept -> bsl::errc_type
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(virt)                   // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(virt)                            // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - Unlike map_page, a physical address of 0 is allowed as
+            ///   a direct map starts at physical address 0.
+            ///
+
+            if (bsl::unlikely(!phys)) {
+                bsl::error() << "physical address is invalid "    // --
+                             << bsl::hex(phys)                    // --
+                             << bsl::endl                         // --
+                             << bsl::here();                      // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(phys))) {
+                bsl::error() << "physical address is not page aligned "    // --
+                             << bsl::hex(phys)                             // --
+                             << bsl::endl                                  // --
+                             << bsl::here();                               // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(bytes.is_zero_or_invalid())) {
+                bsl::error() << "invalid number of bytes "    // --
+                             << bsl::hex(bytes)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(bytes))) {
+                bsl::error() << "number of bytes is not page aligned "    // --
+                             << bsl::hex(bytes)                           // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(flags.is_zero_or_invalid())) {
+                bsl::error() << "invalid flags "    // --
+                             << bsl::hex(flags)     // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely((flags & MAP_PAGE_WRITE).is_pos() &&
+                              (flags & MAP_PAGE_EXECUTE).is_pos())) {
+                bsl::error() << "invalid flags "    // --
+                             << bsl::hex(flags)     // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            bsl::safe_uintmax mut_offs{};
+            while (mut_offs < bytes) {
+                auto const populated{this->populate_leaf(
+                    mut_tls,
+                    mut_page_pool,
+                    virt + mut_offs,
+                    phys + mut_offs,
+                    bytes - mut_offs,
+                    flags,
+                    use_2m)};
+
+                if (bsl::unlikely(!populated)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_offs += populated;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps every 4k page in the provided range that was
+        ///     mapped using MAP_PAGE_NO_AUTO_RELEASE (e.g., by
+        ///     populate_pages()). This allows memory that was mapped as
+        ///     part of a direct map to be remapped using a different auto
+        ///     release tag. Large pages and pages that are not mapped are
+        ///     skipped. It is up to the caller to flush the TLB of the
+        ///     current PP (see unmap_page for details).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the page aligned virtual address to reclaim
+        ///   @param bytes the total number of bytes to reclaim (must be page
+        ///     aligned)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reclaim_pages(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &bytes) noexcept -> bsl::errc_type
+        {
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(virt.is_zero_or_invalid())) {
+                bsl::error() << "virtual address is invalid "    // --
+                             << bsl::hex(virt)                   // --
+                             << bsl::endl                        // --
+                             << bsl::here();                     // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!this->is_page_aligned(virt))) {
+                bsl::error() << "virtual address is not page aligned "    // --
+                             << bsl::hex(virt)                            // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(bytes.is_zero_or_invalid())) {
+                bsl::error() << "invalid number of bytes "    // --
+                             << bsl::hex(bytes)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely_assert(!this->is_page_aligned(bytes))) {
+                bsl::error() << "number of bytes is not page aligned "    // --
+                             << bsl::hex(bytes)                           // --
+                             << bsl::endl                                 // --
+                             << bsl::here();                              // --
+
+                return bsl::errc_failure;
+            }
+
+            bool mut_reclaimed{};
+            for (bsl::safe_uintmax mut_offs{}; mut_offs < bytes; mut_offs += HYPERVISOR_PAGE_SIZE) {
+                if (this->reclaim_leaf(page_pool, virt + mut_offs)) {
+                    mut_reclaimed = true;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (mut_reclaimed) {
+                this->next_generation();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided virtual address is mapped
+        ///     using a 4k page that was mapped with the provided auto
+        ///     release tag. This is used to verify that memory provided by
+        ///     an extension is memory the extension actually owns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the page aligned virtual address to query
+        ///   @param auto_release the auto release tag to look for
+        ///   @return Returns true if page_virt is mapped using a 4k page
+        ///     with the provided auto release tag, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        is_mapped_with(
+            tls_t &mut_tls,
+            page_pool_t const &page_pool,
             bsl::safe_uintmax const &page_virt,
-            bsl::safe_uintmax const &page_phys,
-            bsl::safe_uintmax const &page_flags,
-            bsl::safe_uintmax const &auto_release) noexcept -> bsl::errc_type
+            bsl::safe_uintmax const &auto_release) noexcept -> bool
         {
-            return this->map_page(
-                mut_tls,
-                mut_page_pool,
-                this->page_aligned(page_virt),
-                this->page_aligned(page_phys),
-                page_flags,
-                auto_release);
+            constexpr auto disabled{0_umax};
+            lock_guard_t mut_lock{mut_tls, m_lock};
+
+            if (bsl::unlikely_assert(!m_pml4t_phys)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return false;
+            }
+
+            if (bsl::unlikely(page_virt.is_zero_or_invalid())) {
+                return false;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(page_virt))) {
+                return false;
+            }
+
+            auto const *const pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (disabled == pml4te->p || disabled == pml4te->us) {
+                return false;
+            }
+
+            auto const *const pdpt{get_pdpt(page_pool, pml4te)};
+            auto const *const pdpte{pdpt->entries.at_if(this->pdpto(page_virt))};
+            if (disabled == pdpte->p || disabled != pdpte->ps) {
+                return false;
+            }
+
+            auto const *const pdt{get_pdt(page_pool, pdpte)};
+            auto const *const pdte{pdt->entries.at_if(this->pdto(page_virt))};
+            if (disabled == pdte->p || disabled != pdte->ps) {
+                return false;
+            }
+
+            auto const *const pt{get_pt(page_pool, pdte)};
+            auto const *const pte{pt->entries.at_if(this->pto(page_virt))};
+            if (disabled == pte->p) {
+                return false;
+            }
+
+            return bsl::to_umax(pte->auto_release) == auto_release;
         }
 
         /// <!-- description -->
@@ -0,0 +1,148 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TLB_TAG_T_HPP
+#define TLB_TAG_T_HPP
+
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace mk
+{
+    /// @brief defines the smallest VPID/ASID that can be given to a VPS (0 is the host's)
+    constexpr auto TLB_TAG_MIN{0x1_umax};
+
+    /// @class mk::tlb_tag_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the TLB tag (VPID on Intel, ASID on AMD) that is
+    ///     assigned to a VPS. Tags are handed out per PP from a counter
+    ///     stored in the PP's TLS block, so VPSs that share a PP get
+    ///     different tags and their TLB entries survive switching between
+    ///     them. When a PP runs out of tags, its generation is incremented,
+    ///     all of the tags on that PP are flushed, and every VPS that runs
+    ///     on that PP is given a new tag the next time it runs. A VPS is
+    ///     also given a new tag when it runs on a different PP, which means
+    ///     that a tag is never reused on a PP without a flush first, even
+    ///     if the VPS that had it was destroyed.
+    ///
+    class tlb_tag_t final
+    {
+        /// @brief stores the tag assigned to the VPS
+        bsl::safe_uintmax m_tag{};
+        /// @brief stores the generation of the PP when the tag was assigned
+        bsl::safe_uintmax m_generation{};
+        /// @brief stores the ID of the PP the tag was assigned on
+        bsl::safe_uint16 m_ppid{bsl::safe_uint16::failure()};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the tag assigned to the VPS, or 0 if a tag
+        ///     has not been assigned yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the tag assigned to the VPS, or 0 if a tag
+        ///     has not been assigned yet.
+        ///
+        [[nodiscard]] constexpr auto
+        get() const noexcept -> bsl::safe_uintmax const &
+        {
+            return m_tag;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the VPS needs a new tag before it can
+        ///     run on the current PP, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the VPS needs a new tag before it can
+        ///     run on the current PP, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_stale(tls_t const &tls) const noexcept -> bool
+        {
+            if (tls.ppid != m_ppid) {
+                return true;
+            }
+
+            return bsl::to_umax(tls.tlb_tag_generation) != m_generation;
+        }
+
+        /// <!-- description -->
+        ///   @brief Assigns the next free tag on the current PP to the VPS.
+        ///     If the current PP has run out of tags (or has never handed
+        ///     out a tag), a new generation is started and this function
+        ///     returns true, in which case the caller must flush the TLB
+        ///     entries of all tags on the current PP before running the VPS.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param max the largest tag that the current PP supports
+        ///   @return Returns true if the caller must flush the TLB entries
+        ///     of all tags on the current PP, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        assign(tls_t &mut_tls, bsl::safe_uintmax const &max) noexcept -> bool
+        {
+            bool mut_flush_all{};
+
+            auto mut_next{bsl::to_umax(mut_tls.tlb_tag_next)};
+            if (mut_next.is_zero() || mut_next > max) {
+                auto const generation{bsl::to_umax(mut_tls.tlb_tag_generation) + 1_umax};
+                mut_tls.tlb_tag_generation = generation.get();
+
+                mut_next = TLB_TAG_MIN;
+                mut_flush_all = true;
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_tag = mut_next;
+            m_generation = bsl::to_umax(mut_tls.tlb_tag_generation);
+            m_ppid = bsl::to_u16(mut_tls.ppid);
+
+            mut_tls.tlb_tag_next = (mut_next + 1_umax).get();
+            return mut_flush_all;
+        }
+
+        /// <!-- description -->
+        ///   @brief Forgets the tag assigned to the VPS, which means that a
+        ///     new tag will be assigned the next time the VPS runs.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_tag = {};
+            m_generation = {};
+            m_ppid = bsl::safe_uint16::failure();
+        }
+    };
+}
+
+#endif
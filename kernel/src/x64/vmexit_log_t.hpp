@@ -148,7 +148,10 @@ namespace mk
                     bsl::print() << bsl::rst << ", ";
                     bsl::print() << bsl::blu << "REASON:";
                     bsl::print() << bsl::cyn << bsl::fmt{">2d", rec->exit_reason};
-                    bsl::print() << bsl::rst << "                                ";
+                    bsl::print() << bsl::rst << ", ";
+                    bsl::print() << bsl::blu << "CYCLES:";
+                    bsl::print() << bsl::cyn << bsl::fmt{">10d", rec->cycles};
+                    bsl::print() << bsl::rst << "             ";
                     bsl::print() << bsl::ylw << "                               |";
                     bsl::print() << bsl::rst << bsl::endl;
 
@@ -80,7 +80,7 @@ namespace mk
                 huge_pool_t huge_pool{};
                 tls_t tls{};
                 constexpr auto size{42_umax};
-                bsl::span<bsl::uint8> buf{};
+                bsl::span<page_t> buf{};
                 bsl::ut_when{} = [&]() noexcept {
                     buf = huge_pool.allocate(tls, size);
                     bsl::ut_then{} = [&]() noexcept {
@@ -109,7 +109,7 @@ namespace mk
                 huge_pool_t huge_pool{};
                 tls_t tls{};
                 constexpr auto size{42_umax};
-                bsl::span<bsl::uint8> buf{};
+                bsl::span<page_t> buf{};
                 bsl::ut_when{} = [&]() noexcept {
                     buf = huge_pool.allocate(tls, size);
                     bsl::ut_then{} = [&]() noexcept {
@@ -31,10 +31,18 @@
 #include <x64/pml4t_t.hpp>
 #include <x64/pt_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/ut.hpp>
 
 namespace mk
 {
+    /// @brief defines the first tag used by the tests
+    constexpr auto TAG0{ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE};
+    /// @brief defines the second tag used by the tests
+    constexpr auto TAG1{ALLOCATE_TAG_BF_MEM_OP_ALLOC_HEAP};
+    /// @brief defines the third tag used by the tests
+    constexpr auto TAG2{ALLOCATE_TAG_EXT_STACK};
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -52,7 +60,7 @@ namespace mk
             bsl::ut_given{} = []() noexcept {
                 page_pool_t mut_page_pool{};
                 bsl::ut_then{} = [&]() noexcept {
-                    bsl::ut_check(mut_page_pool.allocate<T>({}, "") == nullptr);
+                    bsl::ut_check(mut_page_pool.allocate<T>({}, ALLOCATE_TAG_MAX) == nullptr);
                 };
             };
         };
@@ -66,66 +74,48 @@ namespace mk
                 T *pmut_mut_virt2{};
                 constexpr auto phys{0xFF000_umax};
                 bsl::ut_when{} = [&]() noexcept {
-                    mut_page_pool.set_allocate("42", &mut_virt, phys);
-                    mut_page_pool.set_allocate<T>("null", {}, phys);
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, "23");
-                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, "null");
+                    mut_page_pool.set_allocate(TAG0, &mut_virt, phys);
+                    mut_page_pool.set_allocate<T>(TAG2, {}, phys);
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, TAG1);
+                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, TAG2);
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(&mut_virt == pmut_mut_virt0);
                         bsl::ut_check(&mut_virt != pmut_mut_virt1);
                         bsl::ut_check(nullptr != pmut_mut_virt1);
                         bsl::ut_check(nullptr == pmut_mut_virt2);
-                        bsl::ut_check(mut_page_pool.allocated({}, "42") == HYPERVISOR_PAGE_SIZE);
-                        bsl::ut_check(mut_page_pool.allocated({}, "23") == HYPERVISOR_PAGE_SIZE);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0) == HYPERVISOR_PAGE_SIZE);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG1) == HYPERVISOR_PAGE_SIZE);
                         bsl::ut_check(mut_page_pool.virt_to_phys(pmut_mut_virt0) == phys);
                         bsl::ut_check(mut_page_pool.phys_to_virt<T>(phys) == pmut_mut_virt0);
                         bsl::ut_cleanup{} = [&]() noexcept {
-                            mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
-                            mut_page_pool.deallocate({}, pmut_mut_virt1, "23");
+                            mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
+                            mut_page_pool.deallocate({}, pmut_mut_virt1, TAG1);
                         };
                     };
                 };
             };
         };
 
-        bsl::ut_scenario{"allocate max tags failure"} = []() noexcept {
+        bsl::ut_scenario{"allocate every tag"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 page_pool_t mut_page_pool{};
-                T *pmut_mut_virt0{};
-                T *pmut_mut_virt1{};
-                T *pmut_mut_virt2{};
-                T *pmut_mut_virt3{};
-                T *pmut_mut_virt4{};
-                T *pmut_mut_virt5{};
-                T *pmut_mut_virt6{};
-                T *pmut_mut_virt7{};
-                T *pmut_mut_virt8{};
-                T *pmut_mut_virt9{};
+                bsl::array<T *, ALLOCATE_TAG_MAX.get()> mut_virts{};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "0");
-                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, "1");
-                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, "2");
-                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, "3");
-                    pmut_mut_virt4 = mut_page_pool.allocate<T>({}, "4");
-                    pmut_mut_virt5 = mut_page_pool.allocate<T>({}, "5");
-                    pmut_mut_virt6 = mut_page_pool.allocate<T>({}, "6");
-                    pmut_mut_virt7 = mut_page_pool.allocate<T>({}, "7");
-                    pmut_mut_virt8 = mut_page_pool.allocate<T>({}, "8");
-                    pmut_mut_virt9 = mut_page_pool.allocate<T>({}, "9");
+                    for (auto const elem : mut_virts) {
+                        *elem.data = mut_page_pool.allocate<T>({}, elem.index);
+                    }
+
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_page_pool.allocate<T>({}, "42") == nullptr);
+                        for (auto const elem : mut_virts) {
+                            bsl::ut_check(nullptr != *elem.data);
+                        }
+
+                        bsl::ut_check(mut_page_pool.allocate<T>({}, ALLOCATE_TAG_MAX) == nullptr);
                         bsl::ut_cleanup{} = [&]() noexcept {
-                            mut_page_pool.deallocate({}, pmut_mut_virt0, "0");
-                            mut_page_pool.deallocate({}, pmut_mut_virt1, "1");
-                            mut_page_pool.deallocate({}, pmut_mut_virt2, "2");
-                            mut_page_pool.deallocate({}, pmut_mut_virt3, "3");
-                            mut_page_pool.deallocate({}, pmut_mut_virt4, "4");
-                            mut_page_pool.deallocate({}, pmut_mut_virt5, "5");
-                            mut_page_pool.deallocate({}, pmut_mut_virt6, "6");
-                            mut_page_pool.deallocate({}, pmut_mut_virt7, "7");
-                            mut_page_pool.deallocate({}, pmut_mut_virt8, "8");
-                            mut_page_pool.deallocate({}, pmut_mut_virt9, "9");
+                            for (auto const elem : mut_virts) {
+                                mut_page_pool.deallocate({}, *elem.data, elem.index);
+                            }
                         };
                     };
                 };
@@ -141,22 +131,22 @@ namespace mk
                 T *pmut_mut_virt3{};
                 constexpr auto expected{HYPERVISOR_PAGE_SIZE * 2_umax};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, "23");
-                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, "23");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, TAG1);
+                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, TAG1);
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(nullptr != pmut_mut_virt0);
                         bsl::ut_check(nullptr != pmut_mut_virt1);
                         bsl::ut_check(nullptr != pmut_mut_virt2);
                         bsl::ut_check(nullptr != pmut_mut_virt3);
-                        bsl::ut_check(mut_page_pool.allocated({}, "42") == expected);
-                        bsl::ut_check(mut_page_pool.allocated({}, "23") == expected);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0) == expected);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG1) == expected);
                         bsl::ut_cleanup{} = [&]() noexcept {
-                            mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
-                            mut_page_pool.deallocate({}, pmut_mut_virt1, "42");
-                            mut_page_pool.deallocate({}, pmut_mut_virt2, "23");
-                            mut_page_pool.deallocate({}, pmut_mut_virt3, "23");
+                            mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
+                            mut_page_pool.deallocate({}, pmut_mut_virt1, TAG0);
+                            mut_page_pool.deallocate({}, pmut_mut_virt2, TAG1);
+                            mut_page_pool.deallocate({}, pmut_mut_virt3, TAG1);
                         };
                     };
                 };
@@ -167,7 +157,7 @@ namespace mk
             bsl::ut_given_at_runtime{} = []() noexcept {
                 page_pool_t mut_page_pool{};
                 bsl::ut_then{} = [&]() noexcept {
-                    mut_page_pool.deallocate<T>({}, nullptr, "42");
+                    mut_page_pool.deallocate<T>({}, nullptr, TAG0);
                 };
             };
         };
@@ -177,7 +167,7 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 T mut_page{};
                 bsl::ut_then{} = [&]() noexcept {
-                    mut_page_pool.deallocate<T>({}, &mut_page, "42");
+                    mut_page_pool.deallocate<T>({}, &mut_page, TAG0);
                 };
             };
         };
@@ -191,25 +181,25 @@ namespace mk
                 T *pmut_mut_virt3{};
                 constexpr auto expected{HYPERVISOR_PAGE_SIZE * 2_umax};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, "23");
-                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, "23");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, TAG1);
+                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, TAG1);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt1);
                     bsl::ut_required_step(nullptr != pmut_mut_virt2);
                     bsl::ut_required_step(nullptr != pmut_mut_virt3);
-                    bsl::ut_required_step(mut_page_pool.allocated({}, "42") == expected);
-                    bsl::ut_required_step(mut_page_pool.allocated({}, "23") == expected);
+                    bsl::ut_required_step(mut_page_pool.allocated({}, TAG0) == expected);
+                    bsl::ut_required_step(mut_page_pool.allocated({}, TAG1) == expected);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
-                        bsl::ut_check(mut_page_pool.allocated({}, "42") == HYPERVISOR_PAGE_SIZE);
-                        mut_page_pool.deallocate({}, pmut_mut_virt1, "42");
-                        bsl::ut_check(mut_page_pool.allocated({}, "42").is_zero());
-                        mut_page_pool.deallocate({}, pmut_mut_virt2, "23");
-                        bsl::ut_check(mut_page_pool.allocated({}, "23") == HYPERVISOR_PAGE_SIZE);
-                        mut_page_pool.deallocate({}, pmut_mut_virt3, "23");
-                        bsl::ut_check(mut_page_pool.allocated({}, "23").is_zero());
+                        mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0) == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.deallocate({}, pmut_mut_virt1, TAG0);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0).is_zero());
+                        mut_page_pool.deallocate({}, pmut_mut_virt2, TAG1);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG1) == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.deallocate({}, pmut_mut_virt3, TAG1);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG1).is_zero());
                     };
                 };
             };
@@ -224,25 +214,25 @@ namespace mk
                 T *pmut_mut_virt3{};
                 constexpr auto expected{HYPERVISOR_PAGE_SIZE * 2_umax};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, "23");
-                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, "23");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt2 = mut_page_pool.allocate<T>({}, TAG1);
+                    pmut_mut_virt3 = mut_page_pool.allocate<T>({}, TAG1);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt1);
                     bsl::ut_required_step(nullptr != pmut_mut_virt2);
                     bsl::ut_required_step(nullptr != pmut_mut_virt3);
-                    bsl::ut_required_step(mut_page_pool.allocated({}, "42") == expected);
-                    bsl::ut_required_step(mut_page_pool.allocated({}, "23") == expected);
+                    bsl::ut_required_step(mut_page_pool.allocated({}, TAG0) == expected);
+                    bsl::ut_required_step(mut_page_pool.allocated({}, TAG1) == expected);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate({}, pmut_mut_virt3, "23");
-                        bsl::ut_check(mut_page_pool.allocated({}, "23") == HYPERVISOR_PAGE_SIZE);
-                        mut_page_pool.deallocate({}, pmut_mut_virt2, "23");
-                        bsl::ut_check(mut_page_pool.allocated({}, "23").is_zero());
-                        mut_page_pool.deallocate({}, pmut_mut_virt1, "42");
-                        bsl::ut_check(mut_page_pool.allocated({}, "42") == HYPERVISOR_PAGE_SIZE);
-                        mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
-                        bsl::ut_check(mut_page_pool.allocated({}, "42").is_zero());
+                        mut_page_pool.deallocate({}, pmut_mut_virt3, TAG1);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG1) == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.deallocate({}, pmut_mut_virt2, TAG1);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG1).is_zero());
+                        mut_page_pool.deallocate({}, pmut_mut_virt1, TAG0);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0) == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0).is_zero());
                     };
                 };
             };
@@ -255,20 +245,20 @@ namespace mk
                 T *pmut_mut_virt1{};
                 constexpr auto expected{HYPERVISOR_PAGE_SIZE * 2_umax};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
-                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, "42");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
+                    pmut_mut_virt1 = mut_page_pool.allocate<T>({}, TAG0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt1);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_page_pool.allocated({}, "42") == expected);
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0) == expected);
                         bsl::ut_cleanup{} = [&]() noexcept {
-                            mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
-                            mut_page_pool.deallocate({}, pmut_mut_virt1, "42");
+                            mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
+                            mut_page_pool.deallocate({}, pmut_mut_virt1, TAG0);
                         };
                     };
                     bsl::ut_then_at_runtime{} = [&]() noexcept {
-                        bsl::ut_check(mut_page_pool.allocated({}, "42").is_zero());
-                        bsl::ut_check(!mut_page_pool.allocated({}, "23"));
+                        bsl::ut_check(mut_page_pool.allocated({}, TAG0).is_zero());
+                        bsl::ut_check(!mut_page_pool.allocated({}, TAG1));
                     };
                 };
             };
@@ -280,7 +270,7 @@ namespace mk
                 T const virt{};
                 T *pmut_mut_virt0{};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     bsl::ut_then{"allocated by mut_page_pool success"} = [&]() noexcept {
                         bsl::ut_check(mut_page_pool.virt_to_phys(pmut_mut_virt0));
@@ -303,7 +293,7 @@ namespace mk
                         bsl::ut_check(mut_page_pool.virt_to_phys(pmut_mut_virt0) == my_good_phys);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
-                        mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
+                        mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
                     };
                 };
             };
@@ -315,7 +305,7 @@ namespace mk
                 T mut_virt{};
                 T *pmut_mut_virt0{};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     bsl::ut_then{"allocated by mut_page_pool success"} = [&]() noexcept {
                         bsl::ut_check(mut_page_pool.virt_to_phys<T const>(pmut_mut_virt0));
@@ -339,7 +329,7 @@ namespace mk
                             mut_page_pool.virt_to_phys<T const>(pmut_mut_virt0) == my_good_phys);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
-                        mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
+                        mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
                     };
                 };
             };
@@ -351,7 +341,7 @@ namespace mk
                 T *pmut_mut_virt0{};
                 bsl::safe_uintmax mut_phys{};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     mut_phys = mut_page_pool.virt_to_phys(pmut_mut_virt0);
                     bsl::ut_required_step(!mut_phys.is_zero_or_invalid());
@@ -380,7 +370,7 @@ namespace mk
                         bsl::ut_check(mut_page_pool.phys_to_virt<T>(mut_phys) == pmut_mut_virt0);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
-                        mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
+                        mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
                     };
                 };
             };
@@ -392,7 +382,7 @@ namespace mk
                 T *pmut_mut_virt0{};
                 bsl::safe_uintmax mut_phys{};
                 bsl::ut_when{} = [&]() noexcept {
-                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, "42");
+                    pmut_mut_virt0 = mut_page_pool.allocate<T>({}, TAG0);
                     bsl::ut_required_step(nullptr != pmut_mut_virt0);
                     mut_phys = mut_page_pool.virt_to_phys(pmut_mut_virt0);
                     bsl::ut_required_step(!mut_phys.is_zero_or_invalid());
@@ -423,7 +413,7 @@ namespace mk
                             mut_page_pool.phys_to_virt<T const>(mut_phys) == pmut_mut_virt0);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
-                        mut_page_pool.deallocate({}, pmut_mut_virt0, "42");
+                        mut_page_pool.deallocate({}, pmut_mut_virt0, TAG0);
                     };
                 };
             };
@@ -58,8 +58,8 @@ main() noexcept -> bsl::exit_code
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(mk::page_pool_t{}));
 
-                static_assert(noexcept(mut_pool.allocate<mk::page_t>({}, "")));
-                static_assert(noexcept(mut_pool.deallocate<mk::page_t>({}, {}, "")));
+                static_assert(noexcept(mut_pool.allocate<mk::page_t>({}, {})));
+                static_assert(noexcept(mut_pool.deallocate<mk::page_t>({}, {}, {})));
                 static_assert(noexcept(mut_pool.virt_to_phys<mk::page_t>(&mut_page)));
                 static_assert(noexcept(mut_pool.phys_to_virt<mk::page_t>({})));
                 static_assert(noexcept(mut_pool.dump()));
@@ -24,12 +24,15 @@
 
 #include "../../../mocks/spinlock_t.hpp"
 
+#include <lock_tags.hpp>
+
 #include <bsl/discard.hpp>
 #include <bsl/ut.hpp>
 
 namespace mk
 {
     constinit spinlock_t const g_verify_constinit{};
+    constinit spinlock_t const g_verify_constinit_named{LOCK_TAG_VM};
 }
 
 /// <!-- description -->
@@ -45,6 +48,7 @@ main() noexcept -> bsl::exit_code
 {
     bsl::ut_scenario{"verify supports constinit"} = []() noexcept {
         bsl::discard(mk::g_verify_constinit);
+        bsl::discard(mk::g_verify_constinit_named);
     };
 
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
@@ -53,6 +57,7 @@ main() noexcept -> bsl::exit_code
             mk::spinlock_t const spinlock{};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(mk::spinlock_t{}));
+                static_assert(noexcept(mk::spinlock_t{mk::LOCK_TAG_VM}));
 
                 static_assert(noexcept(mut_spinlock.lock({})));
                 static_assert(noexcept(mut_spinlock.unlock({})));
@@ -24,10 +24,94 @@
 
 #include "../../../src/debug_ring_write.hpp"
 
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
 #include <bsl/ut.hpp>
 
 namespace mk
 {
+    /// @brief defines the TSC used by the tests
+    constexpr auto TEST_TSC{0x2A_umax};
+    /// @brief stores the debug ring returned by get_current_tls
+    constinit loader::debug_ring_t g_mut_debug_ring{};
+    /// @brief stores the TLS block returned by get_current_tls
+    constinit tls_t g_mut_tls{};
+
+    /// <!-- description -->
+    ///   @brief Implements get_current_tls for debug_ring_write
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a TLS block that points to g_mut_debug_ring
+    ///
+    extern "C" [[nodiscard]] auto
+    get_current_tls() noexcept -> tls_t *
+    {
+        g_mut_tls.debug_ring = &g_mut_debug_ring;
+        return &g_mut_tls;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements timestamp for debug_ring_write
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns TEST_TSC
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return TEST_TSC.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the provided string as a span of characters
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to convert
+    ///   @return Returns the provided string as a span of characters
+    ///
+    [[nodiscard]] constexpr auto
+    to_chars(bsl::string_view const &str) noexcept -> bsl::span<bsl::char_type const>
+    {
+        return {str.data(), str.size()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the contents of the provided debug ring
+    ///     (i.e., everything from spos to epos) equal the provided string.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ring the debug ring to check
+    ///   @param str the string to compare the debug ring against
+    ///   @return Returns true if the contents of the provided debug ring
+    ///     equal the provided string.
+    ///
+    [[nodiscard]] constexpr auto
+    ring_equals(loader::debug_ring_t const &ring, bsl::string_view const &str) noexcept -> bool
+    {
+        bsl::safe_uintmax mut_pos{ring.spos};
+        for (bsl::safe_uintmax mut_i{}; mut_i < str.size(); ++mut_i) {
+            if (bsl::to_umax(ring.epos) == mut_pos) {
+                return false;
+            }
+
+            if (*str.at_if(mut_i) != *ring.buf.at_if(mut_pos)) {
+                return false;
+            }
+
+            ++mut_pos;
+            if (!(ring.buf.size() > mut_pos)) {
+                mut_pos = {};
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        return bsl::to_umax(ring.epos) == mut_pos;
+    }
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -40,6 +124,174 @@ namespace mk
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
+        bsl::ut_scenario{"empty string"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    debug_ring_write_str(mut_ring, to_chars(""), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::to_umax(mut_ring.epos).is_zero());
+                        bsl::ut_check(bsl::to_umax(mut_ring.spos).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"first write starts a record"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    debug_ring_write_str(mut_ring, to_chars("hello"), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ring_equals(mut_ring, "\x1E" "000000000000002a" "hello"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"a record is only started at the start of a line"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    debug_ring_write_str(mut_ring, to_chars("hello"), 0x1_umax);
+                    debug_ring_write_str(mut_ring, to_chars(" world\n"), 0x2_umax);
+                    debug_ring_write_str(mut_ring, to_chars("bye"), 0xFEDCBA9876543210_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ring_equals(
+                            mut_ring,
+                            "\x1E" "0000000000000001" "hello world\n"
+                            "\x1E" "fedcba9876543210" "bye"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"each line of a string starts a record"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    debug_ring_write_str(mut_ring, to_chars("a\n\nb\n"), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ring_equals(
+                            mut_ring,
+                            "\x1E" "000000000000002a" "a\n"
+                            "\x1E" "000000000000002a" "\n"
+                            "\x1E" "000000000000002a" "b\n"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write wraps around the end of the debug ring"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.spos = (HYPERVISOR_DEBUG_RING_SIZE - 10_umax).get();
+                    mut_ring.epos = (HYPERVISOR_DEBUG_RING_SIZE - 4_umax).get();
+                    *mut_ring.buf.at_if(HYPERVISOR_DEBUG_RING_SIZE - 5_umax) = 'x';
+                    debug_ring_write_str(mut_ring, to_chars("0123456789"), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(6_umax == bsl::to_umax(mut_ring.epos));
+                        auto const &buf{mut_ring.buf};
+                        auto const spos{bsl::to_umax(mut_ring.spos)};
+                        bsl::ut_check(HYPERVISOR_DEBUG_RING_SIZE - 10_umax == spos);
+                        bsl::ut_check('0' == *buf.at_if(HYPERVISOR_DEBUG_RING_SIZE - 4_umax));
+                        bsl::ut_check('3' == *buf.at_if(HYPERVISOR_DEBUG_RING_SIZE - 1_umax));
+                        bsl::ut_check('4' == *buf.at_if(0_umax));
+                        bsl::ut_check('9' == *buf.at_if(5_umax));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"record start wraps around the end of the debug ring"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.spos = (HYPERVISOR_DEBUG_RING_SIZE - 8_umax).get();
+                    mut_ring.epos = (HYPERVISOR_DEBUG_RING_SIZE - 8_umax).get();
+                    debug_ring_write_str(mut_ring, to_chars("hi\n"), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(12_umax == bsl::to_umax(mut_ring.epos));
+                        bsl::ut_check(ring_equals(mut_ring, "\x1E" "000000000000002a" "hi\n"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write overwrites the oldest characters"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.spos = {};
+                    mut_ring.epos = (HYPERVISOR_DEBUG_RING_SIZE - 1_umax).get();
+                    *mut_ring.buf.at_if(HYPERVISOR_DEBUG_RING_SIZE - 2_umax) = 'x';
+                    debug_ring_write_str(mut_ring, to_chars("abc"), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(2_umax == bsl::to_umax(mut_ring.epos));
+                        bsl::ut_check(3_umax == bsl::to_umax(mut_ring.spos));
+                        auto const &buf{mut_ring.buf};
+                        bsl::ut_check('a' == *buf.at_if(HYPERVISOR_DEBUG_RING_SIZE - 1_umax));
+                        bsl::ut_check('b' == *buf.at_if(0_umax));
+                        bsl::ut_check('c' == *buf.at_if(1_umax));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"string larger than the debug ring"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::array<bsl::char_type, (HYPERVISOR_DEBUG_RING_SIZE + 10_umax).get()> mut_str{};
+                bsl::ut_when{} = [&]() noexcept {
+                    constexpr auto num_letters{26_umax};
+                    for (bsl::safe_uintmax mut_i{}; mut_i < mut_str.size(); ++mut_i) {
+                        *mut_str.at_if(mut_i) = static_cast<bsl::char_type>(
+                            'a' + bsl::to_i32(mut_i % num_letters).get());
+                    }
+
+                    mut_ring.spos = 42_umax.get();
+                    mut_ring.epos = 42_umax.get();
+                    debug_ring_write_str(mut_ring, {mut_str.data(), mut_str.size()}, TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::string_view const tail{
+                            mut_str.at_if(11_umax), HYPERVISOR_DEBUG_RING_SIZE - 1_umax};
+                        bsl::ut_check(ring_equals(mut_ring, tail));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid positions are reset"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                loader::debug_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.spos = HYPERVISOR_DEBUG_RING_SIZE.get();
+                    mut_ring.epos = (HYPERVISOR_DEBUG_RING_SIZE + 1_umax).get();
+                    debug_ring_write_str(mut_ring, to_chars("hello"), TEST_TSC);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::to_umax(mut_ring.spos).is_zero());
+                        bsl::ut_check(ring_equals(mut_ring, "\x1E" "000000000000002a" "hello"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write to the current PP's debug ring"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_debug_ring = {};
+                    debug_ring_write("hello");
+                    debug_ring_write(' ');
+                    debug_ring_write("world\n");
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ring_equals(
+                            g_mut_debug_ring, "\x1E" "000000000000002a" "hello world\n"));
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -38,5 +38,24 @@
 main() noexcept -> bsl::exit_code
 {
     bsl::enable_color();
+
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            loader::debug_ring_t mut_ring{};
+            bsl::safe_uintmax mut_epos{};
+            bsl::safe_uintmax mut_spos{};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(
+                    noexcept(mk::debug_ring_write_chars(mut_ring, mut_epos, mut_spos, {})));
+                static_assert(noexcept(mk::debug_ring_at_line_start(mut_ring, mut_epos, mut_spos)));
+                static_assert(
+                    noexcept(mk::debug_ring_write_record_start(mut_ring, mut_epos, mut_spos, {})));
+                static_assert(noexcept(mk::debug_ring_write_str(mut_ring, {}, {})));
+                static_assert(noexcept(mk::debug_ring_write('c')));
+                static_assert(noexcept(mk::debug_ring_write("")));
+            };
+        };
+    };
+
     return bsl::ut_success();
 }
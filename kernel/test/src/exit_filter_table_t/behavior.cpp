@@ -0,0 +1,279 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include "../../../src/exit_filter_table_t.hpp"
+
+#include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the exit reason used by the tests for CPUID
+    constexpr auto TEST_CPUID{0x0A_umax};
+    /// @brief defines the exit reason used by the tests for MSRs
+    constexpr auto TEST_MSR{0x7C_umax};
+    /// @brief defines the ECX:EAX that the tests hand to the extension
+    constexpr auto TEST_EXT_LEAF{0x40000000_umax};
+    /// @brief defines the ECX:EAX mask used by the tests
+    constexpr auto TEST_REG_MASK{0x00000000FFFFFFFF_umax};
+    /// @brief defines the exit qualification mask used by the tests
+    constexpr auto TEST_QUAL_MASK{0x1_umax};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"nothing registered"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_table.size().is_zero());
+                    bsl::ut_check(mut_table.handled().is_zero());
+                    bsl::ut_check(!mut_table.match(TEST_CPUID, {}, {}));
+                    bsl::ut_check(!mut_table.hits({}));
+                    bsl::ut_check(nullptr == mut_table.at({}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"first match wins"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 2> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().exit_reason = TEST_CPUID.get();
+                    mut_filters.front().reg_mask = TEST_REG_MASK.get();
+                    mut_filters.front().reg_val = TEST_EXT_LEAF.get();
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_EXT.get();
+                    mut_filters.back().exit_reason = TEST_CPUID.get();
+                    mut_filters.back().action = syscall::BF_EXIT_FILTER_ACTION_CPUID.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_table.size() == mut_filters.size());
+                        bsl::ut_check(mut_table.match(TEST_CPUID, {}, TEST_EXT_LEAF) == 0_umax);
+                        auto const idx{mut_table.match(TEST_CPUID, {}, 1_umax)};
+                        bsl::ut_check(idx == 1_umax);
+                        auto const *const filter{mut_table.at(idx)};
+                        bsl::ut_check(nullptr != filter);
+                        bsl::ut_check(
+                            syscall::BF_EXIT_FILTER_ACTION_CPUID == bsl::to_u64(filter->action));
+                        bsl::ut_check(!mut_table.match(TEST_MSR, {}, 1_umax));
+                        bsl::ut_check(nullptr == mut_table.at(mut_table.size()));
+                        bsl::ut_check(mut_table.hits(0_umax).is_zero());
+                        bsl::ut_check(mut_table.hits(1_umax).is_zero());
+                        bsl::ut_check(mut_table.handled().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"qualification mask"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 1> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().exit_reason = TEST_MSR.get();
+                    mut_filters.front().qual_mask = TEST_QUAL_MASK.get();
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_RDMSR.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_table.match(TEST_MSR, 1_umax, {}));
+                        bsl::ut_check(mut_table.match(TEST_MSR, 2_umax, {}) == 0_umax);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"record_hit"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 2> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().exit_reason = TEST_CPUID.get();
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_EXT.get();
+                    mut_filters.back().exit_reason = TEST_MSR.get();
+                    mut_filters.back().action = syscall::BF_EXIT_FILTER_ACTION_RDMSR.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_table.record_hit(mut_table.match(TEST_CPUID, {}, {}));
+                        mut_table.record_hit(mut_table.match(TEST_MSR, {}, {}));
+                        mut_table.record_hit(mut_table.match(TEST_MSR, {}, {}));
+                        bsl::ut_check(mut_table.hits(0_umax) == 1_umax);
+                        bsl::ut_check(mut_table.hits(1_umax) == 2_umax);
+                        bsl::ut_check(mut_table.handled() == 2_umax);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"record_hit invalid index"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 1> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_ADVANCE_IP.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_table.record_hit(bsl::safe_uintmax::failure());
+                        mut_table.record_hit(mut_table.size());
+                        bsl::ut_check(mut_table.hits({}).is_zero());
+                        bsl::ut_check(mut_table.handled().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"clear"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 1> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_ADVANCE_IP.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_required_step(mut_table.match({}, {}, {}) == 0_umax);
+                    mut_table.record_hit(0_umax);
+                    mut_table.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_table.size().is_zero());
+                        bsl::ut_check(mut_table.handled().is_zero());
+                        bsl::ut_check(!mut_table.match({}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set resets the counters"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 1> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_ADVANCE_IP.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_required_step(mut_table.match({}, {}, {}) == 0_umax);
+                    mut_table.record_hit(0_umax);
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_table.hits({}).is_zero());
+                        bsl::ut_check(mut_table.handled().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid action"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 1> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().action =
+                        (syscall::BF_EXIT_FILTER_ACTION_ADVANCE_IP + 1_u64).get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_table.set(filters));
+                        bsl::ut_check(mut_table.size().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"too many filters"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<
+                    syscall::bf_exit_filter_t,
+                    (syscall::BF_EXIT_FILTER_MAX_ENTRIES + 1_u64).get()>
+                    mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_table.set(filters));
+                    bsl::ut_check(mut_table.size().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                exit_filter_table_t mut_table{};
+                bsl::array<syscall::bf_exit_filter_t, 2> mut_filters{};
+                bsl::span<syscall::bf_exit_filter_t const> const filters{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_filters.front().action = syscall::BF_EXIT_FILTER_ACTION_ADVANCE_IP.get();
+                    bsl::ut_required_step(mut_table.set(filters));
+                    bsl::ut_required_step(mut_table.match({}, {}, {}) == 0_umax);
+                    mut_table.record_hit(0_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_table.dump();
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
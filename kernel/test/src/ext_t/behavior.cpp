@@ -28,6 +28,100 @@
 
 namespace mk
 {
+    /// @brief the ID used by the ext_t in these tests
+    constexpr auto EXTID{1_u16};
+    /// @brief the VMID of the VM whose direct map is used by alloc_page
+    constexpr auto VMID0{0_u16};
+    /// @brief the total number of program headers in the test ELF file
+    constexpr auto TEST_ELF_PHNUM{2_umax};
+    /// @brief the total number of alloc/free cycles to run
+    constexpr auto STEADY_STATE_CYCLES{64_umax};
+    /// @brief the ppid of the PP that runs the extension in VM 0
+    constexpr auto OTHER_PPID{1_u16};
+
+    /// @struct mk::test_elf_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the smallest ELF file that ext_t will accept
+    ///
+    struct test_elf_t final
+    {
+        /// @brief stores the ELF file header
+        bfelf::elf64_ehdr_t ehdr;
+        /// @brief stores the ELF program headers
+        bsl::array<bfelf::elf64_phdr_t, TEST_ELF_PHNUM.get()> phdrs;
+    };
+
+    /// <!-- description -->
+    ///   @brief Fills in a test_elf_t. The PT_LOAD segment is empty so
+    ///     that the mocked root page table does not have to allocate
+    ///     any ELF pages.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_elf the test_elf_t to fill in
+    ///
+    constexpr void
+    init_test_elf(test_elf_t &mut_elf) noexcept
+    {
+        *mut_elf.ehdr.e_ident.at_if(bfelf::EI_MAG0) = bfelf::ELFMAG0.get();
+        *mut_elf.ehdr.e_ident.at_if(bfelf::EI_MAG1) = bfelf::ELFMAG1.get();
+        *mut_elf.ehdr.e_ident.at_if(bfelf::EI_MAG2) = bfelf::ELFMAG2.get();
+        *mut_elf.ehdr.e_ident.at_if(bfelf::EI_MAG3) = bfelf::ELFMAG3.get();
+        *mut_elf.ehdr.e_ident.at_if(bfelf::EI_CLASS) = bfelf::ELFCLASS64.get();
+        *mut_elf.ehdr.e_ident.at_if(bfelf::EI_OSABI) = bfelf::ELFOSABI_SYSV.get();
+
+        mut_elf.ehdr.e_type = bfelf::ET_EXEC.get();
+        mut_elf.ehdr.e_entry = HYPERVISOR_EXT_CODE_ADDR.get();
+        mut_elf.ehdr.e_phdr = mut_elf.phdrs.data();
+        mut_elf.ehdr.e_phnum = bsl::to_u16(TEST_ELF_PHNUM).get();
+
+        mut_elf.phdrs.front().p_type = bfelf::PT_LOAD.get();
+        mut_elf.phdrs.front().p_flags = (bfelf::PF_R | bfelf::PF_X).get();
+        mut_elf.phdrs.front().p_vaddr = HYPERVISOR_EXT_CODE_ADDR.get();
+        mut_elf.phdrs.front().p_align = HYPERVISOR_PAGE_SIZE.get();
+
+        mut_elf.phdrs.back().p_type = bfelf::PT_GNU_STACK.get();
+        mut_elf.phdrs.back().p_flags = (bfelf::PF_R | bfelf::PF_W).get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements call_ext() for execute(). The extension is
+    ///     never actually executed by these tests.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ip ignored
+    ///   @param sp ignored
+    ///   @param arg0 ignored
+    ///   @param arg1 ignored
+    ///   @return Always returns bsl::exit_success
+    ///
+    extern "C" [[nodiscard]] auto
+    call_ext(
+        bsl::uintmax const ip,
+        bsl::uintmax const sp,
+        bsl::uintmax const arg0,
+        bsl::uintmax const arg1) noexcept -> bsl::exit_code
+    {
+        bsl::discard(ip);
+        bsl::discard(sp);
+        bsl::discard(arg0);
+        bsl::discard(arg1);
+
+        return bsl::exit_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements timestamp() for the trace ring.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns 0
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return {};
+    }
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -40,6 +134,517 @@ namespace mk
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
+        bsl::ut_scenario{"free_page without initialize fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_ext.free_page(
+                        mut_tls, mut_page_pool, mut_intrinsic, HYPERVISOR_EXT_PAGE_POOL_ADDR));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page invalid virt"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                constexpr auto unaligned{HYPERVISOR_EXT_PAGE_POOL_ADDR + 1_umax};
+                constexpr auto too_low{HYPERVISOR_EXT_PAGE_POOL_ADDR - HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, bsl::safe_uintmax::failure()));
+                        bsl::ut_check(
+                            !mut_ext.free_page(mut_tls, mut_page_pool, mut_intrinsic, {}));
+                        bsl::ut_check(
+                            !mut_ext.free_page(mut_tls, mut_page_pool, mut_intrinsic, too_low));
+                        bsl::ut_check(
+                            !mut_ext.free_page(mut_tls, mut_page_pool, mut_intrinsic, unaligned));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page of memory that was not allocated fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, HYPERVISOR_EXT_PAGE_POOL_ADDR));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page twice fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    mut_page = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_page.virt.is_pos());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                        bsl::ut_check(!mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page unmap fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    mut_page = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_page.virt.is_pos());
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                        bsl::ut_check(
+                            mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE) ==
+                            HYPERVISOR_PAGE_SIZE);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_tls.test_ret = bsl::errc_success;
+                            bsl::discard(mut_ext.free_page(
+                                mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    mut_page = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_page.virt.is_pos());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                        bsl::ut_check(
+                            mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE)
+                                .is_zero());
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page success with PCIDs enabled"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    mut_tls.pcid_enabled = (1_umax).get();
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    mut_page = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_page.virt.is_pos());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                        bsl::ut_check(
+                            mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE)
+                                .is_zero());
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lookup_page without initialize fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        nullptr ==
+                        mut_ext.lookup_page(mut_tls, mut_page_pool, HYPERVISOR_EXT_PAGE_POOL_ADDR));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lookup_page invalid virt"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                constexpr auto unaligned{HYPERVISOR_EXT_PAGE_POOL_ADDR + 1_umax};
+                constexpr auto too_low{HYPERVISOR_EXT_PAGE_POOL_ADDR - HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            nullptr ==
+                            mut_ext.lookup_page(
+                                mut_tls, mut_page_pool, bsl::safe_uintmax::failure()));
+                        bsl::ut_check(nullptr == mut_ext.lookup_page(mut_tls, mut_page_pool, {}));
+                        bsl::ut_check(
+                            nullptr == mut_ext.lookup_page(mut_tls, mut_page_pool, too_low));
+                        bsl::ut_check(
+                            nullptr == mut_ext.lookup_page(mut_tls, mut_page_pool, unaligned));
+                        bsl::ut_check(
+                            nullptr ==
+                            mut_ext.lookup_page(
+                                mut_tls, mut_page_pool, HYPERVISOR_EXT_PAGE_POOL_ADDR));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lookup_page only finds pages from alloc_page"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    mut_page = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_page.virt.is_pos());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_page_pool.phys_to_virt<page_t>(mut_page.phys) ==
+                            mut_ext.lookup_page(mut_tls, mut_page_pool, mut_page.virt));
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_page.virt));
+                        bsl::ut_check(
+                            nullptr == mut_ext.lookup_page(mut_tls, mut_page_pool, mut_page.virt));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"alloc_page/free_page steady state"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_first{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    mut_first = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_first.virt.is_pos());
+                    bsl::ut_required_step(mut_ext.free_page(
+                        mut_tls, mut_page_pool, mut_intrinsic, mut_first.virt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_uintmax mut_i{}; mut_i < STEADY_STATE_CYCLES; ++mut_i) {
+                            auto const page{mut_ext.alloc_page(mut_tls, mut_page_pool)};
+                            bsl::ut_check(page.virt == mut_first.virt);
+                            bsl::ut_check(page.phys == mut_first.phys);
+                            bsl::ut_check(
+                                mut_page_pool.allocated(
+                                    mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE) ==
+                                HYPERVISOR_PAGE_SIZE);
+
+                            bsl::ut_check(mut_ext.free_page(
+                                mut_tls, mut_page_pool, mut_intrinsic, page.virt));
+                            bsl::ut_check(
+                                mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE)
+                                    .is_zero());
+                        }
+
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"freed pages are not reused until the other PPs flush"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                tls_t mut_other_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                alloc_page_t mut_first{};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    mut_other_tls.ppid = OTHER_PPID.get();
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_required_step(mut_ext.start(mut_other_tls, mut_intrinsic));
+                    mut_first = mut_ext.alloc_page(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(mut_first.virt.is_pos());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, mut_first.virt));
+                        bsl::ut_check(
+                            nullptr == mut_ext.lookup_page(mut_tls, mut_page_pool, mut_first.virt));
+                        bsl::ut_check(
+                            mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE) ==
+                            HYPERVISOR_PAGE_SIZE);
+
+                        auto const second{mut_ext.alloc_page(mut_tls, mut_page_pool)};
+                        bsl::ut_check(second.phys != mut_first.phys);
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, second.virt));
+
+                        bsl::ut_check(mut_ext.start(mut_other_tls, mut_intrinsic));
+
+                        auto const third{mut_ext.alloc_page(mut_tls, mut_page_pool)};
+                        bsl::ut_check(third.virt.is_pos());
+                        bsl::ut_check(
+                            mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE) ==
+                            HYPERVISOR_PAGE_SIZE);
+
+                        bsl::ut_check(mut_ext.free_page(
+                            mut_tls, mut_page_pool, mut_intrinsic, third.virt));
+
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_direct without initialize fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        !mut_ext.map_direct(mut_tls, mut_page_pool, {}, HYPERVISOR_PAGE_SIZE));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_direct invalid range"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                constexpr auto page{HYPERVISOR_PAGE_SIZE};
+                constexpr auto last{HYPERVISOR_EXT_DIRECT_MAP_SIZE - HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.map_direct(
+                            mut_tls, mut_page_pool, bsl::safe_uintmax::failure(), page));
+                        bsl::ut_check(!mut_ext.map_direct(mut_tls, mut_page_pool, {}, {}));
+                        bsl::ut_check(!mut_ext.map_direct(
+                            mut_tls, mut_page_pool, {}, bsl::safe_uintmax::failure()));
+                        bsl::ut_check(
+                            !mut_ext.map_direct(mut_tls, mut_page_pool, last, page + page));
+                        bsl::ut_check(mut_ext.map_direct(mut_tls, mut_page_pool, last, page));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_direct success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                constexpr auto byts{HYPERVISOR_PAGE_SIZE + HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.map_direct(mut_tls, mut_page_pool, {}, byts));
+                        bsl::ut_check(mut_ext.map_direct(mut_tls, mut_page_pool, {}, byts));
+                        bsl::ut_check(mut_ext.map_page_direct(
+                            mut_tls,
+                            mut_page_pool,
+                            HYPERVISOR_EXT_DIRECT_MAP_ADDR + HYPERVISOR_PAGE_SIZE));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_page_direct outside of the direct map fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto dm_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+                constexpr auto dm_size{HYPERVISOR_EXT_DIRECT_MAP_SIZE};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_ext.map_page_direct(
+                        mut_tls, mut_page_pool, dm_addr - HYPERVISOR_PAGE_SIZE));
+                    bsl::ut_check(!mut_ext.map_page_direct(
+                        mut_tls, mut_page_pool, dm_addr + dm_size));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_page_direct fault around"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                root_page_table_t mut_system_rpt{};
+                test_elf_t mut_elf{};
+                constexpr auto dm_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+                constexpr auto dm_size{HYPERVISOR_EXT_DIRECT_MAP_SIZE};
+                constexpr auto fault{dm_addr + HYPERVISOR_EXT_FAULT_AROUND_SIZE + 1_umax};
+                constexpr auto last{dm_addr + dm_size - 1_umax};
+                bsl::ut_when{} = [&]() noexcept {
+                    init_test_elf(mut_elf);
+                    bsl::ut_required_step(mut_system_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_ext.initialize(
+                        mut_tls, mut_page_pool, EXTID, &mut_elf.ehdr, mut_system_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.signal_vm_created(mut_tls, mut_page_pool, VMID0));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.map_page_direct(mut_tls, mut_page_pool, fault));
+                        bsl::ut_check(mut_ext.map_page_direct(mut_tls, mut_page_pool, fault));
+                        bsl::ut_check(mut_ext.map_page_direct(mut_tls, mut_page_pool, last));
+                        bsl::ut_check(mut_ext.alloc_page(mut_tls, mut_page_pool).virt.is_pos());
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
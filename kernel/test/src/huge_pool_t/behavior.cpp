@@ -24,17 +24,46 @@
 
 #include "../../../src/huge_pool_t.hpp"
 
+#include <page_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/span.hpp>
 #include <bsl/ut.hpp>
 
 namespace mk
 {
-    /// @brief used by most of the tests
-    constexpr auto POOL_SIZE{0x3000_umax};
-    /// @brief only used by the dump test as this is too large for the stack
-    constexpr auto LARGE_POOL_SIZE{0x1000000_umax};
+    /// @brief used by most of the tests (must match HYPERVISOR_MK_HUGE_POOL_SIZE)
+    constexpr auto POOL_SIZE{HUGE_POOL_MAX_PAGES};
+    /// @brief used to test pools that are not a power of two in size
+    constexpr auto ODD_POOL_SIZE{12_umax};
+    /// @brief used to test running out of memory
+    constexpr auto SMALL_POOL_SIZE{3_umax};
+    /// @brief used to test a pool with a single page
+    constexpr auto SINGLE_POOL_SIZE{1_umax};
+    /// @brief used to test pools that are larger than the huge pool supports
+    constexpr auto LARGE_POOL_SIZE{HUGE_POOL_MAX_PAGES * 2_umax};
 
-    /// @brief used for dump to prevent the unit test from running out of stack
-    bsl::array<bsl::uint8, LARGE_POOL_SIZE.get()> g_pool{};
+    /// @brief used to test pools that are larger than the huge pool supports
+    bsl::array<page_t, LARGE_POOL_SIZE.get()> g_mut_large_pool{};
+    /// @brief used to test deallocating memory that is not from the pool
+    bsl::array<page_t, SINGLE_POOL_SIZE.get()> g_mut_other_pool{};
+
+    /// <!-- description -->
+    ///   @brief Implements clear_pages for the huge pool
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_virt the virtual address of the first page to zero
+    ///   @param pages the total number of pages to zero
+    ///
+    extern "C" void
+    clear_pages(void *const pmut_virt, bsl::uint64 const pages) noexcept
+    {
+        auto *const pmut_bytes{static_cast<bsl::uint8 *>(pmut_virt)};
+        bsl::builtin_memset(pmut_bytes, '\0', bsl::to_umax(pages) * HYPERVISOR_PAGE_SIZE);
+    }
 
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
@@ -48,109 +77,321 @@ namespace mk
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"allocate invalid size"} = []() noexcept {
+        bsl::ut_scenario{"allocate invalid pages"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                bsl::array<bsl::uint8, POOL_SIZE.get()> pool{};
-                bsl::span view{pool};
-                tls_t tls{};
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
                 bsl::ut_when{} = [&]() noexcept {
-                    huge_pool.initialize(view);
+                    mut_huge_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!huge_pool.allocate(tls, bsl::safe_uintmax::failure()));
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, {}).empty());
+                        bsl::ut_check(
+                            mut_huge_pool.allocate(mut_tls, bsl::safe_uintmax::failure()).empty());
+                        bsl::ut_check(mut_huge_pool.used().is_zero());
                     };
                 };
             };
         };
 
-        bsl::ut_scenario{"allocate 4k pages"} = []() noexcept {
+        bsl::ut_scenario{"allocate before initialize fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                bsl::array<bsl::uint8, POOL_SIZE.get()> pool{};
-                bsl::span view{pool};
-                tls_t tls{};
+                huge_pool_t mut_huge_pool{};
+                tls_t mut_tls{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_huge_pool.allocate(mut_tls, 1_umax).empty());
+                    bsl::ut_check(mut_huge_pool.size().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate single pages until empty"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, SMALL_POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
                 bsl::ut_when{} = [&]() noexcept {
-                    huge_pool.initialize(view);
+                    mut_huge_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(huge_pool.allocate(tls, 0x1000_umax).size() == 0x1000_umax);
-                        bsl::ut_check(huge_pool.allocate(tls, 0x1000_umax).size() == 0x1000_umax);
-                        bsl::ut_check(huge_pool.allocate(tls, 0x1000_umax).size() == 0x1000_umax);
-                        bsl::ut_check(!huge_pool.allocate(tls, 0x1000_umax));
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 1_umax).size() == 1_umax);
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 1_umax).size() == 1_umax);
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 1_umax).size() == 1_umax);
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 1_umax).empty());
+                        bsl::ut_check(mut_huge_pool.used() == 3_umax);
+                        bsl::ut_check(mut_huge_pool.largest_free().is_zero());
+                        bsl::ut_check(mut_huge_pool.failures() == 1_umax);
                     };
                 };
             };
         };
 
-        bsl::ut_scenario{"allocate 8k pages"} = []() noexcept {
+        bsl::ut_scenario{"allocate more than the pool fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                bsl::array<bsl::uint8, POOL_SIZE.get()> pool{};
-                bsl::span view{pool};
-                tls_t tls{};
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
                 bsl::ut_when{} = [&]() noexcept {
-                    huge_pool.initialize(view);
+                    mut_huge_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(huge_pool.allocate(tls, 0x2000_umax).size() == 0x2000_umax);
-                        bsl::ut_check(!huge_pool.allocate(tls, 0x2000_umax));
+                        auto const too_big{POOL_SIZE + 1_umax};
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, too_big).empty());
+                        bsl::ut_check(
+                            mut_huge_pool.allocate(mut_tls, POOL_SIZE).size() == POOL_SIZE);
+                        bsl::ut_check(mut_huge_pool.failures() == 1_umax);
                     };
                 };
             };
         };
 
-        bsl::ut_scenario{"allocate non page sizes"} = []() noexcept {
+        bsl::ut_scenario{"allocate rounds up to a power of two"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                bsl::array<bsl::uint8, POOL_SIZE.get()> pool{};
-                bsl::span view{pool};
-                tls_t tls{};
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
                 bsl::ut_when{} = [&]() noexcept {
-                    huge_pool.initialize(view);
+                    mut_huge_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(huge_pool.allocate(tls, 0xFFF_umax).size() == 0x1000_umax);
-                        bsl::ut_check(huge_pool.allocate(tls, 0x001_umax).size() == 0x1000_umax);
-                        bsl::ut_check(huge_pool.allocate(tls, 0x800_umax).size() == 0x1000_umax);
-                        bsl::ut_check(!huge_pool.allocate(tls, 0x001_umax));
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 3_umax).size() == 3_umax);
+                        bsl::ut_check(mut_huge_pool.used() == 4_umax);
+                        bsl::ut_check(mut_huge_pool.largest_free() == POOL_SIZE / 2_umax);
                     };
                 };
             };
         };
 
-        bsl::ut_scenario{"quiet deallocate"} = []() noexcept {
+        bsl::ut_scenario{"allocate returns naturally aligned blocks"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                tls_t tls{};
-                huge_pool.deallocate(tls, {});
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const buf1{mut_huge_pool.allocate(mut_tls, 1_umax)};
+                        auto const buf2{mut_huge_pool.allocate(mut_tls, 2_umax)};
+                        auto const buf3{mut_huge_pool.allocate(mut_tls, 1_umax)};
+                        auto const buf4{mut_huge_pool.allocate(mut_tls, 4_umax)};
+                        bsl::ut_check(buf1.data() == mut_pool.at_if(0_umax));
+                        bsl::ut_check(buf2.data() == mut_pool.at_if(2_umax));
+                        bsl::ut_check(buf3.data() == mut_pool.at_if(1_umax));
+                        bsl::ut_check(buf4.data() == mut_pool.at_if(4_umax));
+                    };
+                };
             };
         };
 
-        bsl::ut_scenario{"dump"} = []() noexcept {
+        bsl::ut_scenario{"pools that are not a power of two"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, ODD_POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.size() == ODD_POOL_SIZE);
+                        bsl::ut_check(mut_huge_pool.largest_free() == 8_umax);
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 8_umax).size() == 8_umax);
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 4_umax).size() == 4_umax);
+                        bsl::ut_check(mut_huge_pool.allocate(mut_tls, 1_umax).empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate merges buddies"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const buf1{mut_huge_pool.allocate(mut_tls, 1_umax)};
+                    auto const buf2{mut_huge_pool.allocate(mut_tls, 1_umax)};
+                    auto const buf3{mut_huge_pool.allocate(mut_tls, 2_umax)};
+                    auto const buf4{mut_huge_pool.allocate(mut_tls, 4_umax)};
+                    auto const buf5{mut_huge_pool.allocate(mut_tls, 8_umax)};
+                    bsl::ut_required_step(!buf5.empty());
+                    bsl::ut_required_step(mut_huge_pool.largest_free().is_zero());
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_huge_pool.deallocate(mut_tls, buf3);
+                        bsl::ut_check(mut_huge_pool.largest_free() == 2_umax);
+                        mut_huge_pool.deallocate(mut_tls, buf5);
+                        bsl::ut_check(mut_huge_pool.largest_free() == 8_umax);
+                        mut_huge_pool.deallocate(mut_tls, buf1);
+                        mut_huge_pool.deallocate(mut_tls, buf4);
+                        bsl::ut_check(mut_huge_pool.largest_free() == 8_umax);
+                        mut_huge_pool.deallocate(mut_tls, buf2);
+                        bsl::ut_check(mut_huge_pool.largest_free() == POOL_SIZE);
+                        bsl::ut_check(mut_huge_pool.used().is_zero());
+                        bsl::ut_check(
+                            mut_huge_pool.allocate(mut_tls, POOL_SIZE).size() == POOL_SIZE);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate zeros memory"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                constexpr auto val{0x42_u8};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto mut_buf1{mut_huge_pool.allocate(mut_tls, 2_umax)};
+                    bsl::ut_required_step(!mut_buf1.empty());
+                    *mut_buf1.front_if()->data.front_if() = val.get();
+                    *mut_buf1.back_if()->data.back_if() = val.get();
+                    mut_huge_pool.deallocate(mut_tls, mut_buf1);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const buf2{mut_huge_pool.allocate(mut_tls, 2_umax)};
+                        bsl::ut_check(mut_buf1.data() == buf2.data());
+                        bsl::ut_check(bsl::uint8{} == *buf2.front_if()->data.front_if());
+                        bsl::ut_check(bsl::uint8{} == *buf2.back_if()->data.back_if());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate invalid memory"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                bsl::array<bsl::uint8, POOL_SIZE.get()> pool{};
-                bsl::span view{pool};
-                tls_t tls{};
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
                 bsl::ut_when{} = [&]() noexcept {
-                    huge_pool.initialize(view);
-                    bsl::ut_required_step(!!huge_pool.allocate(tls, 0x1000_umax));
-                    bsl::ut_required_step(!!huge_pool.allocate(tls, 0x1000_umax));
-                    bsl::ut_required_step(!!huge_pool.allocate(tls, 0x1000_umax));
+                    mut_huge_pool.initialize(mut_view);
+                    auto const buf{mut_huge_pool.allocate(mut_tls, 2_umax)};
+                    bsl::ut_required_step(!buf.empty());
                     bsl::ut_then{} = [&]() noexcept {
-                        huge_pool.dump();
+                        mut_huge_pool.deallocate(mut_tls, {});
+                        mut_huge_pool.deallocate(mut_tls, buf.subspan(1_umax, 1_umax));
+                        mut_huge_pool.deallocate(mut_tls, mut_view.subspan(4_umax, 1_umax));
+                        bsl::ut_check(mut_huge_pool.used() == 2_umax);
+                        mut_huge_pool.deallocate(mut_tls, buf);
+                        mut_huge_pool.deallocate(mut_tls, buf);
+                        bsl::ut_check(mut_huge_pool.used().is_zero());
+                        bsl::ut_check(mut_huge_pool.largest_free() == POOL_SIZE);
                     };
                 };
             };
 
             bsl::ut_given_at_runtime{} = []() noexcept {
-                huge_pool_t huge_pool{};
-                bsl::span view{g_pool};
-                tls_t tls{};
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                bsl::span mut_other{g_mut_other_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_required_step(!mut_huge_pool.allocate(mut_tls, 1_umax).empty());
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_huge_pool.deallocate(mut_tls, mut_other);
+                        bsl::ut_check(mut_huge_pool.used() == 1_umax);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lookup"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const buf{mut_huge_pool.allocate(mut_tls, 3_umax)};
+                    bsl::ut_required_step(!buf.empty());
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const found{mut_huge_pool.lookup(mut_tls, buf.data())};
+                        bsl::ut_check(found.data() == buf.data());
+                        bsl::ut_check(found.size() == buf.size());
+                        bsl::ut_check(mut_huge_pool.lookup(mut_tls, nullptr).empty());
+                        bsl::ut_check(
+                            mut_huge_pool.lookup(mut_tls, mut_pool.at_if(1_umax)).empty());
+                        bsl::ut_check(
+                            mut_huge_pool.lookup(mut_tls, mut_pool.at_if(4_umax)).empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"steady state allocate/deallocate"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                constexpr auto iterations{64_umax};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_uintmax mut_i{}; mut_i < iterations; ++mut_i) {
+                            auto const buf1{mut_huge_pool.allocate(mut_tls, 5_umax)};
+                            auto const buf2{mut_huge_pool.allocate(mut_tls, 1_umax)};
+                            bsl::ut_check(!buf1.empty());
+                            bsl::ut_check(!buf2.empty());
+                            mut_huge_pool.deallocate(mut_tls, buf1);
+                            mut_huge_pool.deallocate(mut_tls, buf2);
+                        }
+
+                        bsl::ut_check(mut_huge_pool.used().is_zero());
+                        bsl::ut_check(mut_huge_pool.largest_free() == POOL_SIZE);
+                        bsl::ut_check(mut_huge_pool.failures().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"initialize truncates large pools"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::span mut_view{g_mut_large_pool};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.size() == HUGE_POOL_MAX_PAGES);
+                        bsl::ut_check(mut_huge_pool.largest_free() == HUGE_POOL_MAX_PAGES);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, ODD_POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_required_step(!mut_huge_pool.allocate(mut_tls, 3_umax).empty());
+                    bsl::ut_required_step(!mut_huge_pool.allocate(mut_tls, 1_umax).empty());
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_huge_pool.dump();
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_t, SINGLE_POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
                 bsl::ut_when{} = [&]() noexcept {
-                    huge_pool.initialize(view);
-                    for (bsl::safe_uintmax i{}; i < 1024_umax; ++i) {
-                        bsl::ut_required_step(!!huge_pool.allocate(tls, 0x1000_umax));
-                    }
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_required_step(!mut_huge_pool.allocate(mut_tls, 1_umax).empty());
                     bsl::ut_then{} = [&]() noexcept {
-                        huge_pool.dump();
+                        mut_huge_pool.dump();
                     };
                 };
             };
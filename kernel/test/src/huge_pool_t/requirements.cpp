@@ -24,6 +24,8 @@
 
 #include "../../../src/huge_pool_t.hpp"
 
+#include <page_t.hpp>
+
 #include <bsl/convert.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/ut.hpp>
@@ -52,15 +54,25 @@ main() noexcept -> bsl::exit_code
         bsl::ut_given{} = []() noexcept {
             mk::huge_pool_t mut_pool{};
             mk::huge_pool_t const pool{};
-            bsl::span<bsl::uint8> view{};
+            bsl::span<mk::page_t> mut_view{};
+            mk::tls_t mut_tls{};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(mk::huge_pool_t{}));
 
-                static_assert(noexcept(mut_pool.initialize(view)));
-                static_assert(noexcept(mut_pool.allocate({}, {})));
-                static_assert(noexcept(mut_pool.deallocate({}, {})));
+                static_assert(noexcept(mut_pool.initialize(mut_view)));
+                static_assert(noexcept(mut_pool.allocate(mut_tls, {})));
+                static_assert(noexcept(mut_pool.lookup(mut_tls, {})));
+                static_assert(noexcept(mut_pool.deallocate(mut_tls, {})));
+                static_assert(noexcept(mut_pool.size()));
+                static_assert(noexcept(mut_pool.used()));
+                static_assert(noexcept(mut_pool.largest_free()));
+                static_assert(noexcept(mut_pool.failures()));
                 static_assert(noexcept(mut_pool.dump()));
 
+                static_assert(noexcept(pool.size()));
+                static_assert(noexcept(pool.used()));
+                static_assert(noexcept(pool.largest_free()));
+                static_assert(noexcept(pool.failures()));
                 static_assert(noexcept(pool.dump()));
             };
         };
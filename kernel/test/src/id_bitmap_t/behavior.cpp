@@ -0,0 +1,224 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include "../../../src/id_bitmap_t.hpp"
+
+#include <thread>
+
+#include <bsl/array.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of IDs used by the tests
+    constexpr auto TEST_IDS{70_umax};
+    /// @brief defines the number of threads used by the thread tests
+    constexpr auto MAX_THREADS{64_umax};
+    /// @brief defines the number of IDs each thread allocates
+    constexpr auto IDS_PER_THREAD{16_umax};
+
+    /// @brief defines the bitmap shared by the thread tests
+    constinit id_bitmap_t<(MAX_THREADS * IDS_PER_THREAD).get()> g_mut_bitmap{};
+    /// @brief stores the IDs allocated by each thread
+    constinit bsl::array<bsl::array<bsl::safe_uintmax, IDS_PER_THREAD.get()>, MAX_THREADS.get()>
+        g_mut_ids{};
+
+    /// <!-- description -->
+    ///   @brief Allocates IDS_PER_THREAD IDs from g_mut_bitmap
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param thread the index of the thread
+    ///
+    void
+    thread_func(bsl::safe_uintmax const &thread) noexcept
+    {
+        auto *const pmut_ids{g_mut_ids.at_if(thread)};
+        for (auto const elem : *pmut_ids) {
+            *elem.data = g_mut_bitmap.allocate();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"allocate in order"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                id_bitmap_t<TEST_IDS.get()> mut_bitmap{};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_uintmax mut_i{}; mut_i < TEST_IDS; ++mut_i) {
+                        bsl::ut_check(mut_bitmap.allocate() == mut_i);
+                        bsl::ut_check(mut_bitmap.is_set(mut_i));
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate when full"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                id_bitmap_t<TEST_IDS.get()> mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_uintmax mut_i{}; mut_i < TEST_IDS; ++mut_i) {
+                        bsl::discard(mut_bitmap.allocate());
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_bitmap.allocate());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate reuses freed ids"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                id_bitmap_t<TEST_IDS.get()> mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_uintmax mut_i{}; mut_i < TEST_IDS; ++mut_i) {
+                        bsl::discard(mut_bitmap.allocate());
+                    }
+                    mut_bitmap.clear(66_umax);
+                    mut_bitmap.clear(3_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_bitmap.is_set(3_umax));
+                        bsl::ut_check(!mut_bitmap.is_set(66_umax));
+                        bsl::ut_check(mut_bitmap.allocate() == 3_umax);
+                        bsl::ut_check(mut_bitmap.allocate() == 66_umax);
+                        bsl::ut_check(!mut_bitmap.allocate());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set skips the id when allocating"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                id_bitmap_t<TEST_IDS.get()> mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_bitmap.set({});
+                    mut_bitmap.set(1_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_bitmap.is_set({}));
+                        bsl::ut_check(mut_bitmap.is_set(1_umax));
+                        bsl::ut_check(!mut_bitmap.is_set(2_umax));
+                        bsl::ut_check(mut_bitmap.allocate() == 2_umax);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"first_set"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                id_bitmap_t<TEST_IDS.get()> mut_bitmap{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_bitmap.first_set());
+                };
+
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_bitmap.set(68_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_bitmap.first_set() == 68_umax);
+                    };
+
+                    mut_bitmap.set(5_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_bitmap.first_set() == 5_umax);
+                    };
+
+                    mut_bitmap.clear(5_umax);
+                    mut_bitmap.clear(68_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_bitmap.first_set());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"out of range ids"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                id_bitmap_t<TEST_IDS.get()> mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_bitmap.set(TEST_IDS);
+                    mut_bitmap.clear(TEST_IDS);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_bitmap.is_set(TEST_IDS));
+                        bsl::ut_check(!mut_bitmap.first_set());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"concurrent allocations are unique"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<std::thread, MAX_THREADS.get()> mut_threads{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_uintmax mut_i{}; mut_i < MAX_THREADS; ++mut_i) {
+                        *mut_threads.at_if(mut_i) = std::thread{&thread_func, mut_i};
+                    }
+                    for (bsl::safe_uintmax mut_i{}; mut_i < MAX_THREADS; ++mut_i) {
+                        mut_threads.at_if(mut_i)->join();
+                    }
+                    bsl::ut_then{} = []() noexcept {
+                        id_bitmap_t<(MAX_THREADS * IDS_PER_THREAD).get()> mut_seen{};
+                        for (auto const thread : g_mut_ids) {
+                            for (auto const id : *thread.data) {
+                                bsl::ut_check(*id.data);
+                                bsl::ut_check(!mut_seen.is_set(*id.data));
+                                mut_seen.set(*id.data);
+                            }
+                        }
+
+                        bsl::ut_check(!g_mut_bitmap.allocate());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
@@ -0,0 +1,164 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include "../../../src/lock_stats_t.hpp"
+
+#include <bsl/convert.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"nothing recorded"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                lock_stats_t mut_stats{};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_uintmax mut_i{}; mut_i < LOCK_TAG_MAX; ++mut_i) {
+                        auto const totals{mut_stats.totals(mut_i)};
+                        bsl::ut_check(totals.acquisitions.is_zero());
+                        bsl::ut_check(totals.contended.is_zero());
+                        bsl::ut_check(totals.spin_total.is_zero());
+                        bsl::ut_check(totals.spin_max.is_zero());
+                        bsl::ut_check(totals.hold_total.is_zero());
+                        bsl::ut_check(totals.hold_max.is_zero());
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"records are combined across pps"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                lock_stats_t mut_stats{};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls0.ppid = bsl::to_u16(0).get();
+                    mut_tls1.ppid = bsl::to_u16(1).get();
+
+                    mut_stats.acquired(mut_tls0, LOCK_TAG_VM, 5_umax, true);
+                    mut_stats.released(mut_tls0, LOCK_TAG_VM, 10_umax);
+                    mut_stats.acquired(mut_tls1, LOCK_TAG_VM, 3_umax, false);
+                    mut_stats.released(mut_tls1, LOCK_TAG_VM, 20_umax);
+                    mut_stats.acquired(mut_tls1, LOCK_TAG_VM, 1_umax, true);
+                    mut_stats.released(mut_tls1, LOCK_TAG_VM, 1_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const totals{mut_stats.totals(LOCK_TAG_VM)};
+                        bsl::ut_check(totals.acquisitions == 3_umax);
+                        bsl::ut_check(totals.contended == 2_umax);
+                        bsl::ut_check(totals.spin_total == 9_umax);
+                        bsl::ut_check(totals.spin_max == 5_umax);
+                        bsl::ut_check(totals.hold_total == 31_umax);
+                        bsl::ut_check(totals.hold_max == 20_umax);
+                    };
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const totals{mut_stats.totals(LOCK_TAG_HUGE_POOL)};
+                        bsl::ut_check(totals.acquisitions.is_zero());
+                        bsl::ut_check(totals.hold_total.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid ppid"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                lock_stats_t mut_stats{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ppid = bsl::to_u16(HYPERVISOR_MAX_PPS).get();
+                    mut_stats.acquired(mut_tls, LOCK_TAG_VM, 5_umax, true);
+                    mut_stats.released(mut_tls, LOCK_TAG_VM, 10_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const totals{mut_stats.totals(LOCK_TAG_VM)};
+                        bsl::ut_check(totals.acquisitions.is_zero());
+                        bsl::ut_check(totals.hold_total.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid tag"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                lock_stats_t mut_stats{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_stats.acquired(mut_tls, LOCK_TAG_MAX, 5_umax, true);
+                    mut_stats.released(mut_tls, LOCK_TAG_MAX, 10_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const totals{mut_stats.totals(LOCK_TAG_MAX)};
+                        bsl::ut_check(totals.acquisitions.is_zero());
+                        bsl::ut_check(totals.hold_total.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                lock_stats_t mut_stats{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_stats.acquired(mut_tls, LOCK_TAG_PAGE_POOL, 5_umax, true);
+                    mut_stats.released(mut_tls, LOCK_TAG_PAGE_POOL, 10_umax);
+                    mut_stats.acquired(mut_tls, LOCK_TAG_ROOT_PAGE_TABLE, {}, false);
+                    mut_stats.released(mut_tls, LOCK_TAG_ROOT_PAGE_TABLE, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_stats.dump();
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
@@ -22,9 +22,28 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
+#include "../../../src/lock_guard_t.hpp"
+#include "../../../src/ticketlock_t.hpp"
+
+/// NOTE:
+/// - The thread tests below need a page pool that is actually protected by
+///   its lock, so the real lock_guard_t and ticketlock_t are used instead of
+///   the mocked versions. Defining the include guards of the mocks ensures
+///   that the page pool picks up the versions included above.
+///
+
+#define MOCKS_LOCK_GUARD_T_HPP
+#define MOCKS_TICKETLOCK_T_HPP
+
 #include "../../../src/page_pool_t.hpp"
 
+#include <atomic>
+#include <thread>
+
 #include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstring.hpp>
 #include <bsl/ut.hpp>
 
 /// NOTE:
@@ -122,8 +141,16 @@ namespace mk
 {
     /// @brief used by most of the tests
     constexpr auto POOL_SIZE{3_umax};
-    /// @brief used by the fill tag buffer test
-    constexpr auto TAG_POOL_SIZE{11_umax};
+    /// @brief used by the allocate using every tag test
+    constexpr auto TAG_POOL_SIZE{ALLOCATE_TAG_MAX};
+    /// @brief used by the allocated_hwm test (needs more than one refill)
+    constexpr auto HWM_POOL_SIZE{PAGE_POOL_BATCH_SIZE + 1_umax};
+    /// @brief defines the tag used by most of the tests
+    constexpr auto TAG{ALLOCATE_TAG_BF_MEM_OP_ALLOC_PAGE};
+    /// @brief defines the tag used by the large pool tests
+    constexpr auto HOG_TAG{ALLOCATE_TAG_BF_MEM_OP_ALLOC_HEAP};
+    /// @brief defines an invalid tag
+    constexpr auto BAD_TAG{ALLOCATE_TAG_MAX};
     /// @brief only used by the dump test as this is too large for the stack
     constexpr auto LARGE_POOL_SIZE{2048_umax};
 
@@ -133,6 +160,65 @@ namespace mk
     /// @brief reduce the verbosity of the tests.
     using nd_t = page_pool_node_t;
 
+    /// @brief defines the number of threads (i.e., PPs) used by the thread tests
+    constexpr auto NUM_THREADS{8_umax};
+    /// @brief defines the number of pages each thread holds at once
+    constexpr auto PAGES_PER_THREAD{64_umax};
+    /// @brief defines the number of times each thread allocates its pages
+    constexpr auto NUM_ITERATIONS{256_umax};
+    /// @brief defines the size of the pool used by the thread tests
+    constexpr auto THREAD_POOL_SIZE{1024_umax};
+
+    /// @brief used by the thread tests
+    constinit bsl::array<page_pool_node_t, THREAD_POOL_SIZE.get()> g_mut_thread_pool{};
+    /// @brief defines the page pool shared by the thread tests
+    constinit page_pool_t g_mut_thread_page_pool{};
+    /// @brief defines the TLS blocks used by the thread tests
+    constinit bsl::array<tls_t, NUM_THREADS.get()> g_mut_thread_tls{};
+    /// @brief stores the pages that each thread is holding
+    constinit bsl::array<bsl::array<nd_t *, PAGES_PER_THREAD.get()>, NUM_THREADS.get()>
+        g_mut_thread_pages{};
+    /// @brief stores how many errors the thread tests have seen
+    constinit std::atomic<bsl::uint64> g_mut_thread_errors{};
+
+    /// <!-- description -->
+    ///   @brief Implements a yield for the ticketlock
+    ///
+    extern "C" void
+    yield() noexcept
+    {
+        std::this_thread::yield();
+    }
+
+    /// @brief stores the lock statistics of the page pool's lock
+    extern "C" constinit lock_stats_t g_mut_lock_stats{};
+
+    /// <!-- description -->
+    ///   @brief Implements a timestamp for the lock statistics
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns 0
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return {};
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements clear_pages for the page pool
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_virt the virtual address of the first page to zero
+    ///   @param pages the total number of pages to zero
+    ///
+    extern "C" void
+    clear_pages(void *const pmut_virt, bsl::uint64 const pages) noexcept
+    {
+        auto *const pmut_bytes{static_cast<bsl::uint8 *>(pmut_virt)};
+        bsl::builtin_memset(pmut_bytes, '\0', bsl::to_umax(pages) * HYPERVISOR_PAGE_SIZE);
+    }
+
     /// <!-- description -->
     ///   @brief Sets up the mut_pool. Note that this similar to how the loader
     ///     would set up the pool, but not the same. The loader's pages will
@@ -157,6 +243,77 @@ namespace mk
         mut_pool.back_if()->next = nullptr;
     }
 
+    /// <!-- description -->
+    ///   @brief Repeatedly allocates and deallocates pages using the PP
+    ///     provided. Each page is marked with the ppid that allocated it
+    ///     so that a page that is given to more than one PP at the same
+    ///     time is detected. The pages from the last iteration are kept
+    ///     so that they can be deallocated from a different PP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid the ppid to allocate and deallocate from
+    ///
+    void
+    alloc_thread_func(bsl::safe_uintmax const &ppid) noexcept
+    {
+        auto *const pmut_tls{g_mut_thread_tls.at_if(ppid)};
+        auto *const pmut_pages{g_mut_thread_pages.at_if(ppid)};
+        pmut_tls->ppid = bsl::to_u16(ppid).get();
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_ITERATIONS; ++mut_i) {
+            for (auto const elem : *pmut_pages) {
+                *elem.data = g_mut_thread_page_pool.allocate<nd_t>(*pmut_tls, TAG);
+                if (nullptr == *elem.data) {
+                    ++g_mut_thread_errors;
+                    continue;
+                }
+
+                *(*elem.data)->data.at_if(0_umax) = bsl::to_u8(ppid).get();
+            }
+
+            for (auto const elem : *pmut_pages) {
+                if (nullptr == *elem.data) {
+                    continue;
+                }
+
+                if (bsl::to_umax(*(*elem.data)->data.at_if(0_umax)) != ppid) {
+                    ++g_mut_thread_errors;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (mut_i + 1_umax < NUM_ITERATIONS) {
+                    g_mut_thread_page_pool.deallocate<nd_t>(*pmut_tls, *elem.data, TAG);
+                    *elem.data = nullptr;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Deallocates the pages held by the next thread using the
+    ///     PP provided, which ensures that pages are returned to a
+    ///     different PP than the PP that they were allocated from.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid the ppid to deallocate from
+    ///
+    void
+    free_thread_func(bsl::safe_uintmax const &ppid) noexcept
+    {
+        auto *const pmut_tls{g_mut_thread_tls.at_if(ppid)};
+        auto *const pmut_pages{g_mut_thread_pages.at_if((ppid + 1_umax) % NUM_THREADS)};
+
+        for (auto const elem : *pmut_pages) {
+            g_mut_thread_page_pool.deallocate<nd_t>(*pmut_tls, *elem.data, TAG);
+            *elem.data = nullptr;
+        }
+    }
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -179,7 +336,7 @@ namespace mk
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, "") == nullptr);
+                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, BAD_TAG) == nullptr);
                     };
                 };
             };
@@ -193,7 +350,7 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     mut_page_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, "*") == nullptr);
+                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, TAG) == nullptr);
                     };
                 };
             };
@@ -210,18 +367,18 @@ namespace mk
                     mut_page_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "*") == mut_pool.at_if(0_umax));
+                            mut_page_pool.allocate<nd_t>(mut_tls, TAG) == mut_pool.at_if(0_umax));
                         bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "*") == mut_pool.at_if(1_umax));
+                            mut_page_pool.allocate<nd_t>(mut_tls, TAG) == mut_pool.at_if(1_umax));
                         bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "*") == mut_pool.at_if(2_umax));
-                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, "*") == nullptr);
+                            mut_page_pool.allocate<nd_t>(mut_tls, TAG) == mut_pool.at_if(2_umax));
+                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, TAG) == nullptr);
                     };
                 };
             };
         };
 
-        bsl::ut_scenario{"allocate until tags are full"} = []() noexcept {
+        bsl::ut_scenario{"allocate using every tag"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 page_pool_t mut_page_pool{};
                 bsl::array<page_pool_node_t, TAG_POOL_SIZE.get()> mut_pool{};
@@ -231,27 +388,14 @@ namespace mk
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "0") == mut_pool.at_if(0_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "1") == mut_pool.at_if(1_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "2") == mut_pool.at_if(2_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "3") == mut_pool.at_if(3_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "4") == mut_pool.at_if(4_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "5") == mut_pool.at_if(5_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "6") == mut_pool.at_if(6_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "7") == mut_pool.at_if(7_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "8") == mut_pool.at_if(8_umax));
-                        bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "9") == mut_pool.at_if(9_umax));
-                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, "42") == nullptr);
+                        for (bsl::safe_uintmax mut_i{}; mut_i < ALLOCATE_TAG_MAX; ++mut_i) {
+                            bsl::ut_check(
+                                mut_page_pool.allocate<nd_t>(mut_tls, mut_i) ==
+                                mut_pool.at_if(mut_i));
+                            bsl::ut_check(
+                                mut_page_pool.allocated(mut_tls, mut_i) == HYPERVISOR_PAGE_SIZE);
+                        }
+                        bsl::ut_check(mut_page_pool.allocate<nd_t>(mut_tls, BAD_TAG) == nullptr);
                     };
                 };
             };
@@ -267,13 +411,13 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
-                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
                     bsl::ut_required_step(
-                        mut_page_pool.allocated(mut_tls, "*") == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.allocated(mut_tls, TAG) == HYPERVISOR_PAGE_SIZE);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate<nd_t>(mut_tls, nullptr, "*");
+                        mut_page_pool.deallocate<nd_t>(mut_tls, nullptr, TAG);
                         bsl::ut_check(
-                            mut_page_pool.allocated(mut_tls, "*") == HYPERVISOR_PAGE_SIZE);
+                            mut_page_pool.allocated(mut_tls, TAG) == HYPERVISOR_PAGE_SIZE);
                     };
                 };
             };
@@ -289,13 +433,13 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
-                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
                     bsl::ut_required_step(
-                        mut_page_pool.allocated(mut_tls, "*") == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.allocated(mut_tls, TAG) == HYPERVISOR_PAGE_SIZE);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, "42");
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, BAD_TAG);
                         bsl::ut_check(
-                            mut_page_pool.allocated(mut_tls, "*") == HYPERVISOR_PAGE_SIZE);
+                            mut_page_pool.allocated(mut_tls, TAG) == HYPERVISOR_PAGE_SIZE);
                     };
                 };
             };
@@ -311,12 +455,12 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
-                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
                     bsl::ut_required_step(
-                        mut_page_pool.allocated(mut_tls, "*") == HYPERVISOR_PAGE_SIZE);
+                        mut_page_pool.allocated(mut_tls, TAG) == HYPERVISOR_PAGE_SIZE);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, "*");
-                        bsl::ut_check(mut_page_pool.allocated(mut_tls, "*").is_zero());
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, TAG);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG).is_zero());
                     };
                 };
             };
@@ -334,15 +478,15 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
-                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
-                    pmut_mut_node1 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
-                    pmut_mut_node2 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
-                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, "*") == nullptr);
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    pmut_mut_node1 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    pmut_mut_node2 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) == nullptr);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node2, "*");
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node1, "*");
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, "*");
-                        bsl::ut_check(mut_page_pool.allocated(mut_tls, "*").is_zero());
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node2, TAG);
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node1, TAG);
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, TAG);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG).is_zero());
                     };
                 };
             };
@@ -360,15 +504,50 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
-                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
-                    pmut_mut_node1 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
-                    pmut_mut_node2 = mut_page_pool.allocate<nd_t>(mut_tls, "*");
-                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, "*") == nullptr);
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    pmut_mut_node1 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    pmut_mut_node2 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) == nullptr);
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, "*");
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node1, "*");
-                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node2, "*");
-                        bsl::ut_check(mut_page_pool.allocated(mut_tls, "*").is_zero());
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, TAG);
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node1, TAG);
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node2, TAG);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate returns zeroed pages"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                page_pool_t mut_page_pool{};
+                bsl::array<page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                nd_t *pmut_mut_node0{};
+                nd_t *pmut_mut_node1{};
+                constexpr auto val{0x42_u8};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    bsl::ut_required_step(nullptr != pmut_mut_node0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr == pmut_mut_node0->next);
+                    };
+
+                    *pmut_mut_node0->data.front_if() = val.get();
+                    *pmut_mut_node0->data.back_if() = val.get();
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, TAG);
+                    pmut_mut_node1 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(pmut_mut_node0 == pmut_mut_node1);
+                        bsl::ut_check(nullptr == pmut_mut_node1->next);
+                        bsl::ut_check(bsl::uint8{} == *pmut_mut_node1->data.front_if());
+                        bsl::ut_check(bsl::uint8{} == *pmut_mut_node1->data.back_if());
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node1, TAG);
+                        };
                     };
                 };
             };
@@ -387,18 +566,94 @@ namespace mk
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_page_pool.allocated(mut_tls, ""));
-                        bsl::ut_check(!mut_page_pool.allocated(mut_tls, "*"));
+                        bsl::ut_check(!mut_page_pool.allocated(mut_tls, BAD_TAG));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG).is_zero());
                         bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "*") == mut_pool.at_if(0_umax));
-                        bsl::ut_check(mut_page_pool.allocated(mut_tls, "*") == expected1);
+                            mut_page_pool.allocate<nd_t>(mut_tls, TAG) == mut_pool.at_if(0_umax));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG) == expected1);
                         bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "*") == mut_pool.at_if(1_umax));
-                        bsl::ut_check(mut_page_pool.allocated(mut_tls, "*") == expected2);
+                            mut_page_pool.allocate<nd_t>(mut_tls, TAG) == mut_pool.at_if(1_umax));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG) == expected2);
                         bsl::ut_check(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "*") == mut_pool.at_if(2_umax));
-                        bsl::ut_check(mut_page_pool.allocated(mut_tls, "*") == expected3);
-                        bsl::ut_check(!mut_page_pool.allocated(mut_tls, "42"));
+                            mut_page_pool.allocate<nd_t>(mut_tls, TAG) == mut_pool.at_if(2_umax));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG) == expected3);
+                        bsl::ut_check(!mut_page_pool.allocated(mut_tls, BAD_TAG));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocated_hwm"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                page_pool_t mut_page_pool{};
+                bsl::array<page_pool_node_t, HWM_POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::array<nd_t *, HWM_POOL_SIZE.get()> mut_nodes{};
+                constexpr auto expected{HYPERVISOR_PAGE_SIZE * HWM_POOL_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_page_pool.allocated_hwm(mut_tls, BAD_TAG));
+                        bsl::ut_check(mut_page_pool.allocated_hwm(mut_tls, TAG).is_zero());
+
+                        // NOTE:
+                        // - The first allocation fills this PP's cache, and
+                        //   the last allocation refills it, which samples
+                        //   the tag's high-water mark, so the peak is kept
+                        //   once the pages are freed.
+                        //
+
+                        for (auto const elem : mut_nodes) {
+                            *elem.data = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                            bsl::ut_check(
+                                mut_page_pool.allocated_hwm(mut_tls, TAG) ==
+                                mut_page_pool.allocated(mut_tls, TAG));
+                        }
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG) == expected);
+                        bsl::ut_check(mut_page_pool.allocated_hwm(mut_tls, TAG) == expected);
+                        for (auto const elem : mut_nodes) {
+                            mut_page_pool.deallocate<nd_t>(mut_tls, *elem.data, TAG);
+                        }
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls, TAG).is_zero());
+                        bsl::ut_check(mut_page_pool.allocated_hwm(mut_tls, TAG) == expected);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"telemetry"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                page_pool_t mut_page_pool{};
+                bsl::array<page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                nd_t *pmut_mut_node0{};
+                nd_t *pmut_mut_node1{};
+                nd_t *pmut_mut_node2{};
+                constexpr auto expected{HYPERVISOR_PAGE_SIZE * POOL_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    pmut_mut_node0 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    pmut_mut_node1 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    pmut_mut_node2 = mut_page_pool.allocate<nd_t>(mut_tls, TAG);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) == nullptr);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_page_pool.size() == expected);
+                        bsl::ut_check(mut_page_pool.used() == expected);
+                        bsl::ut_check(mut_page_pool.high_water_mark() == expected);
+                        bsl::ut_check(mut_page_pool.failures() == 1_umax);
+                    };
+
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node0, TAG);
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node1, TAG);
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_mut_node2, TAG);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_page_pool.used().is_zero());
+                        bsl::ut_check(mut_page_pool.high_water_mark() == expected);
+                        bsl::ut_check(mut_page_pool.failures() == 1_umax);
                     };
                 };
             };
@@ -442,9 +697,9 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     initialize_pool(mut_view);
                     mut_page_pool.initialize(mut_view);
-                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, "*") != nullptr);
-                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, "*") != nullptr);
-                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, "*") != nullptr);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) != nullptr);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) != nullptr);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) != nullptr);
                     bsl::ut_then{} = [&]() noexcept {
                         mut_page_pool.dump();
                     };
@@ -460,9 +715,9 @@ namespace mk
                     mut_page_pool.initialize(mut_view);
                     for (bsl::safe_uintmax mut_i{}; mut_i < 1024_umax; ++mut_i) {
                         bsl::ut_required_step(
-                            mut_page_pool.allocate<nd_t>(mut_tls, "memory hog") != nullptr);
+                            mut_page_pool.allocate<nd_t>(mut_tls, HOG_TAG) != nullptr);
                     }
-                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, "*") != nullptr);
+                    bsl::ut_required_step(mut_page_pool.allocate<nd_t>(mut_tls, TAG) != nullptr);
                     bsl::ut_then{} = [&]() noexcept {
                         mut_page_pool.dump();
                     };
@@ -470,6 +725,52 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"allocate/deallocate from many PPs at once"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<std::thread, NUM_THREADS.get()> mut_threads{};
+                bsl::span mut_view{g_mut_thread_pool};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    g_mut_thread_page_pool.initialize(mut_view);
+                    for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        *mut_threads.at_if(mut_i) = std::thread{&alloc_thread_func, mut_i};
+                    }
+                    for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        mut_threads.at_if(mut_i)->join();
+                    }
+                    for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        *mut_threads.at_if(mut_i) = std::thread{&free_thread_func, mut_i};
+                    }
+                    for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        mut_threads.at_if(mut_i)->join();
+                    }
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(static_cast<bsl::uint64>(g_mut_thread_errors) == 0_umax);
+                        bsl::ut_check(g_mut_thread_page_pool
+                                          .allocated(*g_mut_thread_tls.front_if(), TAG)
+                                          .is_zero());
+
+                        // NOTE:
+                        // - Every page must still be accounted for, either
+                        //   in the global free list or in one of the PP
+                        //   caches, so draining each PP until it runs out
+                        //   of pages must return the entire pool.
+                        //
+
+                        bsl::safe_uintmax mut_total{};
+                        for (auto const elem : g_mut_thread_tls) {
+                            while (nullptr !=
+                                   g_mut_thread_page_pool.allocate<nd_t>(*elem.data, HOG_TAG)) {
+                                ++mut_total;
+                            }
+                        }
+
+                        bsl::ut_check(mut_total == THREAD_POOL_SIZE);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -61,8 +61,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mk::page_pool_t{}));
 
                 static_assert(noexcept(mut_pool.initialize(mut_view)));
-                static_assert(noexcept(mut_pool.allocate<mk::page_t>(mut_tls, "")));
-                static_assert(noexcept(mut_pool.deallocate<mk::page_t>(mut_tls, {}, "")));
+                static_assert(noexcept(mut_pool.allocate<mk::page_t>(mut_tls, {})));
+                static_assert(noexcept(mut_pool.deallocate<mk::page_t>(mut_tls, {}, {})));
                 static_assert(noexcept(mut_pool.virt_to_phys<mk::page_t>(&mut_page)));
                 static_assert(noexcept(mut_pool.phys_to_virt<mk::page_t>({})));
                 static_assert(noexcept(mut_pool.dump()));
@@ -52,6 +52,24 @@ namespace mk
         std::this_thread::yield();
     }
 
+    /// @brief stores the lock statistics of the named locks
+    extern "C" constinit lock_stats_t g_mut_lock_stats{};
+    /// @brief stores the current timestamp
+    constinit std::atomic<bsl::uint64> g_mut_timestamp{};
+
+    /// <!-- description -->
+    ///   @brief Implements a timestamp for the lock statistics
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a timestamp that increases by 1 each time it is
+    ///     read
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return ++g_mut_timestamp;
+    }
+
     /// <!-- description -->
     ///   @brief Used to test to make sure that threads have to wait
     ///
@@ -109,6 +127,29 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"named lock records statistics"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                spinlock_t mut_spinlock{LOCK_TAG_VM};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_spinlock.lock(mut_tls);
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_spinlock.lock(mut_tls);
+                    mut_spinlock.unlock(mut_tls);
+                    mut_tls.esr_ip = {};
+                    mut_spinlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const totals{g_mut_lock_stats.totals(LOCK_TAG_VM)};
+                        bsl::ut_check(totals.acquisitions == 1_umax);
+                        bsl::ut_check(totals.contended.is_zero());
+                        bsl::ut_check(!totals.spin_max.is_zero());
+                        bsl::ut_check(!totals.hold_max.is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"lock/unlock from esr"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 spinlock_t mut_spinlock{};
@@ -30,6 +30,7 @@
 namespace mk
 {
     constinit spinlock_t const g_verify_constinit{};
+    constinit spinlock_t const g_verify_constinit_named{LOCK_TAG_VM};
 
     /// <!-- description -->
     ///   @brief Implements a yield for the spinlock
@@ -37,6 +38,21 @@ namespace mk
     extern "C" void
     yield() noexcept
     {}
+
+    /// @brief stores the lock statistics of the named locks
+    extern "C" constinit lock_stats_t g_mut_lock_stats{};
+
+    /// <!-- description -->
+    ///   @brief Implements a timestamp for the lock statistics
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns 0
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return {};
+    }
 }
 
 /// <!-- description -->
@@ -54,6 +70,7 @@ main() noexcept -> bsl::exit_code
 
     bsl::ut_scenario{"verify supports constinit"} = []() noexcept {
         bsl::discard(mk::g_verify_constinit);
+        bsl::discard(mk::g_verify_constinit_named);
     };
 
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
@@ -62,6 +79,7 @@ main() noexcept -> bsl::exit_code
             mk::spinlock_t const spinlock{};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(mk::spinlock_t{}));
+                static_assert(noexcept(mk::spinlock_t{mk::LOCK_TAG_VM}));
 
                 static_assert(noexcept(mut_spinlock.lock({})));
                 static_assert(noexcept(mut_spinlock.unlock({})));
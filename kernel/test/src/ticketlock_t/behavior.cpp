@@ -0,0 +1,594 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/ticketlock_t.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include <bsl/array.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the max number of wait threads (one per PP)
+    constexpr auto MAX_WAIT_THREADS{HYPERVISOR_MAX_PPS};
+    /// @brief defines the ppid of the PP that holds the lock in the ESR tests
+    constexpr auto OTHER_PPID{1_u16};
+    /// @brief defines the global ticket lock used for the thread tests
+    constinit ticketlock_t g_mut_ticketlock{};
+    /// @brief defines the dummy TLS block for wait thread
+    constinit bsl::array<tls_t, MAX_WAIT_THREADS.get()> g_mut_tls_wait{};
+    /// @brief stores how many threads are started
+    constinit std::atomic<bsl::uint64> g_mut_threads_started{};
+    /// @brief stores how many threads had to wait
+    constinit std::atomic<bsl::uint64> g_mut_threads_that_waited{};
+
+    /// @brief defines the global ticket lock used for the ESR tests
+    constinit ticketlock_t g_mut_esr_ticketlock{};
+    /// @brief defines the dummy TLS block for the PP that holds the lock
+    constinit tls_t g_mut_tls_other{};
+    /// @brief defines the dummy TLS block for the ESR
+    constinit tls_t g_mut_tls_esr{};
+    /// @brief tells yield() to fire the "ESR" on its next call
+    constinit bool g_mut_fire_esr{};
+    /// @brief stores whether or not the "ESR" acquired the lock
+    constinit bool g_mut_esr_acquired{};
+    /// @brief defines the global named ticket lock used for the ESR window test
+    constinit ticketlock_t g_mut_window_ticketlock{LOCK_TAG_VM};
+    /// @brief tells timestamp() to fire the "ESR" on its next call
+    constinit bool g_mut_fire_esr_on_timestamp{};
+
+    /// <!-- description -->
+    ///   @brief Implements a yield for the ticketlock. If g_mut_fire_esr
+    ///     is set, this simulates an ESR that fires while the PP is
+    ///     waiting for its ticket. The PP that holds the lock first
+    ///     releases it, and then the ESR takes the lock, which only works
+    ///     if it borrows the ticket of the code that it interrupted.
+    ///
+    extern "C" void
+    yield() noexcept
+    {
+        if (g_mut_fire_esr) {
+            g_mut_fire_esr = false;
+
+            g_mut_esr_ticketlock.unlock(g_mut_tls_other);
+            g_mut_esr_ticketlock.lock(g_mut_tls_esr);
+            g_mut_esr_acquired = g_mut_esr_ticketlock.is_locked();
+            g_mut_esr_ticketlock.unlock(g_mut_tls_esr);
+
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+
+    /// @brief stores the lock statistics of the named locks
+    extern "C" constinit lock_stats_t g_mut_lock_stats{};
+    /// @brief stores the current timestamp
+    constinit std::atomic<bsl::uint64> g_mut_timestamp{};
+
+    /// <!-- description -->
+    ///   @brief Implements a timestamp for the lock statistics. The
+    ///     lock asks for a timestamp right after it takes a ticket, and
+    ///     before the ticket is stored. If g_mut_fire_esr_on_timestamp
+    ///     is set, this simulates an ESR that fires in this window. The
+    ///     PP that holds the lock first releases it, and then the ESR
+    ///     takes the lock, which only works if it can still find the
+    ///     ticket that the interrupted code took.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a timestamp that increases by 1 each time it is
+    ///     read
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        if (g_mut_fire_esr_on_timestamp) {
+            g_mut_fire_esr_on_timestamp = false;
+
+            g_mut_window_ticketlock.unlock(g_mut_tls_other);
+            g_mut_window_ticketlock.lock(g_mut_tls_esr);
+            g_mut_esr_acquired = g_mut_window_ticketlock.is_locked();
+            g_mut_window_ticketlock.unlock(g_mut_tls_esr);
+        }
+
+        return ++g_mut_timestamp;
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to test to make sure that threads have to wait
+    ///
+    void
+    thread_func(bsl::safe_uintmax const &ppid) noexcept
+    {
+        bool mut_this_thread_waited{};
+
+        auto *const pmut_tls{g_mut_tls_wait.at_if(ppid)};
+        pmut_tls->ppid = bsl::to_u16(ppid).get();
+
+        ++g_mut_threads_started;
+
+        g_mut_ticketlock.lock(*pmut_tls);
+        while (static_cast<bsl::uint64>(g_mut_threads_started) < MAX_WAIT_THREADS) {
+            if (!mut_this_thread_waited) {
+                ++g_mut_threads_that_waited;
+                mut_this_thread_waited = true;
+            }
+
+            yield();
+        }
+        g_mut_ticketlock.unlock(*pmut_tls);
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"lock/unlock"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"named lock records statistics"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{LOCK_TAG_PAGE_POOL};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    mut_ticketlock.unlock(mut_tls);
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const totals{g_mut_lock_stats.totals(LOCK_TAG_PAGE_POOL)};
+                        bsl::ut_check(totals.acquisitions == 1_umax);
+                        bsl::ut_check(totals.contended.is_zero());
+                        bsl::ut_check(!totals.spin_max.is_zero());
+                        bsl::ut_check(!totals.hold_max.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock/unlock from esr"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock twice"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock twice from esr"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock std, lock esr, unlock esr, unlock std"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock esr, lock std, unlock std, unlock esr"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock esr, lock std, unlock esr, unlock std"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock std, lock esr, unlock std, unlock esr"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock std, lock esr, lock esr,  unlock std, unlock esr"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock esr, lock std, lock std, unlock esr, unlock std"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ticketlock_t mut_ticketlock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = (1_umax).get();
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ticketlock.is_locked());
+                    };
+
+                    mut_tls.esr_ip = {};
+                    mut_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock from esr while waiting for a ticket"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_tls_other.ppid = OTHER_PPID.get();
+                    g_mut_tls_esr.esr_ip = (1_umax).get();
+
+                    mut_tls.esr_ip = {};
+                    g_mut_esr_ticketlock.lock(g_mut_tls_other);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_esr_ticketlock.is_locked());
+                    };
+
+                    g_mut_fire_esr = true;
+                    g_mut_esr_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_fire_esr);
+                        bsl::ut_check(g_mut_esr_acquired);
+                        bsl::ut_check(g_mut_esr_ticketlock.is_locked());
+                    };
+
+                    g_mut_esr_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_esr_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock from esr between taking and storing a ticket"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_tls_other.ppid = OTHER_PPID.get();
+                    g_mut_tls_esr.esr_ip = (1_umax).get();
+                    g_mut_esr_acquired = false;
+
+                    mut_tls.esr_ip = {};
+                    g_mut_window_ticketlock.lock(g_mut_tls_other);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_window_ticketlock.is_locked());
+                    };
+
+                    g_mut_fire_esr_on_timestamp = true;
+                    g_mut_window_ticketlock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_fire_esr_on_timestamp);
+                        bsl::ut_check(g_mut_esr_acquired);
+                        bsl::ut_check(g_mut_window_ticketlock.is_locked());
+                    };
+
+                    g_mut_window_ticketlock.unlock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_window_ticketlock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"prove ticket locks wait"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<std::thread, MAX_WAIT_THREADS.get()> mut_threads{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_uintmax mut_i{}; mut_i < MAX_WAIT_THREADS; ++mut_i) {
+                        *mut_threads.at_if(mut_i) = std::thread{&thread_func, mut_i};
+                    }
+                    for (bsl::safe_uintmax mut_i{}; mut_i < MAX_WAIT_THREADS; ++mut_i) {
+                        mut_threads.at_if(mut_i)->join();
+                    }
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(
+                            static_cast<bsl::uint64>(g_mut_threads_started) == MAX_WAIT_THREADS);
+
+                        // NOTE:
+                        // - If g_mut_threads_that_waited is one, it means that
+                        //   all of the threads were locked until they were
+                        //   all started. Once there are all started, the
+                        //   thread that gets the critical region first will
+                        //   be the only thread that had to wait. The rest
+                        //   will get access to the critical region and just
+                        //   pass through. This proves that some of the threads
+                        //   had to wait on the ticketlock and not pass through,
+                        //   otherwise this count would be higher than 1.
+                        // - What is great about this approach is that it will
+                        //   work no matter how many threads you create, and
+                        //   it will also work on single core systems. It also
+                        //   ensures that every line and break is executed, so
+                        //   there are no race conditions, which previous
+                        //   attempts at this test had.
+                        //
+
+                        bsl::ut_check(
+                            static_cast<bsl::uint64>(g_mut_threads_that_waited) == 1_umax);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    mk::yield();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
@@ -0,0 +1,216 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include "../../../src/spinlock_t.hpp"
+#include "../../../src/ticketlock_t.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <bsl/array.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of threads that contend for the lock
+    constexpr auto NUM_THREADS{HYPERVISOR_MAX_PPS};
+    /// @brief defines the number of times each thread takes the lock
+    constexpr auto NUM_ITERATIONS{0x1000_umax};
+
+    /// @brief defines the dummy TLS block for each thread
+    constinit bsl::array<tls_t, NUM_THREADS.get()> g_mut_tls{};
+    /// @brief stores how many threads are ready to start
+    constinit std::atomic<bsl::uint64> g_mut_threads_ready{};
+    /// @brief stores how many times the lock was taken (lock protected)
+    constinit bsl::safe_uintmax g_mut_count{};
+    /// @brief stores the longest time (in ns) each thread waited for the lock
+    constinit bsl::array<bsl::safe_uintmax, NUM_THREADS.get()> g_mut_worst_wait{};
+
+    /// <!-- description -->
+    ///   @brief Implements a yield for the locks. On the host, a thread
+    ///     that is waiting on a lock can be preempted, and so we give the
+    ///     CPU back to the OS instead of burning the rest of the time
+    ///     slice. On a PP this is a pause, and PPs are never preempted.
+    ///
+    extern "C" void
+    yield() noexcept
+    {
+        std::this_thread::yield();
+    }
+
+    /// @brief stores the lock statistics of the named locks
+    extern "C" constinit lock_stats_t g_mut_lock_stats{};
+
+    /// <!-- description -->
+    ///   @brief Implements a timestamp for the lock statistics
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns 0
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return {};
+    }
+
+    /// <!-- description -->
+    ///   @brief Takes the provided lock NUM_ITERATIONS times, and records
+    ///     the longest amount of time it took to acquire the lock.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of lock to contend for
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_lock the lock to contend for
+    ///   @param ppid the ppid of the thread (i.e., the simulated PP)
+    ///
+    template<typename T>
+    void
+    contend(T *const pmut_lock, bsl::safe_uintmax const &ppid) noexcept
+    {
+        auto *const pmut_tls{g_mut_tls.at_if(ppid)};
+        pmut_tls->ppid = bsl::to_u16(ppid).get();
+
+        ++g_mut_threads_ready;
+        while (static_cast<bsl::uint64>(g_mut_threads_ready) < NUM_THREADS) {
+            yield();
+        }
+
+        bsl::safe_uintmax mut_worst{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_ITERATIONS; ++mut_i) {
+            auto const start{std::chrono::steady_clock::now()};
+            pmut_lock->lock(*pmut_tls);
+            auto const stop{std::chrono::steady_clock::now()};
+
+            ++g_mut_count;
+            pmut_lock->unlock(*pmut_tls);
+
+            auto const ns{std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)};
+            bsl::safe_uintmax const wait{static_cast<bsl::uintmax>(ns.count())};
+            if (wait > mut_worst) {
+                mut_worst = wait;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        *g_mut_worst_wait.at_if(ppid) = mut_worst;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs the contention benchmark for the provided lock type
+    ///     and outputs the results. The average is the total amount of
+    ///     time it took all of the threads to take the lock NUM_ITERATIONS
+    ///     times, divided by the number of times the lock was taken, and
+    ///     the worst wait is the longest any one thread had to wait for
+    ///     the lock, which is a measure of how (un)fair the lock is.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of lock to contend for
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param name the name of the lock to output
+    ///   @return Returns the number of times the lock was taken
+    ///
+    template<typename T>
+    [[nodiscard]] auto
+    run(bsl::string_view const &name) noexcept -> bsl::safe_uintmax
+    {
+        T mut_lock{};
+        bsl::array<std::thread, NUM_THREADS.get()> mut_threads{};
+
+        g_mut_threads_ready = {};
+        g_mut_count = {};
+
+        auto const start{std::chrono::steady_clock::now()};
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+            *mut_threads.at_if(mut_i) = std::thread{&contend<T>, &mut_lock, mut_i};
+        }
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+            mut_threads.at_if(mut_i)->join();
+        }
+        auto const stop{std::chrono::steady_clock::now()};
+
+        bsl::safe_uintmax mut_worst{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+            auto const wait{*g_mut_worst_wait.at_if(mut_i)};
+            if (wait > mut_worst) {
+                mut_worst = wait;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        auto const ns{std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)};
+        bsl::safe_uintmax const total{static_cast<bsl::uintmax>(ns.count())};
+
+        bsl::print() << bsl::cyn << bsl::fmt{"<14s", name} << bsl::rst;
+        bsl::print() << bsl::fmt{"10d", total / g_mut_count} << " ns/lock   ";
+        bsl::print() << bsl::fmt{"12d", mut_worst} << " ns worst wait";
+        bsl::print() << bsl::endl;
+
+        return g_mut_count;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this benchmark. Each lock type is taken
+///     by NUM_THREADS threads at the same time and the results are
+///     outputted so that the two can be compared. The only thing that is
+///     checked is that both locks provide mutual exclusion, as the
+///     timing depends on the host that the benchmark runs on.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    mk::yield();
+
+    bsl::ut_scenario{"spinlock_t vs ticketlock_t contention"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto const expected{mk::NUM_THREADS * mk::NUM_ITERATIONS};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const spinlock_count{mk::run<mk::spinlock_t>("spinlock_t")};
+                auto const ticketlock_count{mk::run<mk::ticketlock_t>("ticketlock_t")};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(expected == spinlock_count);
+                    bsl::ut_check(expected == ticketlock_count);
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
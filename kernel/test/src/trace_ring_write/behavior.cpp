@@ -0,0 +1,173 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/trace_ring_write.hpp"
+
+#include <trace_ring_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the TSC used by the tests
+    constexpr auto TEST_TSC{0x2A_umax};
+    /// @brief defines a mask that enables every trace event
+    constexpr auto TEST_MASK_ALL{(1_umax << loader::TRACE_EVENT_MAX) - 1_umax};
+    /// @brief stores the trace ring used by the tests
+    constinit loader::trace_ring_t g_mut_trace_ring{};
+
+    /// <!-- description -->
+    ///   @brief Implements timestamp for trace_ring_write
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns TEST_TSC
+    ///
+    extern "C" [[nodiscard]] auto
+    timestamp() noexcept -> bsl::uint64
+    {
+        return TEST_TSC.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. The trace ring is never
+    ///     written during constant evaluation, so unlike most of the other
+    ///     tests, these checks are only executed at run-time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"no trace ring"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_then{} = [&]() noexcept {
+                    trace_ring_write(mut_tls, loader::TRACE_EVENT_VMEXIT);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"disabled event is not recorded"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                g_mut_trace_ring = {};
+                g_mut_trace_ring.mask = (1_umax << loader::TRACE_EVENT_VMENTRY).get();
+                mut_tls.trace_ring = &g_mut_trace_ring;
+                bsl::ut_when{} = [&]() noexcept {
+                    trace_ring_write(mut_tls, loader::TRACE_EVENT_VMEXIT);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.epos).is_zero());
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.num).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enabled event is recorded"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                g_mut_trace_ring = {};
+                g_mut_trace_ring.mask = TEST_MASK_ALL.get();
+                mut_tls.trace_ring = &g_mut_trace_ring;
+                mut_tls.active_vpsid = 0x23_u16.get();
+                bsl::ut_when{} = [&]() noexcept {
+                    trace_ring_write(mut_tls, loader::TRACE_EVENT_VMEXIT, 0x11_umax, 0x22_umax);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const &rec{*g_mut_trace_ring.records.front_if()};
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.epos) == 1_umax);
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.num) == 1_umax);
+                        bsl::ut_check(bsl::to_umax(rec.event) == loader::TRACE_EVENT_VMEXIT);
+                        bsl::ut_check(bsl::to_umax(rec.vpsid) == 0x23_umax);
+                        bsl::ut_check(bsl::to_umax(rec.tsc) == TEST_TSC);
+                        bsl::ut_check(bsl::to_umax(rec.data0) == 0x11_umax);
+                        bsl::ut_check(bsl::to_umax(rec.data1) == 0x22_umax);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write wraps around the end of the trace ring"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                auto const last{loader::TRACE_RING_MAX_RECORDS - 1_umax};
+                g_mut_trace_ring = {};
+                g_mut_trace_ring.mask = TEST_MASK_ALL.get();
+                g_mut_trace_ring.epos = last.get();
+                g_mut_trace_ring.num = last.get();
+                mut_tls.trace_ring = &g_mut_trace_ring;
+                bsl::ut_when{} = [&]() noexcept {
+                    trace_ring_write(mut_tls, loader::TRACE_EVENT_PAGE_FAULT);
+                    trace_ring_write(mut_tls, loader::TRACE_EVENT_LOCK_CONTENTION);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const &first{*g_mut_trace_ring.records.at_if(last)};
+                        auto const &second{*g_mut_trace_ring.records.front_if()};
+                        auto const num{bsl::to_umax(g_mut_trace_ring.num)};
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.epos) == 1_umax);
+                        bsl::ut_check(num == loader::TRACE_RING_MAX_RECORDS + 1_umax);
+                        bsl::ut_check(bsl::to_umax(first.event) == loader::TRACE_EVENT_PAGE_FAULT);
+                        auto const event{bsl::to_umax(second.event)};
+                        bsl::ut_check(event == loader::TRACE_EVENT_LOCK_CONTENTION);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid epos is reset"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                g_mut_trace_ring = {};
+                g_mut_trace_ring.mask = TEST_MASK_ALL.get();
+                g_mut_trace_ring.epos = loader::TRACE_RING_MAX_RECORDS.get();
+                mut_tls.trace_ring = &g_mut_trace_ring;
+                bsl::ut_when{} = [&]() noexcept {
+                    trace_ring_write(mut_tls, loader::TRACE_EVENT_VMEXIT);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.epos).is_zero());
+                        bsl::ut_check(bsl::to_umax(g_mut_trace_ring.num).is_zero());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return mk::tests();
+}
@@ -0,0 +1,292 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../../src/x64/fpu_t.hpp"
+
+#include <page_t.hpp>
+
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief used to tell fpu_t that XSAVE is enabled
+    constexpr auto XSAVE_ENABLED{1_umax};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"xsave disabled"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = {};
+                    bsl::ut_required_step(mut_fpu.allocate(mut_tls, mut_page_pool));
+                    mut_fpu.load(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr == mut_fpu.xsave_area());
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    mut_page_pool.set_allocate<page_t>(ALLOCATE_TAG_XSAVE, nullptr, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_fpu.allocate(mut_tls, mut_page_pool));
+                        bsl::ut_check(nullptr == mut_fpu.xsave_area());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate sets mxcsr to its power-on value"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu.allocate(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const &data{mut_fpu.xsave_area()->data};
+                        bsl::ut_check(0x80_u8 == bsl::safe_uint8{*data.at_if(24_umax)});
+                        bsl::ut_check(0x1F_u8 == bsl::safe_uint8{*data.at_if(25_umax)});
+                        bsl::ut_check(0x00_u8 == bsl::safe_uint8{*data.at_if(26_umax)});
+                        bsl::ut_check(0x00_u8 == bsl::safe_uint8{*data.at_if(27_umax)});
+                        bsl::ut_check(0xFF_u8 == bsl::safe_uint8{*data.at_if(28_umax)});
+                        bsl::ut_check(0xFF_u8 == bsl::safe_uint8{*data.at_if(29_umax)});
+                        bsl::ut_check(0x00_u8 == bsl::safe_uint8{*data.at_if(30_umax)});
+                        bsl::ut_check(0x00_u8 == bsl::safe_uint8{*data.at_if(31_umax)});
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"load takes ownership of the fpu"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu.allocate(mut_tls, mut_page_pool));
+                    mut_fpu.load(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr != mut_fpu.xsave_area());
+                        bsl::ut_check(mut_fpu.xsave_area() == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"load twice keeps ownership of the fpu"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu.allocate(mut_tls, mut_page_pool));
+                    mut_fpu.load(mut_tls, mut_intrinsic);
+                    mut_fpu.load(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_fpu.xsave_area() == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"load steals the fpu from another vps"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu1{};
+                fpu_t mut_fpu2{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu1.allocate(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_fpu2.allocate(mut_tls, mut_page_pool));
+                    mut_fpu1.load(mut_tls, mut_intrinsic);
+                    mut_fpu2.load(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_fpu2.xsave_area() == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu1.deallocate(mut_tls, mut_page_pool);
+                            mut_fpu2.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"release gives the fpu to the host"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu.allocate(mut_tls, mut_page_pool));
+                    mut_fpu.load(mut_tls, mut_intrinsic);
+                    fpu_t::release(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        fpu_t::release(mut_tls, mut_intrinsic);
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"save only releases its own state"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu1{};
+                fpu_t mut_fpu2{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu1.allocate(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_fpu2.allocate(mut_tls, mut_page_pool));
+                    mut_fpu1.load(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_fpu2.save(mut_tls, mut_intrinsic);
+                        bsl::ut_check(mut_fpu1.xsave_area() == mut_tls.fpu_owner);
+                        mut_fpu1.save(mut_tls, mut_intrinsic);
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu1.deallocate(mut_tls, mut_page_pool);
+                            mut_fpu2.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"promote gives the fpu to the root os"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu1{};
+                fpu_t mut_fpu2{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu1.allocate(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_fpu2.allocate(mut_tls, mut_page_pool));
+                    mut_fpu1.init_as_root(mut_tls, mut_intrinsic);
+                    mut_fpu2.load(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_fpu1.promote(mut_tls, mut_intrinsic);
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        mut_fpu1.load(mut_tls, mut_intrinsic);
+                        mut_fpu1.promote(mut_tls, mut_intrinsic);
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_fpu1.deallocate(mut_tls, mut_page_pool);
+                            mut_fpu2.deallocate(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate clears the owner"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fpu_t mut_fpu{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.xsave_enabled = XSAVE_ENABLED.get();
+                    bsl::ut_required_step(mut_fpu.allocate(mut_tls, mut_page_pool));
+                    mut_fpu.load(mut_tls, mut_intrinsic);
+                    mut_fpu.deallocate(mut_tls, mut_page_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr == mut_tls.fpu_owner);
+                        bsl::ut_check(nullptr == mut_fpu.xsave_area());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
@@ -180,6 +180,41 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"activate with pcids enabled"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto pcid{0x42_umax};
+                constexpr auto enabled{1_umax};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.pcid_enabled = enabled.get();
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.set_pcid(pcid));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.pcid() == pcid);
+                        bsl::ut_check(mut_rpt.activate(mut_tls, mut_intrinsic));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_pcid invalid pcid"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                constexpr auto pcid{0x1000_umax};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.set_pcid(bsl::safe_uintmax::failure()));
+                    bsl::ut_check(!mut_rpt.set_pcid(pcid));
+                    bsl::ut_check(mut_rpt.pcid().is_zero());
+                };
+            };
+        };
+
         bsl::ut_scenario{"map_page uninitialized fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 root_page_table_t mut_rpt{};
@@ -745,6 +780,793 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"unmap_page uninitialized fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt, atrl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page invalid virt"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, {}, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(
+                            mut_tls, mut_page_pool, bsl::safe_uintmax::failure(), atrl));
+                        bsl::ut_check(
+                            !mut_rpt.unmap_page(mut_tls, mut_page_pool, 0x1042_umax, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page invalid auto_release"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.unmap_page(
+                            mut_tls, mut_page_pool, virt, bsl::safe_uintmax::failure()));
+                        bsl::ut_check(!mut_rpt.unmap_page(
+                            mut_tls, mut_page_pool, virt, MAP_PAGE_AUTO_RELEASE_MAX));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page not mapped fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt1{0x1000_umax};
+                constexpr auto virt2{0x2000_umax};
+                constexpr auto virt3{0x201000_umax};
+                constexpr auto virt4{0x40001000_umax};
+                constexpr auto virt5{0x8000001000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt1, phys, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt2, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt3, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt4, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt5, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page wrong auto_release fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                constexpr auto othr{MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt, phys, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt, othr));
+                        bsl::ut_check(mut_rpt.unmap_page(mut_tls, mut_page_pool, virt, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt, phys, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.unmap_page(mut_tls, mut_page_pool, virt, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt, atrl));
+                        bsl::ut_check(
+                            mut_rpt.map_page(mut_tls, mut_page_pool, virt, phys, flgs, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_pages uses 2M pages when aligned"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                bsl::safe_uintmax mut_pts{};
+                constexpr auto virt0{0x1000_umax};
+                constexpr auto virt1{0x200000_umax};
+                constexpr auto virt2{0x201000_umax};
+                constexpr auto phys{0x400000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt0, phys, flgs, atrl));
+                    mut_pts = mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_PTS);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.map_pages(
+                            mut_tls, mut_page_pool, virt1, phys, byts, flgs, atrl));
+                        bsl::ut_check(
+                            mut_pts == mut_page_pool.allocated(mut_tls, ALLOCATE_TAG_PTS));
+                        bsl::ut_check(
+                            bsl::errc_already_exists ==
+                            mut_rpt.map_page(mut_tls, mut_page_pool, virt2, phys, flgs, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt1, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_pages(
+                            mut_tls, mut_page_pool, virt1, byts, MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE));
+                        bsl::ut_check(
+                            mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt1, byts, atrl));
+                        bsl::ut_check(
+                            mut_rpt.map_page(mut_tls, mut_page_pool, virt2, phys, flgs, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_pages uses 4k pages when unaligned"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x1ff000_umax};
+                constexpr auto virt1{0x200000_umax};
+                constexpr auto virt2{0x400000_umax};
+                constexpr auto phys{0x1ff000_umax};
+                constexpr auto byts{0x202000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.map_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts, flgs, atrl));
+                        bsl::ut_check(
+                            bsl::errc_already_exists ==
+                            mut_rpt.map_page(mut_tls, mut_page_pool, virt1, phys, flgs, atrl));
+                        bsl::ut_check(mut_rpt.unmap_page(mut_tls, mut_page_pool, virt0, atrl));
+                        bsl::ut_check(mut_rpt.unmap_page(mut_tls, mut_page_pool, virt2, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_tls, mut_page_pool, virt1, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_pages uses 4k pages with auto release"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x200000_umax};
+                constexpr auto phys{0x400000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.map_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts, flgs, atrl));
+                        bsl::ut_check(
+                            mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt0, byts, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_pages uses 4k pages when a pt already exists"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x200000_umax};
+                constexpr auto virt1{0x201000_umax};
+                constexpr auto phys{0x400000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt1, phys, flgs, atrl));
+                    bsl::ut_required_step(
+                        mut_rpt.unmap_page(mut_tls, mut_page_pool, virt1, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            bsl::errc_unsupported ==
+                            mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt0, phys, flgs));
+                        bsl::ut_check(mut_rpt.map_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts, flgs, atrl));
+                        bsl::ut_check(mut_rpt.unmap_page(mut_tls, mut_page_pool, virt1, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_page_2m invalid alignment"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x200000_umax};
+                constexpr auto virt1{0x201000_umax};
+                constexpr auto phys0{0x400000_umax};
+                constexpr auto phys1{0x401000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt1, phys0, flgs));
+                        bsl::ut_check(
+                            !mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt0, phys1, flgs));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_page_1g success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x40000000_umax};
+                constexpr auto virt1{0x40200000_umax};
+                constexpr auto virt2{0x40201000_umax};
+                constexpr auto phys{0x80000000_umax};
+                constexpr auto byts{0x40000000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_EXECUTE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_rpt.map_page_1g(mut_tls, mut_page_pool, virt0, phys, flgs));
+                        bsl::ut_check(
+                            bsl::errc_already_exists ==
+                            mut_rpt.map_page_1g(mut_tls, mut_page_pool, virt0, phys, flgs));
+                        bsl::ut_check(
+                            bsl::errc_already_exists ==
+                            mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt1, phys, flgs));
+                        bsl::ut_check(
+                            bsl::errc_already_exists ==
+                            mut_rpt.map_page(mut_tls, mut_page_pool, virt2, phys, flgs, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_pages(
+                            mut_tls, mut_page_pool, virt1, RPT_PAGE_SIZE_2M, atrl));
+                        bsl::ut_check(
+                            mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt0, byts, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_page_1g with an existing pdt"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x40000000_umax};
+                constexpr auto virt1{0x40200000_umax};
+                constexpr auto phys{0x80000000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt1, phys, flgs));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            bsl::errc_unsupported ==
+                            mut_rpt.map_page_1g(mut_tls, mut_page_pool, virt0, phys, flgs));
+                        bsl::ut_check(
+                            bsl::errc_already_exists ==
+                            mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt1, phys, flgs));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_pages uninitialized fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x200000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt, byts, atrl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_pages invalid arguments"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x200000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.unmap_pages(
+                            mut_tls, mut_page_pool, bsl::safe_uintmax::failure(), byts, atrl));
+                        bsl::ut_check(!mut_rpt.unmap_pages(
+                            mut_tls, mut_page_pool, virt + 1_umax, byts, atrl));
+                        bsl::ut_check(
+                            !mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt, 0_umax, atrl));
+                        bsl::ut_check(
+                            !mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt, 1_umax, atrl));
+                        bsl::ut_check(
+                            !mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt, byts, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"protect_pages uninitialized fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto byts{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.protect_pages(mut_tls, mut_page_pool, virt, byts, flgs));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"protect_pages invalid arguments"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto byts{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ};
+                constexpr auto wx{MAP_PAGE_WRITE | MAP_PAGE_EXECUTE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt, phys, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, {}, byts, flgs));
+                        bsl::ut_check(!mut_rpt.protect_pages(
+                            mut_tls, mut_page_pool, 0x1042_umax, byts, flgs));
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt, {}, flgs));
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt, 1_umax, flgs));
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt, byts, {}));
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt, byts, wx));
+                        bsl::ut_check(!mut_rpt.protect_pages(
+                            mut_tls, mut_page_pool, virt, byts + byts, flgs));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"protect_pages large pages"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x200000_umax};
+                constexpr auto virt1{0x201000_umax};
+                constexpr auto phys{0x400000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto page{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto rx{MAP_PAGE_READ | MAP_PAGE_EXECUTE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_pages(mut_tls, mut_page_pool, virt0, phys, byts, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt0, page, rx));
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt1, page, rx));
+                        bsl::ut_check(
+                            mut_rpt.protect_pages(mut_tls, mut_page_pool, virt0, byts, rx));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"generation protocol"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                tls_t mut_pp0{};
+                tls_t mut_pp1{};
+                tls_t mut_pp2{};
+                constexpr auto virt0{0x1000_umax};
+                constexpr auto virt1{0x2000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto byts{0x2000_umax};
+                constexpr auto page{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                constexpr auto enabled{1_umax};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_pp1.ppid = bsl::to_u16(1).get();
+                    mut_pp2.ppid = bsl::to_u16(2).get();
+                    mut_pp1.pcid_enabled = enabled.get();
+                    bsl::ut_required_step(mut_rpt.initialize(mut_pp0, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_pages(mut_pp0, mut_page_pool, virt0, phys, byts, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.activate(mut_pp0, mut_intrinsic));
+                        bsl::ut_check(mut_rpt.activate(mut_pp1, mut_intrinsic));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp0));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp1));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp2));
+
+                        bsl::ut_check(mut_rpt.unmap_page(mut_pp0, mut_page_pool, virt0, atrl));
+                        bsl::ut_check(mut_rpt.is_stale(mut_pp0));
+                        bsl::ut_check(mut_rpt.is_stale(mut_pp1));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp2));
+
+                        bsl::ut_check(mut_rpt.activate(mut_pp1, mut_intrinsic));
+                        bsl::ut_check(mut_rpt.is_stale(mut_pp0));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp1));
+
+                        mut_rpt.mark_flushed(mut_pp2, mut_rpt.generation());
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp2));
+                        mut_rpt.mark_flushed(mut_pp0, mut_rpt.generation());
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp0));
+
+                        bsl::ut_check(mut_rpt.protect_pages(
+                            mut_pp1, mut_page_pool, virt1, page, MAP_PAGE_READ));
+                        bsl::ut_check(mut_rpt.is_stale(mut_pp1));
+                        bsl::ut_check(mut_rpt.activate(mut_pp0, mut_intrinsic));
+                        bsl::ut_check(mut_rpt.activate(mut_pp1, mut_intrinsic));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp0));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp1));
+
+                        bsl::ut_check(!mut_rpt.unmap_page(mut_pp0, mut_page_pool, virt0, atrl));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp0));
+
+                        mut_rpt.release(mut_pp0, mut_page_pool);
+                        bsl::ut_check(mut_rpt.is_stale(mut_pp0));
+                        bsl::ut_check(mut_rpt.is_stale(mut_pp1));
+                        bsl::ut_check(!mut_rpt.is_stale(mut_pp2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"populate_pages uninitialized fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto byts{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.populate_pages(
+                        mut_tls, mut_page_pool, virt, phys, byts, flgs, true));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"populate_pages invalid arguments"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto byts{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ};
+                constexpr auto unaligned{0x1001_umax};
+                constexpr auto wx{MAP_PAGE_WRITE | MAP_PAGE_EXECUTE};
+                constexpr auto invalid{bsl::safe_uintmax::failure()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, {}, phys, byts, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, invalid, phys, byts, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, unaligned, phys, byts, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt, invalid, byts, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt, unaligned, byts, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt, phys, {}, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt, phys, unaligned, flgs, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt, phys, byts, {}, true));
+                        bsl::ut_check(!mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt, phys, byts, wx, true));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"populate_pages skips existing mappings"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x1000_umax};
+                constexpr auto virt1{0x2000_umax};
+                constexpr auto virt2{0x3000_umax};
+                constexpr auto phys{0x1000_umax};
+                constexpr auto byts{0x3000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt1, phys, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts, flgs, true));
+                        bsl::ut_check(mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts, flgs, true));
+                        bsl::ut_check(
+                            !mut_rpt.map_page(mut_tls, mut_page_pool, virt0, phys, flgs, atrl));
+                        bsl::ut_check(
+                            !mut_rpt.map_page(mut_tls, mut_page_pool, virt2, phys, flgs, atrl));
+                        bsl::ut_check(
+                            mut_rpt.unmap_pages(mut_tls, mut_page_pool, virt0, byts, atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"populate_pages large pages"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x200000_umax};
+                constexpr auto virt1{0x400000_umax};
+                constexpr auto phys{0x200000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto page{0x1000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts, flgs, true));
+                        bsl::ut_check(
+                            !mut_rpt.protect_pages(mut_tls, mut_page_pool, virt0, page, flgs));
+                        bsl::ut_check(
+                            mut_rpt.protect_pages(mut_tls, mut_page_pool, virt0, byts, flgs));
+                        bsl::ut_check(mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt1, phys, byts, flgs, false));
+                        bsl::ut_check(
+                            mut_rpt.protect_pages(mut_tls, mut_page_pool, virt1, page, flgs));
+                        bsl::ut_check(mut_rpt.populate_pages(
+                            mut_tls, mut_page_pool, virt0, phys, byts + byts, flgs, true));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim_pages uninitialized fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_umax};
+                constexpr auto byts{0x1000_umax};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.reclaim_pages(mut_tls, mut_page_pool, virt, byts));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim_pages only reclaims direct map pages"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x1000_umax};
+                constexpr auto virt1{0x200000_umax};
+                constexpr auto virt2{0x600000_umax};
+                constexpr auto phys{0x200000_umax};
+                constexpr auto byts0{0x2000_umax};
+                constexpr auto byts1{0x200000_umax};
+                constexpr auto byts2{0x3FF000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.populate_pages(
+                        mut_tls, mut_page_pool, virt0, phys, byts0, flgs, false));
+                    bsl::ut_required_step(
+                        mut_rpt.map_pages(mut_tls, mut_page_pool, virt1, phys, byts1, flgs, atrl));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.reclaim_pages(mut_tls, mut_page_pool, virt0, byts2));
+                        bsl::ut_check(
+                            mut_rpt.map_page(mut_tls, mut_page_pool, virt0, phys, flgs, atrl));
+                        bsl::ut_check(
+                            mut_rpt.protect_pages(mut_tls, mut_page_pool, virt1, byts1, flgs));
+                        bsl::ut_check(mut_rpt.reclaim_pages(mut_tls, mut_page_pool, virt2, byts0));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_mapped_with"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x1000_umax};
+                constexpr auto virt1{0x2000_umax};
+                constexpr auto virt2{0x200000_umax};
+                constexpr auto virt3{0x1001_umax};
+                constexpr auto phys{0x200000_umax};
+                constexpr auto byts{0x200000_umax};
+                constexpr auto flgs{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto atrl{MAP_PAGE_AUTO_RELEASE_ALLOC_PAGE};
+                constexpr auto none{MAP_PAGE_NO_AUTO_RELEASE};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_rpt.is_mapped_with(mut_tls, mut_page_pool, virt0, atrl));
+                };
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page(mut_tls, mut_page_pool, virt0, phys, flgs, atrl));
+                    bsl::ut_required_step(
+                        mut_rpt.map_pages(mut_tls, mut_page_pool, virt2, phys, byts, flgs, none));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.is_mapped_with(mut_tls, mut_page_pool, virt0, atrl));
+                        bsl::ut_check(!mut_rpt.is_mapped_with(mut_tls, mut_page_pool, virt0, none));
+                        bsl::ut_check(!mut_rpt.is_mapped_with(mut_tls, mut_page_pool, virt1, atrl));
+                        bsl::ut_check(!mut_rpt.is_mapped_with(mut_tls, mut_page_pool, virt2, none));
+                        bsl::ut_check(!mut_rpt.is_mapped_with(mut_tls, mut_page_pool, virt3, atrl));
+                        bsl::ut_check(!mut_rpt.is_mapped_with(
+                            mut_tls, mut_page_pool, bsl::safe_uintmax::failure(), atrl));
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump large pages"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                root_page_table_t mut_rpt{};
+                page_pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                constexpr auto virt0{0x40000000_umax};
+                constexpr auto virt1{0x80200000_umax};
+                constexpr auto phys{0x80000000_umax};
+                constexpr auto flgs0{MAP_PAGE_READ | MAP_PAGE_WRITE};
+                constexpr auto flgs1{MAP_PAGE_READ | MAP_PAGE_EXECUTE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page_1g(mut_tls, mut_page_pool, virt0, phys, flgs0));
+                    bsl::ut_required_step(
+                        mut_rpt.map_page_2m(mut_tls, mut_page_pool, virt1, phys, flgs1));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_rpt.dump(mut_page_pool);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_rpt.release(mut_tls, mut_page_pool);
+                        };
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"allocate_page_rw without initialize fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 root_page_table_t mut_rpt{};
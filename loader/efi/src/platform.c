@@ -33,6 +33,7 @@
 #include <efi/efi_system_table.h>
 #include <efi/efi_types.h>
 #include <g_mk_debug_ring.h>
+#include <merge_mk_debug_rings.h>
 #include <platform.h>
 #include <work_on_cpu_callback.h>
 
@@ -363,32 +364,38 @@ platform_on_each_cpu(platform_per_cpu_func const func, uint32_t const order)
     return ret;
 }
 
+/** @brief defines the size of the chunks used to dump the VMM */
+#define DUMP_VMM_CHUNK_SIZE ((uint64_t)0x100)
+
 /**
  * <!-- description -->
- *   @brief Dumps the contents of the VMM's ring buffer.
+ *   @brief Dumps the contents of the VMM's ring buffers, merging the
+ *     ring buffer of each PP in time order.
  */
 void
 platform_dump_vmm(void)
 {
-    uint64_t epos = g_mk_debug_ring->epos;
-    uint64_t spos = g_mk_debug_ring->spos;
+    uint64_t i;
+    uint64_t len;
+    uint64_t pos[HYPERVISOR_MAX_PPS];
+    char buf[DUMP_VMM_CHUNK_SIZE];
 
-    if (!(HYPERVISOR_DEBUG_RING_SIZE > epos)) {
-        epos = ((uint64_t)0);
+    for (i = ((uint64_t)0); i < HYPERVISOR_MAX_PPS; ++i) {
+        pos[i] = ((uint64_t)0);
     }
 
-    if (spos == epos) {
+    len = merge_mk_debug_rings(g_mk_debug_ring, pos, buf, DUMP_VMM_CHUNK_SIZE);
+    if (((uint64_t)0) == len) {
         console_write("no debug data to dump\r\n");
         return;
     }
 
-    while (spos != epos) {
-        if (!(HYPERVISOR_DEBUG_RING_SIZE > spos)) {
-            spos = ((uint64_t)0);
+    while (((uint64_t)0) != len) {
+        for (i = ((uint64_t)0); i < len; ++i) {
+            console_write_c(buf[i]);
         }
 
-        console_write_c(g_mk_debug_ring->buf[spos]);
-        ++spos;
+        len = merge_mk_debug_rings(g_mk_debug_ring, pos, buf, DUMP_VMM_CHUNK_SIZE);
     }
 
     console_write("\r\n");
@@ -40,6 +40,6 @@
  *   @param ioctl_args arguments from the ioctl
  *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
  */
-int64_t dump_vmm(struct dump_vmm_args_t const *const ioctl_args);
+int64_t dump_vmm(struct dump_vmm_args_t *const ioctl_args);
 
 #endif
@@ -27,9 +27,10 @@
 #ifndef G_DEBUG_RING_H
 #define G_DEBUG_RING_H
 
+#include <constants.h>
 #include <debug_ring_t.h>
 
-/** @brief stores the microkernel's debug ring */
-extern struct debug_ring_t *g_mk_debug_ring;
+/** @brief stores the microkernel's debug ring for each PP */
+extern struct debug_ring_t *g_mk_debug_ring[HYPERVISOR_MAX_PPS];
 
 #endif
@@ -32,11 +32,19 @@
 
 #pragma pack(push, 1)
 
+/** @brief defines the character that starts each record in a debug ring */
+#define DEBUG_RING_RECORD_START ((char)0x1E)
+/** @brief defines the number of hex digits that store a record's TSC */
+#define DEBUG_RING_TSC_DIGITS ((uint64_t)16)
+
 /**
  * @struct debug_ring_t
  *
  * <!-- description -->
- *   @brief Defines the structure of the microkernel's debug ring
+ *   @brief Defines the structure of the microkernel's debug ring. Each PP
+ *     is given its own debug ring, and each line written to a debug ring
+ *     starts with a DEBUG_RING_RECORD_START followed by the PP's TSC in
+ *     hex so that the debug rings can be merged in time order when dumped.
  */
 struct debug_ring_t
 {
@@ -27,6 +27,7 @@
 #ifndef DUMP_VMM_ARGS_T_H
 #define DUMP_VMM_ARGS_T_H
 
+#include <constants.h>
 #include <debug_ring_t.h>
 #include <stdint.h>
 
@@ -47,8 +48,12 @@ struct dump_vmm_args_t
     /** @brief set to HYPERVISOR_VERSION */
     uint64_t ver;
 
-    /** @brief stores the contents of the debug ring upon request */
-    struct debug_ring_t debug_ring;
+    /** @brief set to 0 on the first call, tracks each PP's debug ring */
+    uint64_t pos[HYPERVISOR_MAX_PPS];
+    /** @brief stores the number of chars the loader placed into buf */
+    uint64_t len;
+    /** @brief stores the next chunk of the merged debug rings */
+    char buf[HYPERVISOR_DEBUG_RING_SIZE];
 };
 
 #pragma pack(pop)
@@ -32,6 +32,7 @@
 #include <debug_ring_t.h>
 #include <mutable_span_t.h>
 #include <state_save_t.h>
+#include <trace_ring_t.h>
 #include <types.h>
 
 #pragma pack(push, 1)
@@ -59,6 +60,8 @@ struct mk_args_t
     struct state_save_t *root_vp_state;
     /** @brief stores the location of the debug ring (0x018) */
     struct debug_ring_t *debug_ring;
+    /** @brief stores the location of the trace ring (0x020) */
+    struct trace_ring_t *trace_ring;
     /** @brief stores the location of the microkernel's ELF file */
     struct bfelf_elf64_ehdr_t const *mk_elf_file;
     /** @brief stores the location of the extension's ELF files */
@@ -0,0 +1,107 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_RING_T_H
+#define TRACE_RING_T_H
+
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the size of a trace ring in bytes */
+#define TRACE_RING_SIZE ((uint64_t)0x10000)
+/** @brief defines the total number of records a trace ring can store */
+#define TRACE_RING_MAX_RECORDS ((uint64_t)0x7FF)
+
+/** @brief defines the trace event recorded when a VPS exits */
+#define TRACE_EVENT_VMEXIT ((uint64_t)0)
+/** @brief defines the trace event recorded before a VPS is run */
+#define TRACE_EVENT_VMENTRY ((uint64_t)1)
+/** @brief defines the trace event recorded when a syscall is made */
+#define TRACE_EVENT_SYSCALL_ENTRY ((uint64_t)2)
+/** @brief defines the trace event recorded when a syscall returns */
+#define TRACE_EVENT_SYSCALL_EXIT ((uint64_t)3)
+/** @brief defines the trace event recorded before an extension is called */
+#define TRACE_EVENT_EXT_CALL ((uint64_t)4)
+/** @brief defines the trace event recorded when an extension returns */
+#define TRACE_EVENT_EXT_RETURN ((uint64_t)5)
+/** @brief defines the trace event recorded when a page fault is handled */
+#define TRACE_EVENT_PAGE_FAULT ((uint64_t)6)
+/** @brief defines the trace event recorded when a lock had to be waited on */
+#define TRACE_EVENT_LOCK_CONTENTION ((uint64_t)7)
+/** @brief defines the total number of trace events */
+#define TRACE_EVENT_MAX ((uint64_t)8)
+
+/**
+ * @struct trace_record_t
+ *
+ * <!-- description -->
+ *   @brief Defines a single record in a trace ring. What data0 and data1
+ *     store depends on the event (e.g., the exit reason for a vmexit).
+ */
+struct trace_record_t
+{
+    /** @brief stores the TRACE_EVENT_xxx that was recorded */
+    uint16_t event;
+    /** @brief stores the VPSID that was active when the event occurred */
+    uint16_t vpsid;
+    /** @brief reserved */
+    uint32_t reserved;
+    /** @brief stores the PP's TSC when the event occurred */
+    uint64_t tsc;
+    /** @brief stores the first event specific payload */
+    uint64_t data0;
+    /** @brief stores the second event specific payload */
+    uint64_t data1;
+};
+
+/**
+ * @struct trace_ring_t
+ *
+ * <!-- description -->
+ *   @brief Defines the structure of the microkernel's trace ring. Each PP
+ *     is given its own trace ring, which the microkernel fills with
+ *     binary records for each event that is enabled in the mask. Once
+ *     the trace ring is full, the oldest records are overwritten.
+ */
+struct trace_ring_t
+{
+    /** @brief stores the index the next record will be written to */
+    uint64_t epos;
+    /** @brief stores the total number of records that were written */
+    uint64_t num;
+    /** @brief stores a bit (1 << TRACE_EVENT_xxx) for each enabled event */
+    uint64_t mask;
+    /** @brief reserved */
+    uint64_t reserved;
+
+    /** @brief stores the records in the trace ring */
+    struct trace_record_t records[TRACE_RING_MAX_RECORDS];
+};
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_VMM_ARGS_T_H
+#define TRACE_VMM_ARGS_T_H
+
+#include <stdint.h>
+#include <trace_ring_t.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the IOCTL index for tracing the VMM */
+#define LOADER_TRACE_VMM_CMD ((uint32_t)0xBF04)
+
+/** @brief tells the loader to copy a PP's trace ring into the ring field */
+#define TRACE_VMM_OP_READ ((uint64_t)0)
+/** @brief tells the loader to clear every trace ring and set their mask */
+#define TRACE_VMM_OP_START ((uint64_t)1)
+/** @brief tells the loader to stop tracing by clearing every mask */
+#define TRACE_VMM_OP_STOP ((uint64_t)2)
+
+/**
+ * @struct trace_vmm_args_t
+ *
+ * <!-- description -->
+ *   @brief Defines the information that a userspace application needs to
+ *     provide to trace the VMM.
+ */
+struct trace_vmm_args_t
+{
+    /** @brief set to HYPERVISOR_VERSION */
+    uint64_t ver;
+
+    /** @brief set to one of the TRACE_VMM_OP_xxx operations */
+    uint64_t op;
+    /** @brief TRACE_VMM_OP_START: the mask of events to enable */
+    uint64_t mask;
+    /** @brief TRACE_VMM_OP_READ: the PP whose trace ring to read */
+    uint64_t ppid;
+    /** @brief TRACE_VMM_OP_READ: stores a copy of the PP's trace ring */
+    struct trace_ring_t ring;
+};
+
+#pragma pack(pop)
+
+#endif
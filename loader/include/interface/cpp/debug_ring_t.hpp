@@ -35,10 +35,19 @@
 
 namespace loader
 {
+    /// @brief defines the character that starts each record in a debug ring
+    constexpr bsl::char_type DEBUG_RING_RECORD_START{'\x1E'};
+    /// @brief defines the number of hex digits that store a record's TSC
+    constexpr auto DEBUG_RING_TSC_DIGITS{16_umax};
+
     /// @struct loader::debug_ring_t
     ///
     /// <!-- description -->
-    ///   @brief Defines the structure of the microkernel's debug ring
+    ///   @brief Defines the structure of the microkernel's debug ring. Each
+    ///     PP is given its own debug ring, and each line written to a debug
+    ///     ring starts with a DEBUG_RING_RECORD_START followed by the PP's
+    ///     TSC in hex so that the debug rings can be merged in time order
+    ///     when dumped.
     ///
     struct debug_ring_t final
     {
@@ -25,8 +25,8 @@
 #ifndef DUMP_VMM_ARGS_T_HPP
 #define DUMP_VMM_ARGS_T_HPP
 
-#include <debug_ring_t.hpp>
-
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstdint.hpp>
 #include <bsl/safe_integral.hpp>
@@ -49,8 +49,12 @@ namespace loader
         /// @brief set to loader::version
         bsl::uint64 ver;
 
-        /// @brief stores the contents of the debug ring upon request
-        debug_ring_t debug_ring;
+        /// @brief set to 0 on the first call, tracks each PP's debug ring
+        bsl::array<bsl::uint64, HYPERVISOR_MAX_PPS.get()> pos;
+        /// @brief stores the number of chars the loader placed into buf
+        bsl::uint64 len;
+        /// @brief stores the next chunk of the merged debug rings
+        bsl::array<bsl::char_type, HYPERVISOR_DEBUG_RING_SIZE.get()> buf;
     };
 }
 
@@ -0,0 +1,113 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_RING_T_HPP
+#define TRACE_RING_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the size of a trace ring in bytes
+    constexpr auto TRACE_RING_SIZE{0x10000_umax};
+    /// @brief defines the total number of records a trace ring can store
+    constexpr auto TRACE_RING_MAX_RECORDS{0x7FF_umax};
+
+    /// @brief defines the trace event recorded when a VPS exits
+    constexpr auto TRACE_EVENT_VMEXIT{0_umax};
+    /// @brief defines the trace event recorded before a VPS is run
+    constexpr auto TRACE_EVENT_VMENTRY{1_umax};
+    /// @brief defines the trace event recorded when a syscall is made
+    constexpr auto TRACE_EVENT_SYSCALL_ENTRY{2_umax};
+    /// @brief defines the trace event recorded when a syscall returns
+    constexpr auto TRACE_EVENT_SYSCALL_EXIT{3_umax};
+    /// @brief defines the trace event recorded before an extension is called
+    constexpr auto TRACE_EVENT_EXT_CALL{4_umax};
+    /// @brief defines the trace event recorded when an extension returns
+    constexpr auto TRACE_EVENT_EXT_RETURN{5_umax};
+    /// @brief defines the trace event recorded when a page fault is handled
+    constexpr auto TRACE_EVENT_PAGE_FAULT{6_umax};
+    /// @brief defines the trace event recorded when a lock had to be waited on
+    constexpr auto TRACE_EVENT_LOCK_CONTENTION{7_umax};
+    /// @brief defines the total number of trace events
+    constexpr auto TRACE_EVENT_MAX{8_umax};
+
+    /// @struct loader::trace_record_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines a single record in a trace ring. What data0 and
+    ///     data1 store depends on the event (e.g., the exit reason for a
+    ///     vmexit).
+    ///
+    struct trace_record_t final
+    {
+        /// @brief stores the TRACE_EVENT_xxx that was recorded
+        bsl::uint16 event;
+        /// @brief stores the VPSID that was active when the event occurred
+        bsl::uint16 vpsid;
+        /// @brief reserved
+        bsl::uint32 reserved;
+        /// @brief stores the PP's TSC when the event occurred
+        bsl::uint64 tsc;
+        /// @brief stores the first event specific payload
+        bsl::uint64 data0;
+        /// @brief stores the second event specific payload
+        bsl::uint64 data1;
+    };
+
+    /// @struct loader::trace_ring_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the structure of the microkernel's trace ring. Each
+    ///     PP is given its own trace ring, which the microkernel fills with
+    ///     binary records for each event that is enabled in the mask. Once
+    ///     the trace ring is full, the oldest records are overwritten.
+    ///
+    struct trace_ring_t final
+    {
+        /// @brief stores the index the next record will be written to
+        bsl::uint64 epos;
+        /// @brief stores the total number of records that were written
+        bsl::uint64 num;
+        /// @brief stores a bit (1 << TRACE_EVENT_xxx) for each enabled event
+        bsl::uint64 mask;
+        /// @brief reserved
+        bsl::uint64 reserved;
+
+        /// @brief stores the records in the trace ring
+        bsl::array<trace_record_t, TRACE_RING_MAX_RECORDS.get()> records;
+    };
+
+    /// @brief make sure the trace_ring_t is the size of TRACE_RING_SIZE
+    static_assert(sizeof(trace_ring_t) == TRACE_RING_SIZE);
+}
+
+#pragma pack(pop)
+
+#endif
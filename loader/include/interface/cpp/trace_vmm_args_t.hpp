@@ -0,0 +1,72 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_VMM_ARGS_T_HPP
+#define TRACE_VMM_ARGS_T_HPP
+
+#include <trace_ring_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the IOCTL index for tracing the VMM
+    constexpr auto TRACE_VMM_CMD{0xBF04_u32};
+
+    /// @brief tells the loader to copy a PP's trace ring into the ring field
+    constexpr auto TRACE_VMM_OP_READ{0_umax};
+    /// @brief tells the loader to clear every trace ring and set their mask
+    constexpr auto TRACE_VMM_OP_START{1_umax};
+    /// @brief tells the loader to stop tracing by clearing every mask
+    constexpr auto TRACE_VMM_OP_STOP{2_umax};
+
+    /// @struct loader::trace_vmm_args_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the information that a userspace application needs to
+    ///     provide to trace the VMM.
+    ///
+    struct trace_vmm_args_t final
+    {
+        /// @brief set to loader::version
+        bsl::uint64 ver;
+
+        /// @brief set to one of the TRACE_VMM_OP_xxx operations
+        bsl::uint64 op;
+        /// @brief TRACE_VMM_OP_START: the mask of events to enable
+        bsl::uint64 mask;
+        /// @brief TRACE_VMM_OP_READ: the PP whose trace ring to read
+        bsl::uint64 ppid;
+        /// @brief TRACE_VMM_OP_READ: stores a copy of the PP's trace ring
+        trace_ring_t ring;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
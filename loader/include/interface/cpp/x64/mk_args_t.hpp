@@ -28,6 +28,7 @@
 #include <bfelf/elf64_ehdr_t.hpp>
 #include <page_pool_node_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -76,6 +77,8 @@ namespace loader
         state_save_t *root_vp_state;
         /// @brief stores the location of the debug ring (0x018)
         debug_ring_t *debug_ring;
+        /// @brief stores the location of the trace ring (0x020)
+        trace_ring_t *trace_ring;
         /// @brief reserved
         void const *reserved1;
         /// @brief stores the location of the extension's ELF files
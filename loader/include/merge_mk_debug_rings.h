@@ -0,0 +1,58 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MERGE_MK_DEBUG_RINGS_H
+#define MERGE_MK_DEBUG_RINGS_H
+
+#include <constants.h>
+#include <debug_ring_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Copies the next records from each PP's debug ring into the
+ *     provided buffer in time order (i.e., ordered by each record's TSC).
+ *     The provided positions must be set to 0 on the first call and are
+ *     updated on each call so that the merge can be continued until this
+ *     function returns 0. Records that do not fit into the provided buffer
+ *     are continued on the next call.
+ *
+ * <!-- inputs/outputs -->
+ *   @param debug_rings the HYPERVISOR_MAX_PPS debug rings to merge. Debug
+ *     rings that are NULL are ignored.
+ *   @param pos the HYPERVISOR_MAX_PPS positions into each debug ring
+ *   @param buf the buffer to place the merged debug rings into
+ *   @param size the total number of chars that buf can hold
+ *   @return Returns the number of chars placed into buf. Returns 0 once
+ *     all of the debug rings have been merged.
+ */
+uint64_t merge_mk_debug_rings(
+    struct debug_ring_t *const *const debug_rings,
+    uint64_t *const pos,
+    char *const buf,
+    uint64_t const size);
+
+#endif
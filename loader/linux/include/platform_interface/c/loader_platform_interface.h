@@ -33,6 +33,7 @@
 #include <linux/ioctl.h>
 #include <start_vmm_args_t.h>
 #include <stop_vmm_args_t.h>
+#include <trace_vmm_args_t.h>
 
 /* clang-format off */
 
@@ -47,5 +48,7 @@
 #define LOADER_STOP_VMM _IOW(0U, LOADER_STOP_VMM_CMD, struct stop_vmm_args_t *)
 /** @brief defines IOCTL for dumping a VMs debug ring */
 #define LOADER_DUMP_VMM _IOWR(0U, LOADER_DUMP_VMM_CMD, struct dump_vmm_args_t *)
+/** @brief defines IOCTL for controlling and reading a VMs trace rings */
+#define LOADER_TRACE_VMM _IOWR(0U, LOADER_TRACE_VMM_CMD, struct trace_vmm_args_t *)
 
 #endif
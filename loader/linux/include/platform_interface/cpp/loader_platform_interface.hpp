@@ -33,6 +33,7 @@
 #include <linux/ioctl.h>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <trace_vmm_args_t.hpp>
 
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
@@ -53,6 +54,9 @@ namespace loader
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr bsl::safe_uintmax DUMP_VMM{static_cast<bsl::uintmax>(
         _IOWR(0U, DUMP_VMM_CMD.get(), dump_vmm_args_t *))};
+    /// @brief defines IOCTL for controlling and reading a VMs trace rings
+    constexpr bsl::safe_uintmax TRACE_VMM{static_cast<bsl::uintmax>(
+        _IOWR(0U, TRACE_VMM_CMD.get(), trace_vmm_args_t *))};
 }
 
 #endif
@@ -44,6 +44,8 @@
 #include <start_vmm_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
+#include <trace_vmm.h>
+#include <trace_vmm_args_t.h>
 #include <types.h>
 
 int64_t
@@ -164,6 +166,50 @@ platform_copy_from_user_failed:
     return -EPERM;
 }
 
+static long
+handle_trace_vmm(void *const ioctl_args)
+{
+    int64_t ret;
+    struct trace_vmm_args_t *args;
+
+    args = (struct trace_vmm_args_t *)platform_alloc(
+        sizeof(struct trace_vmm_args_t));
+    if (((void *)0) == args) {
+        bferror("platform_alloc failed");
+        return LOADER_FAILURE;
+    }
+
+    ret = platform_copy_from_user(
+        args, ioctl_args, sizeof(struct trace_vmm_args_t));
+    if (ret) {
+        bferror("platform_copy_from_user failed");
+        goto platform_copy_from_user_failed;
+    }
+
+    ret = trace_vmm(args);
+    if (ret) {
+        bferror("trace_vmm failed");
+        goto trace_vmm_failed;
+    }
+
+    ret = platform_copy_to_user(
+        ioctl_args, args, sizeof(struct trace_vmm_args_t));
+    if (ret) {
+        bferror("platform_copy_to_user failed");
+        goto platform_copy_to_user_failed;
+    }
+
+    platform_free(args, sizeof(struct trace_vmm_args_t));
+    return 0;
+
+platform_copy_to_user_failed:
+trace_vmm_failed:
+platform_copy_from_user_failed:
+
+    platform_free(args, sizeof(struct trace_vmm_args_t));
+    return -EPERM;
+}
+
 static long
 dev_unlocked_ioctl(
     struct file *file, unsigned int cmd, unsigned long ioctl_args)
@@ -178,6 +224,9 @@ dev_unlocked_ioctl(
         case LOADER_DUMP_VMM: {
             return handle_dump_vmm((void *)ioctl_args);
         }
+        case LOADER_TRACE_VMM: {
+            return handle_trace_vmm((void *)ioctl_args);
+        }
         default: {
             bferror_x64("invalid ioctl cmd", cmd);
             return -EINVAL;
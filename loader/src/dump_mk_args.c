@@ -51,6 +51,7 @@ dump_mk_args(struct mk_args_t *const args, uint32_t const cpu)
     bfdebug_ptr(" - mk_state", args->mk_state);
     bfdebug_ptr(" - root_vp_state", args->root_vp_state);
     bfdebug_ptr(" - debug_ring", args->debug_ring);
+    bfdebug_ptr(" - trace_ring", args->trace_ring);
     bfdebug_ptr(" - mk_elf_file", args->mk_elf_file);
 
     for (i = ((uint64_t)0); i < HYPERVISOR_MAX_EXTENSIONS; ++i) {
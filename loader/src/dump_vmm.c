@@ -28,6 +28,7 @@
 #include <debug.h>
 #include <dump_vmm_args_t.h>
 #include <g_mk_debug_ring.h>
+#include <merge_mk_debug_rings.h>
 #include <platform.h>
 #include <types.h>
 
@@ -63,8 +64,6 @@ verify_dump_vmm_args(struct dump_vmm_args_t const *const args)
 int64_t
 dump_vmm(struct dump_vmm_args_t *const args)
 {
-    int64_t ret;
-
     if (((void *)0) == args) {
         bferror("args was NULL");
         return LOADER_FAILURE;
@@ -75,11 +74,11 @@ dump_vmm(struct dump_vmm_args_t *const args)
         return LOADER_FAILURE;
     }
 
-    ret = platform_memcpy(&args->debug_ring, g_mk_debug_ring, sizeof(struct debug_ring_t));
-    if (ret) {
-        bferror("platform_memcpy failed");
-        return LOADER_FAILURE;
-    }
+    args->len = merge_mk_debug_rings(    // --
+        g_mk_debug_ring,                 // --
+        args->pos,                       // --
+        args->buf,                       // --
+        HYPERVISOR_DEBUG_RING_SIZE);
 
     return LOADER_SUCCESS;
 }
@@ -24,7 +24,8 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <debug_ring_t.h>
 
-/** @brief stores the microkernel's debug ring */
-struct debug_ring_t *g_mk_debug_ring = ((void *)0);
+/** @brief stores the microkernel's debug ring for each PP */
+struct debug_ring_t *g_mk_debug_ring[HYPERVISOR_MAX_PPS];
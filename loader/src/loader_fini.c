@@ -24,11 +24,14 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <debug.h>
 #include <free_mk_code_aliases.h>
 #include <free_mk_debug_ring.h>
+#include <free_mk_trace_ring.h>
 #include <g_mk_code_aliases.h>
 #include <g_mk_debug_ring.h>
+#include <g_mk_trace_ring.h>
 #include <g_vmm_status.h>
 #include <platform.h>
 #include <types.h>
@@ -46,13 +49,18 @@
 int64_t
 loader_fini(void)
 {
+    uint64_t cpu;
+
     if (VMM_STATUS_CORRUPT == g_vmm_status) {
         bferror("Unable to fini, a VMM failed to properly stop");
         return LOADER_FAILURE;
     }
 
     free_mk_code_aliases(&g_mk_code_aliases);
-    free_mk_debug_ring(&g_mk_debug_ring);
+    for (cpu = ((uint64_t)0); cpu < HYPERVISOR_MAX_PPS; ++cpu) {
+        free_mk_trace_ring(&g_mk_trace_ring[cpu]);
+        free_mk_debug_ring(&g_mk_debug_ring[cpu]);
+    }
 
     return LOADER_SUCCESS;
 }
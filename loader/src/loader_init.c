@@ -26,13 +26,17 @@
 
 #include <alloc_and_copy_mk_code_aliases.h>
 #include <alloc_mk_debug_ring.h>
+#include <alloc_mk_trace_ring.h>
+#include <constants.h>
 #include <debug.h>
 #include <dump_mk_code_aliases.h>
 #include <dump_mk_debug_ring.h>
 #include <free_mk_code_aliases.h>
 #include <free_mk_debug_ring.h>
+#include <free_mk_trace_ring.h>
 #include <g_mk_code_aliases.h>
 #include <g_mk_debug_ring.h>
+#include <g_mk_trace_ring.h>
 #include <g_vmm_status.h>
 #include <platform.h>
 #include <types.h>
@@ -50,14 +54,38 @@
 int64_t
 loader_init(void)
 {
+    uint64_t cpu;
+    uint64_t num_cpus;
+
     if (VMM_STATUS_CORRUPT == g_vmm_status) {
         bferror("Unable to init, previous VMM failed to properly stop");
         return LOADER_FAILURE;
     }
 
-    if (alloc_mk_debug_ring(&g_mk_debug_ring)) {
-        bferror("alloc_mk_debug_ring failed");
-        goto alloc_mk_debug_ring_failed;
+    /**
+     * NOTE:
+     * - Each PP is given its own debug ring so that PPs never contend
+     *   with each other when logging. The debug rings are allocated here
+     *   and not when the VMM is started so that they can still be dumped
+     *   once the VMM is stopped (or fails to start). The same is true of
+     *   the trace rings, which vmmctl reads after the VMM is stopped.
+     */
+
+    num_cpus = (uint64_t)platform_num_online_cpus();
+    if (num_cpus > HYPERVISOR_MAX_PPS) {
+        num_cpus = HYPERVISOR_MAX_PPS;
+    }
+
+    for (cpu = ((uint64_t)0); cpu < num_cpus; ++cpu) {
+        if (alloc_mk_debug_ring(&g_mk_debug_ring[cpu])) {
+            bferror("alloc_mk_debug_ring failed");
+            goto alloc_mk_debug_ring_failed;
+        }
+
+        if (alloc_mk_trace_ring(&g_mk_trace_ring[cpu])) {
+            bferror("alloc_mk_trace_ring failed");
+            goto alloc_mk_trace_ring_failed;
+        }
     }
 
     if (alloc_and_copy_mk_code_aliases(&g_mk_code_aliases)) {
@@ -66,15 +94,23 @@ loader_init(void)
     }
 
 #ifdef DEBUG_LOADER
-    dump_mk_debug_ring(g_mk_debug_ring);
+    for (cpu = ((uint64_t)0); cpu < num_cpus; ++cpu) {
+        dump_mk_debug_ring(g_mk_debug_ring[cpu]);
+    }
+
     dump_mk_code_aliases(&g_mk_code_aliases);
 #endif
 
     return LOADER_SUCCESS;
 
 alloc_and_copy_mk_code_aliases_failed:
-    free_mk_debug_ring(&g_mk_debug_ring);
+alloc_mk_trace_ring_failed:
 alloc_mk_debug_ring_failed:
 
+    for (cpu = ((uint64_t)0); cpu < num_cpus; ++cpu) {
+        free_mk_trace_ring(&g_mk_trace_ring[cpu]);
+        free_mk_debug_ring(&g_mk_debug_ring[cpu]);
+    }
+
     return LOADER_FAILURE;
 }
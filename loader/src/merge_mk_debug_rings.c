@@ -0,0 +1,228 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.h>
+#include <debug_ring_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Returns the start position of the provided debug ring.
+ *
+ * <!-- inputs/outputs -->
+ *   @param debug_ring the debug ring to query
+ *   @return Returns the start position of the provided debug ring.
+ */
+static uint64_t
+debug_ring_spos(struct debug_ring_t const *const debug_ring)
+{
+    uint64_t const spos = debug_ring->spos;
+
+    if (!(HYPERVISOR_DEBUG_RING_SIZE > spos)) {
+        return ((uint64_t)0);
+    }
+
+    return spos;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the number of chars stored in the provided debug ring.
+ *
+ * <!-- inputs/outputs -->
+ *   @param debug_ring the debug ring to query
+ *   @return Returns the number of chars stored in the provided debug ring.
+ */
+static uint64_t
+debug_ring_len(struct debug_ring_t const *const debug_ring)
+{
+    uint64_t epos = debug_ring->epos;
+    uint64_t const spos = debug_ring_spos(debug_ring);
+
+    if (!(HYPERVISOR_DEBUG_RING_SIZE > epos)) {
+        epos = ((uint64_t)0);
+    }
+
+    if (epos < spos) {
+        return (HYPERVISOR_DEBUG_RING_SIZE - spos) + epos;
+    }
+
+    return epos - spos;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the char located pos chars from the start of the
+ *     provided debug ring.
+ *
+ * <!-- inputs/outputs -->
+ *   @param debug_ring the debug ring to read from
+ *   @param pos the number of chars from the start of the debug ring
+ *   @return Returns the char located pos chars from the start of the
+ *     provided debug ring.
+ */
+static char
+debug_ring_at(struct debug_ring_t const *const debug_ring, uint64_t const pos)
+{
+    uint64_t idx = debug_ring_spos(debug_ring) + pos;
+
+    if (!(HYPERVISOR_DEBUG_RING_SIZE > idx)) {
+        idx -= HYPERVISOR_DEBUG_RING_SIZE;
+    }
+
+    return debug_ring->buf[idx];
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the TSC of the record located at pos in the provided
+ *     debug ring. On the first call (i.e., pos is 0), the oldest record
+ *     might have been partially overwritten, so it is skipped. If pos is
+ *     in the middle of a record, a TSC of 0 is returned so that the rest
+ *     of the record is continued before any other record.
+ *
+ * <!-- inputs/outputs -->
+ *   @param debug_ring the debug ring to read from
+ *   @param pos the position of the record in the debug ring
+ *   @param tsc where to return the TSC of the record
+ *   @return Returns LOADER_SUCCESS if a record is located at pos,
+ *     otherwise returns LOADER_FAILURE.
+ */
+static int64_t
+debug_ring_peek(
+    struct debug_ring_t const *const debug_ring, uint64_t *const pos, uint64_t *const tsc)
+{
+    uint64_t i;
+    char c;
+    uint64_t const len = debug_ring_len(debug_ring);
+
+    if (((uint64_t)0) == *pos) {
+        while (*pos < len && DEBUG_RING_RECORD_START != debug_ring_at(debug_ring, *pos)) {
+            ++(*pos);
+        }
+    }
+
+    if (!(*pos < len)) {
+        return LOADER_FAILURE;
+    }
+
+    *tsc = ((uint64_t)0);
+    if (DEBUG_RING_RECORD_START != debug_ring_at(debug_ring, *pos)) {
+        return LOADER_SUCCESS;
+    }
+
+    if (!((len - *pos) > DEBUG_RING_TSC_DIGITS)) {
+        return LOADER_FAILURE;
+    }
+
+    for (i = ((uint64_t)1); i <= DEBUG_RING_TSC_DIGITS; ++i) {
+        c = debug_ring_at(debug_ring, *pos + i);
+        if (c >= 'a') {
+            *tsc = (*tsc << ((uint64_t)4)) | ((uint64_t)(c - 'a') + ((uint64_t)10));
+        }
+        else {
+            *tsc = (*tsc << ((uint64_t)4)) | ((uint64_t)(c - '0'));
+        }
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Copies the next records from each PP's debug ring into the
+ *     provided buffer in time order (i.e., ordered by each record's TSC).
+ *     The provided positions must be set to 0 on the first call and are
+ *     updated on each call so that the merge can be continued until this
+ *     function returns 0. Records that do not fit into the provided buffer
+ *     are continued on the next call.
+ *
+ * <!-- inputs/outputs -->
+ *   @param debug_rings the HYPERVISOR_MAX_PPS debug rings to merge. Debug
+ *     rings that are NULL are ignored.
+ *   @param pos the HYPERVISOR_MAX_PPS positions into each debug ring
+ *   @param buf the buffer to place the merged debug rings into
+ *   @param size the total number of chars that buf can hold
+ *   @return Returns the number of chars placed into buf. Returns 0 once
+ *     all of the debug rings have been merged.
+ */
+uint64_t
+merge_mk_debug_rings(
+    struct debug_ring_t *const *const debug_rings,
+    uint64_t *const pos,
+    char *const buf,
+    uint64_t const size)
+{
+    uint64_t cpu;
+    uint64_t tsc;
+    uint64_t len;
+    uint64_t next_cpu;
+    uint64_t next_tsc;
+    char c;
+    uint64_t num = ((uint64_t)0);
+
+    while (num < size) {
+        next_cpu = HYPERVISOR_MAX_PPS;
+        next_tsc = ((uint64_t)0);
+
+        for (cpu = ((uint64_t)0); cpu < HYPERVISOR_MAX_PPS; ++cpu) {
+            if (((void *)0) == debug_rings[cpu]) {
+                continue;
+            }
+
+            if (debug_ring_peek(debug_rings[cpu], &pos[cpu], &tsc)) {
+                continue;
+            }
+
+            if (HYPERVISOR_MAX_PPS == next_cpu || tsc < next_tsc) {
+                next_cpu = cpu;
+                next_tsc = tsc;
+            }
+        }
+
+        if (HYPERVISOR_MAX_PPS == next_cpu) {
+            break;
+        }
+
+        len = debug_ring_len(debug_rings[next_cpu]);
+        if (DEBUG_RING_RECORD_START == debug_ring_at(debug_rings[next_cpu], pos[next_cpu])) {
+            pos[next_cpu] += DEBUG_RING_TSC_DIGITS + ((uint64_t)1);
+        }
+
+        while (pos[next_cpu] < len && num < size) {
+            c = debug_ring_at(debug_rings[next_cpu], pos[next_cpu]);
+            if (DEBUG_RING_RECORD_START == c) {
+                break;
+            }
+
+            buf[num] = c;
+            ++pos[next_cpu];
+            ++num;
+        }
+    }
+
+    return num;
+}
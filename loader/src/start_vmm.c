@@ -53,6 +53,7 @@
 #include <g_mk_huge_pool.h>
 #include <g_mk_page_pool.h>
 #include <g_mk_root_page_table.h>
+#include <g_mk_trace_ring.h>
 #include <g_vmm_status.h>
 #include <map_ext_elf_files.h>
 #include <map_mk_code_aliases.h>
@@ -61,6 +62,7 @@
 #include <map_mk_elf_segments.h>
 #include <map_mk_huge_pool.h>
 #include <map_mk_page_pool.h>
+#include <map_mk_trace_ring.h>
 #include <platform.h>
 #include <start_vmm_args_t.h>
 #include <start_vmm_per_cpu.h>
@@ -71,6 +73,8 @@
 static int64_t
 alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
 {
+    uint64_t cpu;
+
     if (VMM_STATUS_RUNNING == g_vmm_status) {
         stop_and_free_the_vmm();
     }
@@ -80,8 +84,23 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
         return LOADER_FAILURE;
     }
 
-    g_mk_debug_ring->epos = ((uint64_t)0);
-    g_mk_debug_ring->spos = ((uint64_t)0);
+    for (cpu = ((uint64_t)0); cpu < HYPERVISOR_MAX_PPS; ++cpu) {
+        if (((void *)0) != g_mk_debug_ring[cpu]) {
+            g_mk_debug_ring[cpu]->epos = ((uint64_t)0);
+            g_mk_debug_ring[cpu]->spos = ((uint64_t)0);
+        }
+
+        /**
+         * NOTE:
+         * - The trace mask is left alone so that tracing can be started
+         *   before the VMM is, which allows the VMM's start to be traced.
+         */
+
+        if (((void *)0) != g_mk_trace_ring[cpu]) {
+            g_mk_trace_ring[cpu]->epos = ((uint64_t)0);
+            g_mk_trace_ring[cpu]->num = ((uint64_t)0);
+        }
+    }
 
     if (alloc_mk_root_page_table(&g_mk_root_page_table)) {
         bferror("alloc_and_copy_mk_root_page_table failed");
@@ -113,9 +132,26 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
         goto alloc_mk_huge_pool_failed;
     }
 
-    if (map_mk_debug_ring(g_mk_debug_ring, g_mk_root_page_table)) {
-        bferror("map_mk_debug_ring failed");
-        goto map_mk_debug_ring_failed;
+    for (cpu = ((uint64_t)0); cpu < HYPERVISOR_MAX_PPS; ++cpu) {
+        if (((void *)0) == g_mk_debug_ring[cpu]) {
+            continue;
+        }
+
+        if (map_mk_debug_ring(g_mk_debug_ring[cpu], g_mk_root_page_table)) {
+            bferror("map_mk_debug_ring failed");
+            goto map_mk_debug_ring_failed;
+        }
+    }
+
+    for (cpu = ((uint64_t)0); cpu < HYPERVISOR_MAX_PPS; ++cpu) {
+        if (((void *)0) == g_mk_trace_ring[cpu]) {
+            continue;
+        }
+
+        if (map_mk_trace_ring(g_mk_trace_ring[cpu], g_mk_root_page_table)) {
+            bferror("map_mk_trace_ring failed");
+            goto map_mk_trace_ring_failed;
+        }
     }
 
     if (map_mk_code_aliases(&g_mk_code_aliases, g_mk_root_page_table)) {
@@ -176,6 +212,7 @@ map_mk_elf_segments_failed:
 map_ext_elf_files_failed:
 map_mk_elf_file_failed:
 map_mk_code_aliases_failed:
+map_mk_trace_ring_failed:
 map_mk_debug_ring_failed:
 
     free_mk_huge_pool(&g_mk_huge_pool);
@@ -50,6 +50,7 @@
 #include <g_mk_root_page_table.h>
 #include <g_mk_stack.h>
 #include <g_mk_state.h>
+#include <g_mk_trace_ring.h>
 #include <g_root_vp_state.h>
 #include <get_mk_huge_pool_addr.h>
 #include <get_mk_page_pool_addr.h>
@@ -104,6 +105,11 @@ start_vmm_per_cpu(uint32_t const cpu)
         return LOADER_FAILURE;
     }
 
+    if (((void *)0) == g_mk_debug_ring[cpu] || ((void *)0) == g_mk_trace_ring[cpu]) {
+        bferror("cpu was not online when the loader was initialized");
+        return LOADER_FAILURE;
+    }
+
     if (alloc_mk_stack(0U, &g_mk_stack[cpu])) {
         bferror("alloc_mk_stack failed");
         goto alloc_mk_stack_failed;
@@ -169,7 +175,8 @@ start_vmm_per_cpu(uint32_t const cpu)
 
     g_mk_args[cpu]->mk_state = g_mk_state[cpu];
     g_mk_args[cpu]->root_vp_state = g_root_vp_state[cpu];
-    g_mk_args[cpu]->debug_ring = g_mk_debug_ring;
+    g_mk_args[cpu]->debug_ring = g_mk_debug_ring[cpu];
+    g_mk_args[cpu]->trace_ring = g_mk_trace_ring[cpu];
 
     g_mk_args[cpu]->mk_elf_file = g_mk_elf_file.addr;
     for (i = ((uint64_t)0); i < HYPERVISOR_MAX_EXTENSIONS; ++i) {
@@ -0,0 +1,145 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.h>
+#include <debug.h>
+#include <g_mk_trace_ring.h>
+#include <platform.h>
+#include <trace_ring_t.h>
+#include <trace_vmm_args_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Verifies that the arguments from the IOCTL are valid.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to verify
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+static int64_t
+verify_trace_vmm_args(struct trace_vmm_args_t const *const args)
+{
+    if (((uint64_t)1) != args->ver) {
+        bferror("IOCTL ABI version not supported");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Copies the trace ring of the requested PP into the IOCTL's
+ *     arguments. If the PP does not have a trace ring, an empty trace
+ *     ring is returned instead so that userspace can simply loop over
+ *     all of the possible PPs.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to store the trace ring in
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+static int64_t
+read_trace_ring(struct trace_vmm_args_t *const args)
+{
+    args->ring.epos = ((uint64_t)0);
+    args->ring.num = ((uint64_t)0);
+    args->ring.mask = ((uint64_t)0);
+
+    if (args->ppid >= HYPERVISOR_MAX_PPS) {
+        return LOADER_SUCCESS;
+    }
+
+    if (((void *)0) == g_mk_trace_ring[args->ppid]) {
+        return LOADER_SUCCESS;
+    }
+
+    if (platform_memcpy(&args->ring, g_mk_trace_ring[args->ppid], TRACE_RING_SIZE)) {
+        bferror("platform_memcpy failed");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function contains all of the code that is common between
+ *     all archiectures and all platforms for tracing the VMM. This function
+ *     will call platform and architecture specific functions as needed.
+ *
+ * <!-- notes -->
+ *   @note The trace rings are written by the microkernel without a lock,
+ *     which means that a trace ring that is read while tracing is still
+ *     running might contain a record that is only partially written.
+ *     Stop tracing before reading the trace rings to avoid this.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args arguments from the ioctl
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+int64_t
+trace_vmm(struct trace_vmm_args_t *const args)
+{
+    uint64_t cpu;
+
+    if (((void *)0) == args) {
+        bferror("args was NULL");
+        return LOADER_FAILURE;
+    }
+
+    if (verify_trace_vmm_args(args)) {
+        bferror("verify_trace_vmm_args failed");
+        return LOADER_FAILURE;
+    }
+
+    if (TRACE_VMM_OP_READ == args->op) {
+        return read_trace_ring(args);
+    }
+
+    if (TRACE_VMM_OP_START != args->op && TRACE_VMM_OP_STOP != args->op) {
+        bferror("unknown trace op");
+        return LOADER_FAILURE;
+    }
+
+    for (cpu = ((uint64_t)0); cpu < HYPERVISOR_MAX_PPS; ++cpu) {
+        if (((void *)0) == g_mk_trace_ring[cpu]) {
+            continue;
+        }
+
+        if (TRACE_VMM_OP_START == args->op) {
+            g_mk_trace_ring[cpu]->mask = ((uint64_t)0);
+            g_mk_trace_ring[cpu]->epos = ((uint64_t)0);
+            g_mk_trace_ring[cpu]->num = ((uint64_t)0);
+            g_mk_trace_ring[cpu]->mask = args->mask;
+        }
+        else {
+            g_mk_trace_ring[cpu]->mask = ((uint64_t)0);
+        }
+    }
+
+    return LOADER_SUCCESS;
+}
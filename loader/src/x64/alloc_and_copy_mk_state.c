@@ -34,6 +34,7 @@
 #include <esr_gpf.h>
 #include <esr_nmi.h>
 #include <esr_pf.h>
+#include <intrinsic_cpuid.h>
 #include <intrinsic_rdmsr.h>
 #include <intrinsic_scr0.h>
 #include <intrinsic_scr4.h>
@@ -56,12 +57,26 @@
 /** @brief defines the default value of CR4 */
 #define DEFAULT_CR4 ((uint64_t)0x003000E0)
 
-/** @brief defines the default value of CR0 bits that must be off */
-#define DEFAULT_CR0_OFF ((uint64_t)0xFFFFFFFFFFFFFFFF)
+/** @brief defines the default value of CR0 bits that must be off (TS, see fpu_t) */
+#define DEFAULT_CR0_OFF ((uint64_t)0xFFFFFFFFFFFFFFF7)
 /** @brief defines the default value of CR4 bits that must be off */
 // #define DEFAULT_CR4_OFF ((uint64_t)0xFFFFFFFFFF9FFFFF)
 #define DEFAULT_CR4_OFF ((uint64_t)0xFFFFFFFFFFFFFFFF)
 
+/** @brief defines the PCIDE CR4 field */
+#define CR4_PCIDE (((uint64_t)1) << ((uint64_t)17))
+
+/** @brief defines the CPUID leaf for the max supported leaf */
+#define CPUID_LEAF_MAX ((uint32_t)0x0)
+/** @brief defines the CPUID leaf for feature information */
+#define CPUID_LEAF_FEATURE ((uint32_t)0x1)
+/** @brief define the CPUID feature bit for PCID */
+#define CPUID_FEATURE_ECX_PCID (((uint32_t)1) << ((uint32_t)17))
+/** @brief defines the CPUID leaf for extended feature information */
+#define CPUID_LEAF_EXT_FEATURE ((uint32_t)0x7)
+/** @brief define the CPUID extended feature bit for INVPCID */
+#define CPUID_EXT_FEATURE_EBX_INVPCID (((uint32_t)1) << ((uint32_t)10))
+
 /** @brief defines the MSR_IA32_EFER MSR */
 #define MSR_IA32_EFER ((uint32_t)0xC0000080)
 /** @brief defines the default value of EFER */
@@ -167,6 +182,51 @@
 /** @brief defines the FMASK MSR used by the microkernel */
 #define MK_MSR_IA32_FMASK ((uint64_t)0xFFFFFFFFFFFBFFFD)
 
+/**
+ * <!-- description -->
+ *   @brief Returns 1 if the CPU supports both PCID and INVPCID. The
+ *     microkernel only uses PCIDs if it can also use INVPCID to flush
+ *     the TLB entries of a specific PCID, otherwise this returns 0.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns 1 if the CPU supports both PCID and INVPCID, 0
+ *     otherwise.
+ */
+static inline int64_t
+pcid_supported(void)
+{
+    uint32_t eax;
+    uint32_t ebx;
+    uint32_t ecx;
+    uint32_t edx;
+
+    eax = CPUID_LEAF_MAX;
+    ecx = 0U;
+    intrinsic_cpuid(&eax, &ebx, &ecx, &edx);
+
+    if (eax < CPUID_LEAF_EXT_FEATURE) {
+        return 0;
+    }
+
+    eax = CPUID_LEAF_FEATURE;
+    ecx = 0U;
+    intrinsic_cpuid(&eax, &ebx, &ecx, &edx);
+
+    if (((uint32_t)0) == (ecx & CPUID_FEATURE_ECX_PCID)) {
+        return 0;
+    }
+
+    eax = CPUID_LEAF_EXT_FEATURE;
+    ecx = 0U;
+    intrinsic_cpuid(&eax, &ebx, &ecx, &edx);
+
+    if (((uint32_t)0) == (ebx & CPUID_EXT_FEATURE_EBX_INVPCID)) {
+        return 0;
+    }
+
+    return 1;
+}
+
 /**
  * <!-- description -->
  *   @brief The function's main purpose is to set up the state for the
@@ -646,6 +706,13 @@ alloc_and_copy_mk_state(
     (*state)->cr3 = platform_virt_to_phys(rpt);
     (*state)->cr4 = (intrinsic_scr4() | DEFAULT_CR4) & DEFAULT_CR4_OFF;
 
+    if (pcid_supported()) {
+        (*state)->cr4 |= CR4_PCIDE;
+    }
+    else {
+        (*state)->cr4 &= ~CR4_PCIDE;
+    }
+
     if (((uint64_t)0) == (*state)->cr3) {
         bferror("platform_virt_to_phys failed");
         goto platform_virt_to_phys_cr3_failed;
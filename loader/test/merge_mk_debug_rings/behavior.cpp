@@ -0,0 +1,230 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+extern "C"
+{
+#include "../../include/merge_mk_debug_rings.h"
+}
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief stores the debug ring of PP 0
+    constinit debug_ring_t g_mut_ring0{};
+    /// @brief stores the debug ring of PP 2
+    constinit debug_ring_t g_mut_ring2{};
+    /// @brief stores the debug rings given to merge_mk_debug_rings
+    constinit debug_ring_t *g_pmut_mut_rings[HYPERVISOR_MAX_PPS]{};
+    /// @brief stores the positions given to merge_mk_debug_rings
+    constinit bsl::uint64 g_mut_pos[HYPERVISOR_MAX_PPS]{};
+    /// @brief stores the merged output of merge_mk_debug_rings
+    constinit char g_mut_buf[HYPERVISOR_DEBUG_RING_SIZE]{};
+
+    /// <!-- description -->
+    ///   @brief Writes a char to a debug ring the same way the microkernel
+    ///     does, overwriting the oldest char once the debug ring is full.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_ring the debug ring to write to
+    ///   @param c the char to write
+    ///
+    void
+    write_c(debug_ring_t *const pmut_ring, char const c) noexcept
+    {
+        pmut_ring->buf[pmut_ring->epos] = c;
+        pmut_ring->epos = (pmut_ring->epos + 1U) % HYPERVISOR_DEBUG_RING_SIZE;
+
+        if (pmut_ring->epos == pmut_ring->spos) {
+            pmut_ring->spos = (pmut_ring->spos + 1U) % HYPERVISOR_DEBUG_RING_SIZE;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes a record (i.e., a TSC tagged line) to a debug ring
+    ///     the same way the microkernel does.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_ring the debug ring to write to
+    ///   @param tsc the TSC to tag the record with
+    ///   @param str the line to write
+    ///
+    void
+    write_record(
+        debug_ring_t *const pmut_ring, bsl::uint64 const tsc, bsl::cstr_type const str) noexcept
+    {
+        constexpr bsl::uint64 bits_per_digit{4U};
+        constexpr bsl::uint64 digit_mask{0xFU};
+        bsl::cstr_type const digits{"0123456789abcdef"};
+
+        write_c(pmut_ring, DEBUG_RING_RECORD_START);
+        for (bsl::uint64 mut_i{DEBUG_RING_TSC_DIGITS}; mut_i > 0U; --mut_i) {
+            write_c(pmut_ring, digits[(tsc >> ((mut_i - 1U) * bits_per_digit)) & digit_mask]);
+        }
+
+        for (bsl::uint64 mut_i{}; '\0' != str[mut_i]; ++mut_i) {
+            write_c(pmut_ring, str[mut_i]);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Resets the debug rings and positions used by the tests.
+    ///
+    void
+    reset() noexcept
+    {
+        g_mut_ring0 = {};
+        g_mut_ring2 = {};
+
+        for (bsl::uint64 mut_i{}; mut_i < HYPERVISOR_MAX_PPS; ++mut_i) {
+            g_pmut_mut_rings[mut_i] = nullptr;
+            g_mut_pos[mut_i] = {};
+        }
+
+        g_pmut_mut_rings[0] = &g_mut_ring0;
+        g_pmut_mut_rings[2] = &g_mut_ring2;
+    }
+
+    /// <!-- description -->
+    ///   @brief Merges the debug rings used by the tests.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of chars to merge
+    ///   @return Returns the merged chars as a bsl::string_view
+    ///
+    [[nodiscard]] auto
+    merge(bsl::uint64 const size) noexcept -> bsl::string_view
+    {
+        auto const len{merge_mk_debug_rings(g_pmut_mut_rings, g_mut_pos, g_mut_buf, size)};
+        return bsl::string_view{g_mut_buf, bsl::to_umax(len)};
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"empty debug rings"} = []() {
+            bsl::ut_given{} = []() {
+                reset();
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(merge(HYPERVISOR_DEBUG_RING_SIZE).empty());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"no debug rings"} = []() {
+            bsl::ut_given{} = []() {
+                reset();
+                g_pmut_mut_rings[0] = nullptr;
+                g_pmut_mut_rings[2] = nullptr;
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(merge(HYPERVISOR_DEBUG_RING_SIZE).empty());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"records are merged in time order"} = []() {
+            bsl::ut_given{} = []() {
+                reset();
+                write_record(&g_mut_ring0, 0x1U, "pp0 1\n");
+                write_record(&g_mut_ring2, 0x2U, "pp2 2\n");
+                write_record(&g_mut_ring0, 0x3U, "pp0 3\n");
+                write_record(&g_mut_ring2, 0xABU, "pp2 ab\n");
+                bsl::ut_then{} = []() {
+                    auto const merged{merge(HYPERVISOR_DEBUG_RING_SIZE)};
+                    bsl::ut_check(merged == "pp0 1\npp2 2\npp0 3\npp2 ab\n");
+                    bsl::ut_check(merge(HYPERVISOR_DEBUG_RING_SIZE).empty());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"records that do not fit are continued"} = []() {
+            bsl::ut_given{} = []() {
+                reset();
+                write_record(&g_mut_ring0, 0x1U, "pp0\n");
+                write_record(&g_mut_ring2, 0x2U, "pp2\n");
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(merge(3U) == "pp0");
+                    bsl::ut_check(merge(3U) == "\npp");
+                    bsl::ut_check(merge(3U) == "2\n");
+                    bsl::ut_check(merge(3U).empty());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"partially overwritten records are skipped"} = []() {
+            bsl::ut_given{} = []() {
+                reset();
+                write_record(&g_mut_ring0, 0x1U, "lost\n");
+                for (bsl::uint64 mut_i{}; mut_i < HYPERVISOR_DEBUG_RING_SIZE; ++mut_i) {
+                    write_c(&g_mut_ring0, '.');
+                }
+                write_record(&g_mut_ring0, 0x2U, "kept\n");
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(merge(HYPERVISOR_DEBUG_RING_SIZE) == "kept\n");
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid positions are ignored"} = []() {
+            bsl::ut_given{} = []() {
+                reset();
+                write_record(&g_mut_ring0, 0x1U, "pp0\n");
+                g_mut_pos[0] = HYPERVISOR_DEBUG_RING_SIZE;
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(merge(HYPERVISOR_DEBUG_RING_SIZE).empty());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return mk::tests();
+}
@@ -0,0 +1,231 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+extern "C"
+{
+#include "../../include/g_mk_trace_ring.h"
+#include "../../include/trace_vmm.h"
+}
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the mask used by the tests
+    constexpr bsl::uint64 TEST_MASK{0x5U};
+
+    /// @brief stores the trace ring of PP 0
+    constinit trace_ring_t g_mut_ring0{};
+    /// @brief stores the trace ring of PP 2
+    constinit trace_ring_t g_mut_ring2{};
+    /// @brief stores the arguments given to trace_vmm
+    constinit trace_vmm_args_t g_mut_args{};
+
+    /// <!-- description -->
+    ///   @brief Implements platform_memcpy for trace_vmm
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_dst a pointer to the memory to copy to
+    ///   @param src a pointer to the memory to copy from
+    ///   @param num the number of bytes to copy
+    ///   @return Always returns LOADER_SUCCESS
+    ///
+    extern "C" auto
+    platform_memcpy(void *const pmut_dst, void const *const src, bsl::uint64 const num) noexcept
+        -> bsl::int64
+    {
+        __builtin_memcpy(pmut_dst, src, num);
+        return LOADER_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Resets the trace rings and arguments used by the tests.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param op the TRACE_VMM_OP_xxx to set in the arguments
+    ///
+    void
+    reset(bsl::uint64 const op) noexcept
+    {
+        g_mut_ring0 = {};
+        g_mut_ring2 = {};
+
+        for (bsl::uint64 mut_i{}; mut_i < HYPERVISOR_MAX_PPS; ++mut_i) {
+            g_mk_trace_ring[mut_i] = nullptr;
+        }
+
+        g_mk_trace_ring[0] = &g_mut_ring0;
+        g_mk_trace_ring[2] = &g_mut_ring2;
+
+        g_mut_args = {};
+        g_mut_args.ver = 1U;
+        g_mut_args.op = op;
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"invalid arguments"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_STOP);
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(LOADER_FAILURE == trace_vmm(nullptr));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unsupported version"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_STOP);
+                g_mut_args.ver = 2U;
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(LOADER_FAILURE == trace_vmm(&g_mut_args));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unknown op"} = []() {
+            bsl::ut_given{} = []() {
+                reset(0x42U);
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(LOADER_FAILURE == trace_vmm(&g_mut_args));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start clears the trace rings and sets the mask"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_START);
+                g_mut_args.mask = TEST_MASK;
+                g_mut_ring2.epos = 0x10U;
+                g_mut_ring2.num = 0x10U;
+                bsl::ut_when{} = []() {
+                    bsl::ut_check(LOADER_SUCCESS == trace_vmm(&g_mut_args));
+                    bsl::ut_then{} = []() {
+                        bsl::ut_check(TEST_MASK == g_mut_ring0.mask);
+                        bsl::ut_check(TEST_MASK == g_mut_ring2.mask);
+                        bsl::ut_check(0U == g_mut_ring2.epos);
+                        bsl::ut_check(0U == g_mut_ring2.num);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"stop clears the mask"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_STOP);
+                g_mut_ring0.mask = TEST_MASK;
+                g_mut_ring2.mask = TEST_MASK;
+                g_mut_ring2.num = 0x10U;
+                bsl::ut_when{} = []() {
+                    bsl::ut_check(LOADER_SUCCESS == trace_vmm(&g_mut_args));
+                    bsl::ut_then{} = []() {
+                        bsl::ut_check(0U == g_mut_ring0.mask);
+                        bsl::ut_check(0U == g_mut_ring2.mask);
+                        bsl::ut_check(0x10U == g_mut_ring2.num);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read copies the trace ring of a PP"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_READ);
+                g_mut_args.ppid = 2U;
+                g_mut_ring2.epos = 1U;
+                g_mut_ring2.num = 1U;
+                g_mut_ring2.records[0].tsc = 0x2AU;
+                g_mut_ring2.records[0].data0 = 0x11U;
+                bsl::ut_when{} = []() {
+                    bsl::ut_check(LOADER_SUCCESS == trace_vmm(&g_mut_args));
+                    bsl::ut_then{} = []() {
+                        bsl::ut_check(1U == g_mut_args.ring.epos);
+                        bsl::ut_check(1U == g_mut_args.ring.num);
+                        bsl::ut_check(0x2AU == g_mut_args.ring.records[0].tsc);
+                        bsl::ut_check(0x11U == g_mut_args.ring.records[0].data0);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read of a PP without a trace ring is empty"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_READ);
+                g_mut_args.ppid = 1U;
+                g_mut_args.ring.num = 0x10U;
+                bsl::ut_when{} = []() {
+                    bsl::ut_check(LOADER_SUCCESS == trace_vmm(&g_mut_args));
+                    bsl::ut_then{} = []() {
+                        bsl::ut_check(0U == g_mut_args.ring.epos);
+                        bsl::ut_check(0U == g_mut_args.ring.num);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read of an invalid PP is empty"} = []() {
+            bsl::ut_given{} = []() {
+                reset(TRACE_VMM_OP_READ);
+                g_mut_args.ppid = HYPERVISOR_MAX_PPS;
+                g_mut_args.ring.num = 0x10U;
+                bsl::ut_when{} = []() {
+                    bsl::ut_check(LOADER_SUCCESS == trace_vmm(&g_mut_args));
+                    bsl::ut_then{} = []() {
+                        bsl::ut_check(0U == g_mut_args.ring.epos);
+                        bsl::ut_check(0U == g_mut_args.ring.num);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return mk::tests();
+}
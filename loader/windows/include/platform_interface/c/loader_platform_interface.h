@@ -42,6 +42,7 @@
 #include <dump_vmm_args_t.h>
 #include <start_vmm_args_t.h>
 #include <stop_vmm_args_t.h>
+#include <trace_vmm_args_t.h>
 
 /** @brief defines the GUID name of the loader */
 DEFINE_GUID(
@@ -74,4 +75,12 @@ DEFINE_GUID(
         METHOD_BUFFERED,                                                                           \
         FILE_READ_DATA | FILE_WRITE_DATA)
 
+/** @brief defines IOCTL for controlling and reading a VMs trace rings */
+#define LOADER_TRACE_VMM                                                                           \
+    CTL_CODE(                                                                                      \
+        FILE_DEVICE_UNKNOWN,                                                                       \
+        LOADER_TRACE_VMM_CMD,                                                                      \
+        METHOD_BUFFERED,                                                                           \
+        FILE_READ_DATA | FILE_WRITE_DATA)
+
 #endif
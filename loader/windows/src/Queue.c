@@ -31,6 +31,8 @@ Environment:
 #include <start_vmm_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
+#include <trace_vmm.h>
+#include <trace_vmm_args_t.h>
 #include <loader_platform_interface.h>
 
 // clang-format on
@@ -176,13 +178,21 @@ Return Value:
             break;
         }
         case LOADER_DUMP_VMM: {
-            if (dump_vmm((struct dump_vmm_args_t const *)out)) {
+            if (dump_vmm((struct dump_vmm_args_t *)out)) {
                 bferror("dump_vmm failed");
                 WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
                 return;
             }
             break;
         }
+        case LOADER_TRACE_VMM: {
+            if (trace_vmm((struct trace_vmm_args_t *)out)) {
+                bferror("trace_vmm failed");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
         default: {
             bferror_x64("invalid ioctl cmd", IoControlCode);
             WdfRequestComplete(Request, STATUS_ACCESS_DENIED);
@@ -0,0 +1,276 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <chrono>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+
+namespace bench
+{
+    /// @brief defines the smallest size that is measured
+    constexpr auto MIN_SIZE{0x8_umax};
+    /// @brief defines the largest size that is measured
+    constexpr auto MAX_SIZE{0x200000_umax};
+    /// @brief defines the number of bytes copied/filled per measurement
+    constexpr auto BYTES_PER_RUN{0x10000000_umax};
+    /// @brief defines the number of nanoseconds in a microsecond
+    constexpr auto NS_PER_US{1000_umax};
+
+    /// @brief defines the "features have been detected" bit
+    constexpr auto MEMOPS_DETECTED{0x1_u64};
+    /// @brief defines the ERMS bit
+    constexpr auto MEMOPS_ERMS{0x2_u64};
+    /// @brief defines the FSRM bit
+    constexpr auto MEMOPS_FSRM{0x4_u64};
+    /// @brief defines the AVX2 bit
+    constexpr auto MEMOPS_AVX2{0x8_u64};
+
+    /// @brief stores the CPU features memcpy/memset use (see memops_features.S)
+    extern "C" bsl::uint64 bench_memops_features;
+
+    /// <!-- description -->
+    ///   @brief Detects the CPU features and stores them in
+    ///     bench_memops_features.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the CPU features that were detected
+    ///
+    extern "C" [[nodiscard]] auto bench_memops_init() noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Provides the prototype for the runtime's memcpy
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_dst a pointer to the memory to copy to
+    ///   @param src a pointer to the memory to copy from
+    ///   @param num the number of bytes to copy
+    ///   @return Returns dst
+    ///
+    extern "C" [[nodiscard]] auto
+    bench_memcpy(void *const pmut_dst, void const *const src, bsl::uintmax const num) noexcept
+        -> void *;
+
+    /// <!-- description -->
+    ///   @brief Provides the prototype for the runtime's memset
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_dst a pointer to the memory to fill
+    ///   @param val the value to fill the memory with
+    ///   @param num the number of bytes to fill
+    ///   @return Returns dst
+    ///
+    extern "C" [[nodiscard]] auto
+    bench_memset(void *const pmut_dst, bsl::int32 const val, bsl::uintmax const num) noexcept
+        -> void *;
+
+    /// @brief stores the memory that is copied from
+    constinit bsl::array<bsl::uint8, MAX_SIZE.get()> g_mut_src{};
+    /// @brief stores the memory that is copied to/filled
+    constinit bsl::array<bsl::uint8, MAX_SIZE.get()> g_mut_dst{};
+
+    /// @brief defines the total number of variants that are measured
+    constexpr auto NUM_VARIANTS{5_umax};
+
+    /// <!-- description -->
+    ///   @brief Returns the name of the provided variant
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param idx the index of the variant
+    ///   @return Returns the name of the provided variant
+    ///
+    [[nodiscard]] constexpr auto
+    variant_name(bsl::safe_uintmax const &idx) noexcept -> bsl::string_view
+    {
+        switch (idx.get()) {
+            case 0: {
+                return "movsb";
+            }
+
+            case 1: {
+                return "movsq";
+            }
+
+            case 2: {
+                return "erms";
+            }
+
+            case 3: {
+                return "avx2";
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return "auto";
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the features that select the provided variant, or
+    ///     bsl::safe_uint64::failure() if this CPU does not support it.
+    ///     "movsb" is what memcpy/memset used to be (i.e., REP MOVSB/STOSB
+    ///     for every size).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param idx the index of the variant
+    ///   @param detected the features that were detected
+    ///   @return Returns the features that select the provided variant
+    ///
+    [[nodiscard]] constexpr auto
+    variant_features(bsl::safe_uintmax const &idx, bsl::safe_uint64 const &detected) noexcept
+        -> bsl::safe_uint64
+    {
+        switch (idx.get()) {
+            case 0: {
+                return MEMOPS_DETECTED | MEMOPS_ERMS | MEMOPS_FSRM;
+            }
+
+            case 1: {
+                return MEMOPS_DETECTED;
+            }
+
+            case 2: {
+                return MEMOPS_DETECTED | MEMOPS_ERMS;
+            }
+
+            case 3: {
+                if ((detected & MEMOPS_AVX2).is_zero()) {
+                    return bsl::safe_uint64::failure();
+                }
+
+                return MEMOPS_DETECTED | MEMOPS_AVX2;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return detected;
+    }
+
+    /// <!-- description -->
+    ///   @brief Copies (or fills) "size" bytes until BYTES_PER_RUN bytes
+    ///     have been written and returns the throughput in MB/s.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param features the features that select the variant to measure
+    ///   @param size the number of bytes to copy/fill per call
+    ///   @param copy if true, memcpy is measured, otherwise memset is
+    ///   @return Returns the throughput in MB/s
+    ///
+    [[nodiscard]] auto
+    measure(
+        bsl::safe_uint64 const &features,
+        bsl::safe_uintmax const &size,
+        bool const copy) noexcept -> bsl::safe_uintmax
+    {
+        auto const iterations{BYTES_PER_RUN / size};
+        bench_memops_features = features.get();
+
+        auto const start{std::chrono::steady_clock::now()};
+        for (bsl::safe_uintmax mut_i{}; mut_i < iterations; ++mut_i) {
+            if (copy) {
+                bsl::discard(bench_memcpy(g_mut_dst.data(), g_mut_src.data(), size.get()));
+            }
+            else {
+                bsl::discard(bench_memset(g_mut_dst.data(), {}, size.get()));
+            }
+        }
+        auto const stop{std::chrono::steady_clock::now()};
+
+        auto const ns{std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)};
+        auto const elapsed{bsl::to_umax(static_cast<bsl::uintmax>(ns.count()))};
+        if (elapsed.is_zero()) {
+            return {};
+        }
+
+        return ((iterations * size) * NS_PER_US) / elapsed;
+    }
+
+    /// <!-- description -->
+    ///   @brief Measures every variant of memcpy (or memset) for every
+    ///     power of two between MIN_SIZE and MAX_SIZE.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param detected the features that were detected
+    ///   @param copy if true, memcpy is measured, otherwise memset is
+    ///
+    void
+    run(bsl::safe_uint64 const &detected, bool const copy) noexcept
+    {
+        bsl::string_view mut_op{"memset"};
+        if (copy) {
+            mut_op = "memcpy";
+        }
+        else {
+            bsl::touch();
+        }
+
+        for (auto mut_size{MIN_SIZE}; mut_size <= MAX_SIZE; mut_size += mut_size) {
+            for (bsl::safe_uintmax mut_i{}; mut_i < NUM_VARIANTS; ++mut_i) {
+                auto const features{variant_features(mut_i, detected)};
+                if (!features) {
+                    continue;
+                }
+
+                bsl::print() << mut_op                                 // --
+                             << ','                                    // --
+                             << mut_size                               // --
+                             << ','                                    // --
+                             << variant_name(mut_i)                    // --
+                             << ','                                    // --
+                             << measure(features, mut_size, copy)    // --
+                             << bsl::endl;                             // --
+            }
+        }
+    }
+}
+
+/// <!-- description -->
+///   @brief Provides the main entry point for this application.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::safe_uint64 const detected{bench::bench_memops_init()};
+    bsl::print() << "op,size,variant,MB/s" << bsl::endl;
+
+    bench::run(detected, true);
+    bench::run(detected, false);
+
+    return bsl::exit_success;
+}
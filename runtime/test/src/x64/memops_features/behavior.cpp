@@ -0,0 +1,257 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the "features have been detected" bit
+    constexpr auto MEMOPS_DETECTED{0x1_u64};
+    /// @brief defines the AVX2 bit
+    constexpr auto MEMOPS_AVX2{0x8_u64};
+    /// @brief defines one past the last combination of feature bits
+    constexpr auto MEMOPS_END{0x10_u64};
+    /// @brief defines the distance between two feature combinations
+    constexpr auto MEMOPS_STEP{0x2_u64};
+
+    /// @brief defines the size of the buffers used by the tests
+    constexpr auto BUF_SIZE{0x2000_umax};
+    /// @brief every size below this is tested
+    constexpr auto SMALL_SIZE{0x100_umax};
+    /// @brief defines the largest size that is tested
+    constexpr auto LARGE_SIZE{0x1800_umax};
+    /// @brief sizes above SMALL_SIZE are tested in (odd) steps of this
+    constexpr auto LARGE_STEP{0x65_umax};
+    /// @brief defines the (unaligned) offset of the destination
+    constexpr auto DST_OFFSET{0x1_umax};
+    /// @brief defines the (unaligned) offset of the source
+    constexpr auto SRC_OFFSET{0x3_umax};
+    /// @brief defines the value the destination starts with
+    constexpr auto FILL{0xAA_u8};
+    /// @brief defines the value used to test memset
+    constexpr auto VAL{0x5C_u8};
+
+    /// @brief stores the CPU features memcpy/memset use (see memops_features.S)
+    extern "C" bsl::uint64 ut_memops_features;
+
+    /// <!-- description -->
+    ///   @brief Detects the CPU features and stores them in
+    ///     ut_memops_features.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the CPU features that were detected
+    ///
+    extern "C" [[nodiscard]] auto ut_memops_init() noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Provides the prototype for memcpy
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_dst pointer to the destination array where the content is to
+    ///     be copied, type-casted to a pointer of type void*.
+    ///   @param src pointer to the source of data to be copied, type-casted to
+    ///     a pointer of type const void*.
+    ///   @param num number of bytes to copy.
+    ///   @return Returns dst
+    ///
+    extern "C" [[nodiscard]] auto
+    ut_memcpy(void *const pmut_dst, void const *const src, bsl::uintmax const num) noexcept
+        -> void *;
+
+    /// <!-- description -->
+    ///   @brief Provides the prototype for memset
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_dst pointer to the block of memory to fill.
+    ///   @param val value to be set.
+    ///   @param num number of bytes to be set to the val.
+    ///   @return Returns dst
+    ///
+    extern "C" [[nodiscard]] auto
+    ut_memset(void *const pmut_dst, bsl::int32 const val, bsl::uintmax const num) noexcept
+        -> void *;
+
+    /// <!-- description -->
+    ///   @brief Copies and fills "size" bytes using the memcpy/memset that
+    ///     the provided features select, and makes sure that exactly
+    ///     those bytes were written.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param features the features to give memcpy/memset
+    ///   @param size the number of bytes to copy/fill
+    ///   @return Returns true if memcpy and memset worked, false otherwise
+    ///
+    [[nodiscard]] auto
+    check_size(bsl::safe_uint64 const &features, bsl::safe_uintmax const &size) noexcept -> bool
+    {
+        constexpr auto mask{0xFF_umax};
+
+        bsl::array<bsl::uint8, BUF_SIZE.get()> mut_src{};
+        bsl::array<bsl::uint8, BUF_SIZE.get()> mut_dst{};
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_src.size(); ++mut_i) {
+            *mut_src.at_if(mut_i) = bsl::to_u8(mut_i & mask).get();
+            *mut_dst.at_if(mut_i) = FILL.get();
+        }
+
+        ut_memops_features = features.get();
+
+        auto *const pmut_dst{mut_dst.at_if(DST_OFFSET)};
+        if (ut_memcpy(pmut_dst, mut_src.at_if(SRC_OFFSET), size.get()) != pmut_dst) {
+            return false;
+        }
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_dst.size(); ++mut_i) {
+            bsl::uint8 mut_expected{FILL.get()};
+            if ((mut_i >= DST_OFFSET) && (mut_i < DST_OFFSET + size)) {
+                mut_expected = *mut_src.at_if((mut_i - DST_OFFSET) + SRC_OFFSET);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (*mut_dst.at_if(mut_i) != mut_expected) {
+                return false;
+            }
+        }
+
+        if (ut_memset(pmut_dst, bsl::to_i32(VAL).get(), size.get()) != pmut_dst) {
+            return false;
+        }
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_dst.size(); ++mut_i) {
+            bsl::uint8 mut_expected{FILL.get()};
+            if ((mut_i >= DST_OFFSET) && (mut_i < DST_OFFSET + size)) {
+                mut_expected = VAL.get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (*mut_dst.at_if(mut_i) != mut_expected) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs check_size for every size that is tested
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param features the features to give memcpy/memset
+    ///   @return Returns true if memcpy and memset worked, false otherwise
+    ///
+    [[nodiscard]] auto
+    check_variant(bsl::safe_uint64 const &features) noexcept -> bool
+    {
+        for (bsl::safe_uintmax mut_size{}; mut_size < SMALL_SIZE; ++mut_size) {
+            if (!check_size(features, mut_size)) {
+                return false;
+            }
+        }
+
+        for (auto mut_size{SMALL_SIZE}; mut_size < LARGE_SIZE; mut_size += LARGE_STEP) {
+            if (!check_size(features, mut_size)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"first call detects the features"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::uint8, 1> mut_data_dst{};
+                bsl::array<bsl::uint8, 1> mut_data_src{};
+                bsl::ut_when{} = [&]() noexcept {
+                    ut_memops_features = {};
+                    bsl::discard(ut_memcpy(
+                        mut_data_dst.data(), mut_data_src.data(), mut_data_src.size_bytes().get()));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            MEMOPS_DETECTED == (bsl::to_u64(ut_memops_features) & MEMOPS_DETECTED));
+                        bsl::ut_check(ut_memops_init() == ut_memops_features);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"every variant copies and fills every size"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::safe_uint64 const detected{ut_memops_init()};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_uint64 mut_bits{}; mut_bits < MEMOPS_END;
+                         mut_bits += MEMOPS_STEP) {
+                        if ((mut_bits & MEMOPS_AVX2) > (detected & MEMOPS_AVX2)) {
+                            continue;
+                        }
+
+                        bsl::ut_check(check_variant(mut_bits | MEMOPS_DETECTED));
+                    }
+
+                    ut_memops_features = {};
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
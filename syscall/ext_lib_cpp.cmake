@@ -66,6 +66,8 @@ target_include_directories(syscall PUBLIC
 
 list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/include/cpp/bf_constants.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/cpp/bf_exit_filter_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/cpp/bf_reg_batch_entry_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/cpp/bf_types.hpp
     ${CMAKE_CURRENT_LIST_DIR}/src/cpp/bf_control_ops.hpp
     ${CMAKE_CURRENT_LIST_DIR}/src/cpp/bf_debug_ops.hpp
@@ -105,6 +107,8 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_control_op_wait_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_ext_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_huge_pool_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_debug_op_page_pool_stats_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_debug_op_dump_lock_stats_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_page_pool_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vm_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vmexit_log_impl.S ${HEADERS})
@@ -125,6 +129,7 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_mem_op_alloc_page_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_mem_op_free_huge_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_mem_op_free_page_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_mem_op_map_direct_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_extid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_online_pps_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_ppid_impl.S ${HEADERS})
@@ -143,6 +148,15 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_tls_r13_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_r14_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_r15_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_exit_seq_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_exit_reason_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_exit_qualification_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_exit_instr_len_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_exit_instr_info_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_rip_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_rsp_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_rflags_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_cr3_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_set_rax_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_set_rbx_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_set_rcx_impl.S ${HEADERS})
@@ -158,6 +172,10 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_tls_set_r13_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_set_r14_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_set_r15_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_set_rip_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_set_rsp_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_set_rflags_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_set_exit_info_mask_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_thread_id_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_vmid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_vpid_impl.S ${HEADERS})
@@ -174,9 +192,12 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_vps_op_destroy_vps_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vps_op_init_as_root_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vps_op_promote_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vps_op_read_batch_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vps_op_read_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vps_op_run_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vps_op_run_current_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vps_op_set_exit_filters_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vps_op_write_batch_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vps_op_write_impl.S ${HEADERS})
 endif()
 
@@ -188,6 +209,8 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "aarch64")
     hypervisor_target_source(syscall src/arm/aarch64/bf_control_op_wait_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_dump_ext_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_dump_huge_pool_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_page_pool_stats_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_dump_lock_stats_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_dump_page_pool_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_dump_vm_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_debug_op_dump_vmexit_log_impl.S ${HEADERS})
@@ -208,6 +231,7 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "aarch64")
     hypervisor_target_source(syscall src/arm/aarch64/bf_mem_op_alloc_page_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_mem_op_free_huge_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_mem_op_free_page_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_mem_op_map_direct_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_extid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_online_pps_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_ppid_impl.S ${HEADERS})
@@ -226,6 +250,15 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "aarch64")
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_r13_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_r14_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_r15_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_exit_seq_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_exit_reason_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_exit_qualification_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_exit_instr_len_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_exit_instr_info_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_rip_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_rsp_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_rflags_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_cr3_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_rax_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_rbx_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_rcx_impl.S ${HEADERS})
@@ -241,6 +274,10 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "aarch64")
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_r13_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_r14_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_r15_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_rip_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_rsp_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_rflags_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_tls_set_exit_info_mask_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_thread_id_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_vmid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_tls_vpid_impl.S ${HEADERS})
@@ -257,9 +294,12 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "aarch64")
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_destroy_vps_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_init_as_root_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_promote_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_read_batch_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_read_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_run_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_run_current_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_set_exit_filters_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_write_batch_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/arm/aarch64/bf_vps_op_write_impl.S ${HEADERS})
 endif()
 
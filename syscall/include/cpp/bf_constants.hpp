@@ -296,6 +296,28 @@ namespace syscall
     constexpr auto TLS_OFFSET_R14{0x868_u64};
     /// @brief stores the offset for r15
     constexpr auto TLS_OFFSET_R15{0x870_u64};
+    /// @brief stores the offset of the VMExit sequence number
+    constexpr auto TLS_OFFSET_EXIT_SEQ{0x880_u64};
+    /// @brief stores the offset of the VMExit reason
+    constexpr auto TLS_OFFSET_EXIT_REASON{0x888_u64};
+    /// @brief stores the offset of the VMExit qualification
+    constexpr auto TLS_OFFSET_EXIT_QUALIFICATION{0x890_u64};
+    /// @brief stores the offset of the VMExit instruction length
+    constexpr auto TLS_OFFSET_EXIT_INSTR_LEN{0x898_u64};
+    /// @brief stores the offset of the VMExit instruction information
+    constexpr auto TLS_OFFSET_EXIT_INSTR_INFO{0x8A0_u64};
+    /// @brief stores the offset for rip
+    constexpr auto TLS_OFFSET_RIP{0x8A8_u64};
+    /// @brief stores the offset for rsp
+    constexpr auto TLS_OFFSET_RSP{0x8B0_u64};
+    /// @brief stores the offset for rflags
+    constexpr auto TLS_OFFSET_RFLAGS{0x8B8_u64};
+    /// @brief stores the offset for cr3
+    constexpr auto TLS_OFFSET_CR3{0x8C0_u64};
+    /// @brief stores the offset of the write-back dirty mask
+    constexpr auto TLS_OFFSET_DIRTY{0x8C8_u64};
+    /// @brief stores the offset of the exit information mask
+    constexpr auto TLS_OFFSET_EXIT_INFO_MASK{0x8D0_u64};
     /// @brief stores the offset of the active extid
     constexpr auto TLS_OFFSET_ACTIVE_EXTID{0xFF0_u64};
     /// @brief stores the offset of the active vmid
@@ -309,6 +331,30 @@ namespace syscall
     /// @brief stores the number of PPs that are online
     constexpr auto TLS_OFFSET_ONLINE_PPS{0xFFA_u64};
 
+    // -------------------------------------------------------------------------
+    // TLS Write-Back Dirty Mask
+    // -------------------------------------------------------------------------
+
+    /// @brief tells the microkernel to write tls.rip back to the VPS
+    constexpr auto TLS_DIRTY_RIP{0x0000000000000001_u64};
+    /// @brief tells the microkernel to write tls.rsp back to the VPS
+    constexpr auto TLS_DIRTY_RSP{0x0000000000000002_u64};
+    /// @brief tells the microkernel to write tls.rflags back to the VPS
+    constexpr auto TLS_DIRTY_RFLAGS{0x0000000000000004_u64};
+
+    // -------------------------------------------------------------------------
+    // Exit Filter Actions
+    // -------------------------------------------------------------------------
+
+    /// @brief hands the VMExit to the extension (stops the search)
+    constexpr auto BF_EXIT_FILTER_ACTION_EXT{0x0000000000000000_u64};
+    /// @brief emulates CPUID using the masks in data0/data1 and resumes
+    constexpr auto BF_EXIT_FILTER_ACTION_CPUID{0x0000000000000001_u64};
+    /// @brief emulates RDMSR by returning data0 in EDX:EAX and resumes
+    constexpr auto BF_EXIT_FILTER_ACTION_RDMSR{0x0000000000000002_u64};
+    /// @brief ignores the instruction that caused the VMExit and resumes
+    constexpr auto BF_EXIT_FILTER_ACTION_ADVANCE_IP{0x0000000000000003_u64};
+
     // -------------------------------------------------------------------------
     // Syscall Indexes
     // -------------------------------------------------------------------------
@@ -345,6 +391,10 @@ namespace syscall
     constexpr auto BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL{0x0000000000000008_u64};
     /// @brief Defines the syscall index for bf_debug_op_dump_huge_pool
     constexpr auto BF_DEBUG_OP_DUMP_HUGE_POOL_IDX_VAL{0x0000000000000009_u64};
+    /// @brief Defines the syscall index for bf_debug_op_page_pool_stats
+    constexpr auto BF_DEBUG_OP_PAGE_POOL_STATS_IDX_VAL{0x000000000000000A_u64};
+    /// @brief Defines the syscall index for bf_debug_op_dump_lock_stats
+    constexpr auto BF_DEBUG_OP_DUMP_LOCK_STATS_IDX_VAL{0x000000000000000B_u64};
 
     /// @brief Defines the syscall index for bf_callback_op_register_bootstrap
     constexpr auto BF_CALLBACK_OP_REGISTER_BOOTSTRAP_IDX_VAL{0x0000000000000000_u64};
@@ -387,6 +437,12 @@ namespace syscall
     constexpr auto BF_VPS_OP_PROMOTE_IDX_VAL{0x0000000000000009_u64};
     /// @brief Defines the syscall index for bf_vps_op_clear_vps
     constexpr auto BF_VPS_OP_CLEAR_VPS_IDX_VAL{0x000000000000000A_u64};
+    /// @brief Defines the syscall index for bf_vps_op_read_batch
+    constexpr auto BF_VPS_OP_READ_BATCH_IDX_VAL{0x000000000000000B_u64};
+    /// @brief Defines the syscall index for bf_vps_op_write_batch
+    constexpr auto BF_VPS_OP_WRITE_BATCH_IDX_VAL{0x000000000000000C_u64};
+    /// @brief Defines the syscall index for bf_vps_op_set_exit_filters
+    constexpr auto BF_VPS_OP_SET_EXIT_FILTERS_IDX_VAL{0x000000000000000D_u64};
 
     /// @brief Defines the syscall index for bf_intrinsic_op_rdmsr
     constexpr auto BF_INTRINSIC_OP_RDMSR_IDX_VAL{0x0000000000000000_u64};
@@ -409,6 +465,8 @@ namespace syscall
     constexpr auto BF_MEM_OP_FREE_HUGE_IDX_VAL{0x0000000000000003_u64};
     /// @brief Defines the syscall index for bf_mem_op_alloc_heap
     constexpr auto BF_MEM_OP_ALLOC_HEAP_IDX_VAL{0x0000000000000004_u64};
+    /// @brief Defines the syscall index for bf_mem_op_map_direct
+    constexpr auto BF_MEM_OP_MAP_DIRECT_IDX_VAL{0x0000000000000005_u64};
 }
 
 #endif
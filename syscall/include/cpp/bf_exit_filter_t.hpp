@@ -0,0 +1,68 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BF_EXIT_FILTER_T_HPP
+#define BF_EXIT_FILTER_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+
+namespace syscall
+{
+    /// @struct syscall::bf_exit_filter_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the layout of a single exit filter registered using
+    ///     bf_vps_op_set_exit_filters. A filter matches a VMExit when the
+    ///     exit reasons are equal, the exit qualification masked with
+    ///     qual_mask equals qual_val, and ECX:EAX masked with reg_mask
+    ///     equals reg_val. The first filter that matches decides what
+    ///     happens (see BF_EXIT_FILTER_ACTION_XXX). If no filter matches,
+    ///     the VMExit is handed to the extension.
+    ///
+    struct bf_exit_filter_t final
+    {
+        /// @brief stores the exit reason this filter applies to
+        bsl::uint64 exit_reason;
+        /// @brief stores the bits of the exit qualification to compare
+        bsl::uint64 qual_mask;
+        /// @brief stores the value the masked exit qualification must equal
+        bsl::uint64 qual_val;
+        /// @brief stores the bits of ECX:EAX to compare
+        bsl::uint64 reg_mask;
+        /// @brief stores the value the masked ECX:EAX must equal
+        bsl::uint64 reg_val;
+        /// @brief stores the BF_EXIT_FILTER_ACTION_XXX to perform
+        bsl::uint64 action;
+        /// @brief stores the EBX:EAX CPUID mask, or the RDMSR EDX:EAX value
+        bsl::uint64 data0;
+        /// @brief stores the EDX:ECX CPUID mask
+        bsl::uint64 data1;
+    };
+
+    /// @brief Defines the max number of exit filters a VPS can have
+    constexpr auto BF_EXIT_FILTER_MAX_ENTRIES{0x10_u64};
+}
+
+#endif
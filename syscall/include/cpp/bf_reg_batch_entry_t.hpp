@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef BF_REG_BATCH_ENTRY_T_HPP
+#define BF_REG_BATCH_ENTRY_T_HPP
+
+#include <bf_reg_t.hpp>
+#include <bf_types.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+
+namespace syscall
+{
+    /// @struct syscall::bf_reg_batch_entry_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the layout of a single entry used by
+    ///     bf_vps_op_read_batch and bf_vps_op_write_batch. The entries live
+    ///     in a page that was allocated by the extension using
+    ///     bf_mem_op_alloc_page. The microkernel reads reg (and val when
+    ///     writing), and fills in val (when reading) and status for every
+    ///     entry it processes.
+    ///
+    struct bf_reg_batch_entry_t final
+    {
+        /// @brief stores the register to read or write
+        bf_reg_t reg;
+        /// @brief stores the value that was read or the value to write
+        bsl::uint64 val;
+        /// @brief stores the bf_status_t of this entry
+        bf_status_t::value_type status;
+    };
+
+    /// @brief Defines the max number of entries that fit in a 4k batch page
+    constexpr auto BF_REG_BATCH_MAX_ENTRIES{0x1000_u64 / bsl::to_u64(sizeof(bf_reg_batch_entry_t))};
+}
+
+#endif
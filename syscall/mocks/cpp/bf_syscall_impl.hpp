@@ -26,6 +26,8 @@
 #define MOCKS_BF_SYSCALL_IMPL_HPP
 
 #include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+#include <bf_reg_batch_entry_t.hpp>
 #include <bf_reg_t.hpp>
 #include <bf_types.hpp>
 #include <iomanip>
@@ -35,6 +37,7 @@
 #include <bsl/convert.hpp>
 #include <bsl/cstr_type.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/span.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unordered_map.hpp>
@@ -105,6 +108,8 @@ namespace syscall
     constinit inline bool g_mut_bf_debug_op_dump_page_pool_impl_executed{};
     /// @brief stores whether or not bf_debug_op_dump_huge_pool_impl was executed
     constinit inline bool g_mut_bf_debug_op_dump_huge_pool_impl_executed{};
+    /// @brief stores whether or not bf_debug_op_dump_lock_stats_impl was executed
+    constinit inline bool g_mut_bf_debug_op_dump_lock_stats_impl_executed{};
 
     // -------------------------------------------------------------------------
     // dummy callbacks
@@ -518,6 +523,165 @@ namespace syscall
         g_mut_data.at("bf_tls_r15") = val;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_seq.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_exit_seq_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_exit_seq").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_reason.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_exit_reason_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_exit_reason").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_qualification.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_exit_qualification_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_exit_qualification").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_instr_len.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_exit_instr_len_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_exit_instr_len").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_instr_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_exit_instr_info_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_exit_instr_info").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_rip.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_rip_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_rip").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_rsp.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_rsp_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_rsp").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_rflags.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_rflags_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_rflags").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_cr3.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_cr3_impl() noexcept -> bf_uint64_t::value_type
+    {
+        return g_mut_data.at("bf_tls_cr3").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_rip.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" inline void
+    bf_tls_set_rip_impl(bf_uint64_t::value_type const val) noexcept
+    {
+        g_mut_data.at("bf_tls_rip") = val;
+        g_mut_data.at("bf_tls_dirty") |= TLS_DIRTY_RIP;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_rsp.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" inline void
+    bf_tls_set_rsp_impl(bf_uint64_t::value_type const val) noexcept
+    {
+        g_mut_data.at("bf_tls_rsp") = val;
+        g_mut_data.at("bf_tls_dirty") |= TLS_DIRTY_RSP;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_rflags.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" inline void
+    bf_tls_set_rflags_impl(bf_uint64_t::value_type const val) noexcept
+    {
+        g_mut_data.at("bf_tls_rflags") = val;
+        g_mut_data.at("bf_tls_dirty") |= TLS_DIRTY_RFLAGS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_exit_info_mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" inline void
+    bf_tls_set_exit_info_mask_impl(bf_uint64_t::value_type const val) noexcept
+    {
+        g_mut_data.at("bf_tls_exit_info_mask") = val;
+    }
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_tls_extid.
     ///
@@ -796,6 +960,63 @@ namespace syscall
         std::cout << "huge pool dump: mock empty\n";
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_page_pool_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_reg0_out n/a
+    ///   @param pmut_reg1_out n/a
+    ///   @param pmut_reg2_out n/a
+    ///   @param pmut_reg3_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_debug_op_page_pool_stats_impl(
+        bf_uint64_t::value_type *const pmut_reg0_out,
+        bf_uint64_t::value_type *const pmut_reg1_out,
+        bf_uint64_t::value_type *const pmut_reg2_out,
+        bf_uint64_t::value_type *const pmut_reg3_out) noexcept -> bf_status_t::value_type
+    {
+        if (bsl::unlikely(nullptr == pmut_reg0_out)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (bsl::unlikely(nullptr == pmut_reg1_out)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (bsl::unlikely(nullptr == pmut_reg2_out)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (bsl::unlikely(nullptr == pmut_reg3_out)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (g_mut_errc.at("bf_debug_op_page_pool_stats_impl") == BF_STATUS_SUCCESS) {
+            *pmut_reg0_out = g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg0_out").get();
+            *pmut_reg1_out = g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg1_out").get();
+            *pmut_reg2_out = g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg2_out").get();
+            *pmut_reg3_out = g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg3_out").get();
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_debug_op_page_pool_stats_impl").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_lock_stats.
+    ///
+    extern "C" inline void
+    bf_debug_op_dump_lock_stats_impl() noexcept
+    {
+        g_mut_bf_debug_op_dump_lock_stats_impl_executed = true;
+        std::cout << "lock stats dump: mock empty
+";
+    }
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -1132,6 +1353,86 @@ namespace syscall
         return g_mut_errc.at("bf_vps_op_write_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_read_batch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param pmut_reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vps_op_read_batch_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint16_t::value_type const reg1_in,
+        bf_reg_batch_entry_t *const pmut_reg2_in,
+        bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (bsl::unlikely(nullptr == pmut_reg2_in)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        auto const ret{g_mut_errc.at("bf_vps_op_read_batch_impl")};
+        bsl::span<bf_reg_batch_entry_t> const batch{pmut_reg2_in, bsl::to_umax(reg3_in)};
+        for (auto const elem : batch) {
+            if (ret == BF_STATUS_SUCCESS) {
+                elem.data->val = g_mut_data.at("bf_vps_op_read_batch_impl_val").get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            elem.data->status = ret.get();
+        }
+
+        return ret.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_write_batch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param pmut_reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vps_op_write_batch_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint16_t::value_type const reg1_in,
+        bf_reg_batch_entry_t *const pmut_reg2_in,
+        bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (bsl::unlikely(nullptr == pmut_reg2_in)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        auto const ret{g_mut_errc.at("bf_vps_op_write_batch_impl")};
+        bsl::span<bf_reg_batch_entry_t> const batch{pmut_reg2_in, bsl::to_umax(reg3_in)};
+        for (auto const elem : batch) {
+            if (ret == BF_STATUS_SUCCESS) {
+                g_mut_data.at("bf_vps_op_write_batch_impl") = bsl::to_u64(elem.data->val);
+            }
+            else {
+                bsl::touch();
+            }
+
+            elem.data->status = ret.get();
+        }
+
+        return ret.get();
+    }
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_vps_op_run.
     ///
@@ -1244,6 +1545,34 @@ namespace syscall
         return g_mut_errc.at("bf_vps_op_clear_vps_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_set_exit_filters.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vps_op_set_exit_filters_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint16_t::value_type const reg1_in,
+        bf_exit_filter_t const *const reg2_in,
+        bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (bsl::unlikely(nullptr == reg2_in && bsl::uint64{} != reg3_in)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        g_mut_data.at("bf_vps_op_set_exit_filters_impl") = bsl::to_u64(reg3_in);
+        return g_mut_errc.at("bf_vps_op_set_exit_filters_impl").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -1525,6 +1854,34 @@ namespace syscall
 
         return g_mut_errc.at("bf_mem_op_alloc_heap_impl").get();
     }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_map_direct.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_mem_op_map_direct_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint64_t::value_type const reg1_in,
+        bf_uint64_t::value_type const reg2_in) noexcept -> bf_status_t::value_type
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (g_mut_errc.at("bf_mem_op_map_direct_impl") == BF_STATUS_SUCCESS) {
+            g_mut_data.at("bf_mem_op_map_direct_impl") = bsl::to_u64(reg2_in);
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_mem_op_map_direct_impl").get();
+    }
 }
 
 #endif
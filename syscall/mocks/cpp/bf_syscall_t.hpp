@@ -26,6 +26,8 @@
 #define MOCKS_BF_SYSCALL_T_HPP
 
 #include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+#include <bf_reg_batch_entry_t.hpp>
 #include <bf_reg_t.hpp>
 #include <bf_syscall_impl.hpp>
 #include <bf_types.hpp>
@@ -35,6 +37,7 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/is_unsigned.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unordered_map.hpp>
 
@@ -90,6 +93,8 @@ namespace syscall
         bsl::unordered_map<bf_uint16_t, bsl::errc_type> m_bf_vps_op_promote;
         /// @brief stores the results for bf_vps_op_clear_vps
         bsl::unordered_map<bf_uint16_t, bsl::errc_type> m_bf_vps_op_clear_vps;
+        /// @brief stores the results for bf_vps_op_set_exit_filters
+        bsl::unordered_map<bf_uint16_t, bsl::errc_type> m_bf_vps_op_set_exit_filters;
         /// @brief stores the results for bf_intrinsic_op_rdmsr
         bsl::unordered_map<bf_uint32_t, bf_uint64_t> m_bf_intrinsic_op_rdmsr;
         /// @brief stores the results for bf_intrinsic_op_wrmsr
@@ -108,6 +113,8 @@ namespace syscall
         bsl::errc_type m_bf_mem_op_alloc_huge;
         /// @brief stores the results for bf_mem_op_free_huge
         bsl::errc_type m_bf_mem_op_free_huge;
+        /// @brief stores the results for bf_mem_op_map_direct
+        bsl::errc_type m_bf_mem_op_map_direct;
 
         /// @brief stores a map of allocations and their sizes
         bsl::unordered_map<void *, bf_uint64_t> m_alloc_free_map;
@@ -631,6 +638,291 @@ namespace syscall
             m_tls.at(TLS_OFFSET_R15) = val;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_seq
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_seq
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_seq() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_EXIT_SEQ);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.exit_seq (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.exit_seq to
+        ///
+        constexpr void
+        bf_tls_set_exit_seq(bf_uint64_t const &val) noexcept
+        {
+            m_tls.at(TLS_OFFSET_EXIT_SEQ) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_reason
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_reason
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_reason() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_EXIT_REASON);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.exit_reason (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.exit_reason to
+        ///
+        constexpr void
+        bf_tls_set_exit_reason(bf_uint64_t const &val) noexcept
+        {
+            m_tls.at(TLS_OFFSET_EXIT_REASON) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_qualification
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_qualification
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_qualification() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_EXIT_QUALIFICATION);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.exit_qualification (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.exit_qualification to
+        ///
+        constexpr void
+        bf_tls_set_exit_qualification(bf_uint64_t const &val) noexcept
+        {
+            m_tls.at(TLS_OFFSET_EXIT_QUALIFICATION) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_instr_len
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_instr_len
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_instr_len() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_EXIT_INSTR_LEN);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.exit_instr_len (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.exit_instr_len to
+        ///
+        constexpr void
+        bf_tls_set_exit_instr_len(bf_uint64_t const &val) noexcept
+        {
+            m_tls.at(TLS_OFFSET_EXIT_INSTR_LEN) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_instr_info
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_instr_info
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_instr_info() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_EXIT_INSTR_INFO);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.exit_instr_info (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.exit_instr_info to
+        ///
+        constexpr void
+        bf_tls_set_exit_instr_info(bf_uint64_t const &val) noexcept
+        {
+            m_tls.at(TLS_OFFSET_EXIT_INSTR_INFO) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.rip
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.rip
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_rip() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_RIP);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.rip and marks it as dirty so
+        ///     that the microkernel writes it back to the active VPS
+        ///     before the VPS is run again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.rip to
+        ///
+        constexpr void
+        bf_tls_set_rip(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            m_tls.at(TLS_OFFSET_RIP) = val;
+            m_tls.at(TLS_OFFSET_DIRTY) |= TLS_DIRTY_RIP;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.rsp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.rsp
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_rsp() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_RSP);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.rsp and marks it as dirty so
+        ///     that the microkernel writes it back to the active VPS
+        ///     before the VPS is run again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.rsp to
+        ///
+        constexpr void
+        bf_tls_set_rsp(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            m_tls.at(TLS_OFFSET_RSP) = val;
+            m_tls.at(TLS_OFFSET_DIRTY) |= TLS_DIRTY_RSP;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.rflags
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.rflags
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_rflags() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_RFLAGS);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.rflags and marks it as dirty so
+        ///     that the microkernel writes it back to the active VPS
+        ///     before the VPS is run again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.rflags to
+        ///
+        constexpr void
+        bf_tls_set_rflags(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            m_tls.at(TLS_OFFSET_RFLAGS) = val;
+            m_tls.at(TLS_OFFSET_DIRTY) |= TLS_DIRTY_RFLAGS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the exit information mask. Bit N of the mask
+        ///     tells the microkernel to share all of the VMExit
+        ///     information in the TLS block (and not just the exit reason
+        ///     and qualification) when the exit reason is N. Exit reasons
+        ///     of 64 or more always use bf_vps_op_read for the rest.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set the exit information mask to
+        ///
+        constexpr void
+        bf_tls_set_exit_info_mask(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            m_tls.at(TLS_OFFSET_EXIT_INFO_MASK) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the exit information mask (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the exit information mask
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_info_mask() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_EXIT_INFO_MASK);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.cr3
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.cr3
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_cr3() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_CR3);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.cr3 (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.cr3 to
+        ///
+        constexpr void
+        bf_tls_set_cr3(bf_uint64_t const &val) noexcept
+        {
+            m_tls.at(TLS_OFFSET_CR3) = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.dirty (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.dirty
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_dirty() const noexcept -> bf_uint64_t
+        {
+            return m_tls.at(TLS_OFFSET_DIRTY);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of tls.extid
         ///
@@ -1213,6 +1505,90 @@ namespace syscall
             m_bf_vps_op_write.at({vpsid, reg, value}) = errc;
         }
 
+        /// <!-- description -->
+        ///   @brief Reads a list of CPU registers from the VPS using a single
+        ///     syscall. Each entry is read using the same results that
+        ///     set_bf_vps_op_read provides to bf_vps_op_read.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to read from
+        ///   @param batch the list of registers to read
+        ///   @return Returns bsl::errc_success if every register was read,
+        ///     bsl::errc_failure otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vps_op_read_batch(
+            bf_uint16_t const &vpsid, bsl::span<bf_reg_batch_entry_t> const &batch) const noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely(!vpsid)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(batch.empty() || batch.size() > BF_REG_BATCH_MAX_ENTRIES)) {
+                bsl::error() << "invalid batch size\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            bsl::errc_type mut_ret{bsl::errc_success};
+            for (auto const elem : batch) {
+                auto const val{m_bf_vps_op_read.at({vpsid, elem.data->reg})};
+                if (bsl::unlikely(!val)) {
+                    elem.data->status = BF_STATUS_FAILURE_UNKNOWN.get();
+                    mut_ret = bsl::errc_failure;
+                    continue;
+                }
+
+                elem.data->val = val.get();
+                elem.data->status = BF_STATUS_SUCCESS.get();
+            }
+
+            return mut_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes a list of CPU registers in the VPS using a single
+        ///     syscall. Each entry is written using the same results that
+        ///     set_bf_vps_op_write provides to bf_vps_op_write.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to write to
+        ///   @param batch the list of registers and values to write
+        ///   @return Returns bsl::errc_success if every register was written,
+        ///     bsl::errc_failure otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vps_op_write_batch(
+            bf_uint16_t const &vpsid, bsl::span<bf_reg_batch_entry_t> const &batch) noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely(!vpsid)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(batch.empty() || batch.size() > BF_REG_BATCH_MAX_ENTRIES)) {
+                bsl::error() << "invalid batch size\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            bsl::errc_type mut_ret{bsl::errc_success};
+            for (auto const elem : batch) {
+                auto const ret{
+                    this->bf_vps_op_write(vpsid, elem.data->reg, bsl::to_u64(elem.data->val))};
+                if (bsl::unlikely(!ret)) {
+                    elem.data->status = BF_STATUS_FAILURE_UNKNOWN.get();
+                    mut_ret = bsl::errc_failure;
+                    continue;
+                }
+
+                elem.data->status = BF_STATUS_SUCCESS.get();
+            }
+
+            return mut_ret;
+        }
+
         /// <!-- description -->
         ///   @brief bf_vps_op_run tells the microkernel to execute a given VPS on
         ///     behalf of a given VP and VM. This system call only returns if an
@@ -1474,6 +1850,51 @@ namespace syscall
             m_bf_vps_op_clear_vps.at(vpsid) = errc;
         }
 
+        /// <!-- description -->
+        ///   @brief Replaces the exit filters of the VPS. While the VPS is
+        ///     running, the microkernel handles any VMExit that matches one
+        ///     of these filters itself, without calling the extension. An
+        ///     empty list removes all of the exit filters.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to set the exit filters for
+        ///   @param filters the list of exit filters to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vps_op_set_exit_filters(
+            bf_uint16_t const &vpsid, bsl::span<bf_exit_filter_t const> const &filters) noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely(!vpsid)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(filters.size() > BF_EXIT_FILTER_MAX_ENTRIES)) {
+                bsl::error() << "invalid number of exit filters\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            return m_bf_vps_op_set_exit_filters.at(vpsid);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_vps_op_set_exit_filters.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to set the exit filters for
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_vps_op_set_exit_filters
+        ///
+        constexpr void
+        set_bf_vps_op_set_exit_filters(bf_uint16_t const &vpsid, bsl::errc_type const errc) noexcept
+        {
+            m_bf_vps_op_set_exit_filters.at(vpsid) = errc;
+        }
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -2034,6 +2455,53 @@ namespace syscall
             return nullptr;
         }
 
+        /// <!-- description -->
+        ///   @brief bf_mem_op_map_direct maps a range of physical memory into
+        ///     the direct map of the VM that is currently active. Normally,
+        ///     the direct map is populated one page at a time each time a
+        ///     physical address is touched for the first time. This ABI can
+        ///     be used to pre-populate a range of the direct map in a single
+        ///     call. Both the physical address and the size must be page
+        ///     aligned, and any part of the range that is already mapped
+        ///     is skipped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param phys The physical address of the range to map
+        ///   @param size The number of bytes to map
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_map_direct(bf_uint64_t const &phys, bf_uint64_t const &size) noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely(!phys)) {
+                bsl::error() << "invalid phys\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(size.is_zero_or_invalid())) {
+                bsl::error() << "invalid size\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            return m_bf_mem_op_map_direct;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_mem_op_map_direct.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_mem_op_map_direct
+        ///
+        constexpr void
+        set_bf_mem_op_map_direct(bsl::errc_type const errc) noexcept
+        {
+            m_bf_mem_op_map_direct = errc;
+        }
+
         // ---------------------------------------------------------------------
         // direct map helpers
         // ---------------------------------------------------------------------
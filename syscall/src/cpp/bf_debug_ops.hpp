@@ -25,6 +25,7 @@
 #ifndef BF_DEBUG_OPS_HPP
 #define BF_DEBUG_OPS_HPP
 
+#include <bf_constants.hpp>
 #include <bf_syscall_impl.hpp>
 #include <bf_types.hpp>
 
@@ -206,6 +207,51 @@ namespace syscall
 
         bf_debug_op_dump_huge_pool_impl();
     }
+
+    /// <!-- description -->
+    ///   @brief This syscall returns the page pool's stats. Unlike
+    ///     bf_debug_op_dump_page_pool, which outputs a per-tag breakdown
+    ///     to the console, this syscall returns the totals to the caller
+    ///     so that they can be monitored programmatically.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_total returns the total size of the page pool in bytes
+    ///   @param mut_used returns the number of bytes currently allocated
+    ///   @param mut_hwm returns the most bytes that were ever allocated
+    ///   @param mut_fails returns the number of allocations that failed
+    ///   @return Returns BF_STATUS_SUCCESS on success, or an error code
+    ///     on failure.
+    ///
+    [[nodiscard]] constexpr auto
+    bf_debug_op_page_pool_stats(
+        bf_uint64_t &mut_total,
+        bf_uint64_t &mut_used,
+        bf_uint64_t &mut_hwm,
+        bf_uint64_t &mut_fails) noexcept -> bf_status_t
+    {
+        if (bsl::is_constant_evaluated()) {
+            return BF_STATUS_SUCCESS;
+        }
+
+        return bf_status_t{bf_debug_op_page_pool_stats_impl(
+            mut_total.data(), mut_used.data(), mut_hwm.data(), mut_fails.data())};
+    }
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to output the contention
+    ///     stats of each of its locks to the console device the microkernel
+    ///     is currently using for debugging. The stats are only recorded
+    ///     when the microkernel is compiled with HYPERVISOR_LOCK_STATS.
+    ///
+    constexpr void
+    bf_debug_op_dump_lock_stats() noexcept
+    {
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        bf_debug_op_dump_lock_stats_impl();
+    }
 }
 
 #endif
@@ -25,6 +25,8 @@
 #ifndef BF_SYSCALL_IMPL_HPP
 #define BF_SYSCALL_IMPL_HPP
 
+#include <bf_exit_filter_t.hpp>
+#include <bf_reg_batch_entry_t.hpp>
 #include <bf_reg_t.hpp>
 #include <bf_types.hpp>
 
@@ -277,6 +279,111 @@ namespace syscall
     ///
     extern "C" void bf_tls_set_r15_impl(bf_uint64_t::value_type const val) noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_seq.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_seq_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_reason.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_reason_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_qualification.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_qualification_impl() noexcept
+        -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_instr_len.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_instr_len_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_instr_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_instr_info_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_rip.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_rip_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_rsp.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_rsp_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_rflags.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_rflags_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_cr3.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_cr3_impl() noexcept -> bf_uint64_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_rip.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" void bf_tls_set_rip_impl(bf_uint64_t::value_type const val) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_rsp.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" void bf_tls_set_rsp_impl(bf_uint64_t::value_type const val) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_rflags.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" void bf_tls_set_rflags_impl(bf_uint64_t::value_type const val) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_set_exit_info_mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val n/a
+    ///
+    extern "C" void bf_tls_set_exit_info_mask_impl(bf_uint64_t::value_type const val) noexcept;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_tls_extid.
     ///
@@ -447,6 +554,27 @@ namespace syscall
     ///
     extern "C" void bf_debug_op_dump_huge_pool_impl() noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_page_pool_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_reg0_out n/a
+    ///   @param pmut_reg1_out n/a
+    ///   @param pmut_reg2_out n/a
+    ///   @param pmut_reg3_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_debug_op_page_pool_stats_impl(
+        bf_uint64_t::value_type *const pmut_reg0_out,
+        bf_uint64_t::value_type *const pmut_reg1_out,
+        bf_uint64_t::value_type *const pmut_reg2_out,
+        bf_uint64_t::value_type *const pmut_reg3_out) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_lock_stats.
+    ///
+    extern "C" void bf_debug_op_dump_lock_stats_impl() noexcept;
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -637,6 +765,38 @@ namespace syscall
         bf_reg_t const reg2_in,
         bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_read_batch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param pmut_reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vps_op_read_batch_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint16_t::value_type const reg1_in,
+        bf_reg_batch_entry_t *const pmut_reg2_in,
+        bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_write_batch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param pmut_reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vps_op_write_batch_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint16_t::value_type const reg1_in,
+        bf_reg_batch_entry_t *const pmut_reg2_in,
+        bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_vps_op_run.
     ///
@@ -711,6 +871,22 @@ namespace syscall
         bf_uint64_t::value_type const reg0_in, bf_uint16_t::value_type const reg1_in) noexcept
         -> bf_status_t::value_type;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_set_exit_filters.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vps_op_set_exit_filters_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint16_t::value_type const reg1_in,
+        bf_exit_filter_t const *const reg2_in,
+        bf_uint64_t::value_type const reg3_in) noexcept -> bf_status_t::value_type;
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -858,6 +1034,20 @@ namespace syscall
         bf_uint64_t::value_type const reg0_in,
         bf_uint64_t::value_type const reg1_in,
         void **const pmut_reg0_out) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_map_direct.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_mem_op_map_direct_impl(
+        bf_uint64_t::value_type const reg0_in,
+        bf_uint64_t::value_type const reg1_in,
+        bf_uint64_t::value_type const reg2_in) noexcept -> bf_status_t::value_type;
 }
 
 #endif
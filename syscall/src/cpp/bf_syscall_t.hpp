@@ -26,6 +26,8 @@
 #define BF_SYSCALL_T_HPP
 
 #include <bf_constants.hpp>
+#include <bf_exit_filter_t.hpp>
+#include <bf_reg_batch_entry_t.hpp>
 #include <bf_reg_t.hpp>
 #include <bf_syscall_impl.hpp>
 #include <bf_types.hpp>
@@ -35,6 +37,7 @@
 #include <bsl/finally_assert.hpp>
 #include <bsl/is_unsigned.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 #include <bsl/unlikely_assert.hpp>
 
@@ -609,6 +612,192 @@ namespace syscall
             bf_tls_set_r15_impl(val.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_seq
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_seq
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_exit_seq() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_exit_seq_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_reason
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_reason
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_exit_reason() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_exit_reason_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_qualification
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_qualification
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_exit_qualification() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_exit_qualification_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_instr_len
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_instr_len
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_exit_instr_len() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_exit_instr_len_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.exit_instr_info
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.exit_instr_info
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_exit_instr_info() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_exit_instr_info_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.rip
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.rip
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_rip() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_rip_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.rip and marks it as dirty so
+        ///     that the microkernel writes it back to the active VPS
+        ///     before the VPS is run again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.rip to
+        ///
+        static constexpr void
+        bf_tls_set_rip(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely_assert(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            bf_tls_set_rip_impl(val.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.rsp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.rsp
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_rsp() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_rsp_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.rsp and marks it as dirty so
+        ///     that the microkernel writes it back to the active VPS
+        ///     before the VPS is run again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.rsp to
+        ///
+        static constexpr void
+        bf_tls_set_rsp(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely_assert(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            bf_tls_set_rsp_impl(val.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.rflags
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.rflags
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_rflags() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_rflags_impl());
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of tls.rflags and marks it as dirty so
+        ///     that the microkernel writes it back to the active VPS
+        ///     before the VPS is run again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set tls.rflags to
+        ///
+        static constexpr void
+        bf_tls_set_rflags(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely_assert(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            bf_tls_set_rflags_impl(val.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the exit information mask. Bit N of the mask
+        ///     tells the microkernel to share all of the VMExit
+        ///     information in the TLS block (and not just the exit reason
+        ///     and qualification) when the exit reason is N. Exit reasons
+        ///     of 64 or more always use bf_vps_op_read for the rest.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val The value to set the exit information mask to
+        ///
+        static constexpr void
+        bf_tls_set_exit_info_mask(bf_uint64_t const &val) noexcept
+        {
+            if (bsl::unlikely_assert(!val)) {
+                bsl::alert() << "invalid val\n" << bsl::here();
+                return;
+            }
+
+            bf_tls_set_exit_info_mask_impl(val.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of tls.cr3
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of tls.cr3
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_cr3() noexcept -> bf_uint64_t
+        {
+            return bsl::to_u64(bf_tls_cr3_impl());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of tls.extid
         ///
@@ -1069,6 +1258,102 @@ namespace syscall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Reads a list of CPU registers from the VPS using a single
+        ///     syscall. The list must start at the beginning of a page that
+        ///     was allocated using bf_mem_op_alloc_page. On return, the val
+        ///     and status fields of each entry store the value that was read
+        ///     and the bf_status_t of that read. Note that the bf_reg_t is
+        ///     architecture specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to read from
+        ///   @param batch the list of registers to read
+        ///   @return Returns bsl::errc_success if every register was read,
+        ///     bsl::errc_failure otherwise, in which case the status of each
+        ///     entry describes which reads failed.
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vps_op_read_batch(
+            bf_uint16_t const &vpsid, bsl::span<bf_reg_batch_entry_t> const &batch) const noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(!vpsid)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(batch.empty() || batch.size() > BF_REG_BATCH_MAX_ENTRIES)) {
+                bsl::error() << "invalid batch size "    // --
+                             << batch.size()             // --
+                             << bsl::endl                // --
+                             << bsl::here();
+
+                return bsl::errc_invalid_argument;
+            }
+
+            bf_status_t::value_type const ret{bf_vps_op_read_batch_impl(
+                m_hndl.get(), vpsid.get(), batch.data(), batch.size().get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vps_op_read_batch failed with status "    // --
+                             << bsl::hex(ret)                                 // --
+                             << bsl::endl                                     // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes a list of CPU registers in the VPS using a single
+        ///     syscall. The list must start at the beginning of a page that
+        ///     was allocated using bf_mem_op_alloc_page. Registers are written
+        ///     in order, and on return, the status field of each entry stores
+        ///     the bf_status_t of that write. Note that the bf_reg_t is
+        ///     architecture specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to write to
+        ///   @param batch the list of registers and values to write
+        ///   @return Returns bsl::errc_success if every register was written,
+        ///     bsl::errc_failure otherwise, in which case the status of each
+        ///     entry describes which writes failed.
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vps_op_write_batch(
+            bf_uint16_t const &vpsid, bsl::span<bf_reg_batch_entry_t> const &batch) noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(!vpsid)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(batch.empty() || batch.size() > BF_REG_BATCH_MAX_ENTRIES)) {
+                bsl::error() << "invalid batch size "    // --
+                             << batch.size()             // --
+                             << bsl::endl                // --
+                             << bsl::here();
+
+                return bsl::errc_invalid_argument;
+            }
+
+            bf_status_t::value_type const ret{bf_vps_op_write_batch_impl(
+                m_hndl.get(), vpsid.get(), batch.data(), batch.size().get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vps_op_write_batch failed with status "    // --
+                             << bsl::hex(ret)                                  // --
+                             << bsl::endl                                      // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief bf_vps_op_run tells the microkernel to execute a given VPS on
         ///     behalf of a given VP and VM. This system call only returns if an
@@ -1298,6 +1583,55 @@ namespace syscall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Replaces the exit filters of the VPS. While the VPS is
+        ///     running, the microkernel handles any VMExit that matches one
+        ///     of these filters itself, without calling the extension. The
+        ///     list must start at the beginning of a page that was allocated
+        ///     using bf_mem_op_alloc_page, and is copied by the microkernel,
+        ///     so the page can be reused once this returns. An empty list
+        ///     removes all of the exit filters. Note that exit reasons and
+        ///     qualifications are architecture specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpsid The VPSID of the VPS to set the exit filters for
+        ///   @param filters the list of exit filters to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vps_op_set_exit_filters(
+            bf_uint16_t const &vpsid, bsl::span<bf_exit_filter_t const> const &filters) noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(!vpsid)) {
+                bsl::error() << "invalid vpsid\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely(filters.size() > BF_EXIT_FILTER_MAX_ENTRIES)) {
+                bsl::error() << "invalid number of exit filters "    // --
+                             << filters.size()                       // --
+                             << bsl::endl                            // --
+                             << bsl::here();
+
+                return bsl::errc_invalid_argument;
+            }
+
+            bf_status_t::value_type const ret{bf_vps_op_set_exit_filters_impl(
+                m_hndl.get(), vpsid.get(), filters.data(), filters.size().get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vps_op_set_exit_filters failed with status "    // --
+                             << bsl::hex(ret)                                       // --
+                             << bsl::endl                                           // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1746,6 +2080,50 @@ namespace syscall
             return pmut_mut_ptr;
         }
 
+        /// <!-- description -->
+        ///   @brief bf_mem_op_map_direct maps a range of physical memory into
+        ///     the direct map of the VM that is currently active. Normally,
+        ///     the direct map is populated one page at a time each time a
+        ///     physical address is touched for the first time. This ABI can
+        ///     be used to pre-populate a range of the direct map in a single
+        ///     call. Both the physical address and the size must be page
+        ///     aligned, and any part of the range that is already mapped
+        ///     is skipped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param phys The physical address of the range to map
+        ///   @param size The number of bytes to map
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_map_direct(bf_uint64_t const &phys, bf_uint64_t const &size) noexcept
+            -> bsl::errc_type
+        {
+            if (bsl::unlikely_assert(!phys)) {
+                bsl::error() << "invalid phys\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            if (bsl::unlikely_assert(size.is_zero_or_invalid())) {
+                bsl::error() << "invalid size\n" << bsl::here();
+                return bsl::errc_invalid_argument;
+            }
+
+            bf_status_t::value_type const ret{
+                bf_mem_op_map_direct_impl(m_hndl.get(), phys.get(), size.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_mem_op_map_direct failed with status "    // --
+                             << bsl::hex(ret)                                 // --
+                             << bsl::endl                                     // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // direct map helpers
         // ---------------------------------------------------------------------
@@ -27,6 +27,7 @@
 #include <bf_constants.hpp>
 #include <bf_types.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/ut.hpp>
 
 namespace syscall
@@ -265,6 +266,129 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_tls_exit_seq_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_seq") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_exit_seq_impl());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_reason_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_reason") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_exit_reason_impl());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_qualification_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_qualification") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_exit_qualification_impl());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_instr_len_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_instr_len") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_exit_instr_len_impl());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_instr_info_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_instr_info") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_exit_instr_info_impl());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rip_impl/bf_tls_set_rip_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    bf_tls_set_rip_impl(ANSWER64.get());
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_rip_impl());
+                        bsl::ut_check(TLS_DIRTY_RIP == g_mut_data.at("bf_tls_dirty"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rsp_impl/bf_tls_set_rsp_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    bf_tls_set_rsp_impl(ANSWER64.get());
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_rsp_impl());
+                        bsl::ut_check(TLS_DIRTY_RSP == g_mut_data.at("bf_tls_dirty"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rflags_impl/bf_tls_set_rflags_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    bf_tls_set_rflags_impl(ANSWER64.get());
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_rflags_impl());
+                        bsl::ut_check(TLS_DIRTY_RFLAGS == g_mut_data.at("bf_tls_dirty"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_set_exit_info_mask_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    bf_tls_set_exit_info_mask_impl(ANSWER64.get());
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == g_mut_data.at("bf_tls_exit_info_mask"));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_cr3_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_cr3") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_cr3_impl());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_tls_extid_impl"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -568,6 +692,103 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_debug_op_page_pool_stats_impl invalid args"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_uint64_t mut_reg_out{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_out{mut_reg_out.data()};
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN ==
+                            bf_debug_op_page_pool_stats_impl({}, pmut_out, pmut_out, pmut_out));
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN ==
+                            bf_debug_op_page_pool_stats_impl(pmut_out, {}, pmut_out, pmut_out));
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN ==
+                            bf_debug_op_page_pool_stats_impl(pmut_out, pmut_out, {}, pmut_out));
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN ==
+                            bf_debug_op_page_pool_stats_impl(pmut_out, pmut_out, pmut_out, {}));
+                        bsl::ut_check(mut_reg_out.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_page_pool_stats_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_uint64_t mut_reg0_out{};
+                bf_uint64_t mut_reg1_out{};
+                bf_uint64_t mut_reg2_out{};
+                bf_uint64_t mut_reg3_out{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_debug_op_page_pool_stats_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_debug_op_page_pool_stats_impl(
+                            mut_reg0_out.data(),
+                            mut_reg1_out.data(),
+                            mut_reg2_out.data(),
+                            mut_reg3_out.data())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(mut_reg0_out.is_zero());
+                        bsl::ut_check(mut_reg1_out.is_zero());
+                        bsl::ut_check(mut_reg2_out.is_zero());
+                        bsl::ut_check(mut_reg3_out.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_page_pool_stats_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_uint64_t mut_reg0_out{};
+                bf_uint64_t mut_reg1_out{};
+                bf_uint64_t mut_reg2_out{};
+                bf_uint64_t mut_reg3_out{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg0_out") =
+                        bsl::to_umax(ANSWER64);
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg1_out") =
+                        bsl::to_umax(ANSWER64);
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg2_out") =
+                        bsl::to_umax(ANSWER64);
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg3_out") =
+                        bsl::to_umax(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_debug_op_page_pool_stats_impl(
+                            mut_reg0_out.data(),
+                            mut_reg1_out.data(),
+                            mut_reg2_out.data(),
+                            mut_reg3_out.data())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(ANSWER64 == mut_reg0_out);
+                        bsl::ut_check(ANSWER64 == mut_reg1_out);
+                        bsl::ut_check(ANSWER64 == mut_reg2_out);
+                        bsl::ut_check(ANSWER64 == mut_reg3_out);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_dump_lock_stats_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_bf_debug_op_dump_lock_stats_impl_executed = {};
+                    bf_debug_op_dump_lock_stats_impl();
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_dump_lock_stats_impl_executed);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_callback_op_register_bootstrap_impl failure"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1003,6 +1224,108 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vps_op_read_batch_impl invalid arg2"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vps_op_read_batch_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vps_op_read_batch_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    g_mut_data.at("bf_vps_op_read_batch_impl_val") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vps_op_read_batch_impl(
+                            {}, {}, mut_entries.data(), mut_entries.size().get())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN == bsl::to_u64(mut_entries.back().status));
+                        bsl::ut_check(bsl::to_u64(mut_entries.back().val).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_vps_op_read_batch_impl_val") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vps_op_read_batch_impl(
+                            {}, {}, mut_entries.data(), mut_entries.size().get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(BF_STATUS_SUCCESS == bsl::to_u64(mut_entries.back().status));
+                        bsl::ut_check(ANSWER64 == bsl::to_u64(mut_entries.back().val));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch_impl invalid arg2"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vps_op_write_batch_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vps_op_write_batch_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    mut_entries.back().val = ANSWER64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vps_op_write_batch_impl(
+                            {}, {}, mut_entries.data(), mut_entries.size().get())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN == bsl::to_u64(mut_entries.back().status));
+                        bsl::ut_check(g_mut_data.at("bf_vps_op_write_batch_impl").is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    mut_entries.back().val = ANSWER64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vps_op_write_batch_impl(
+                            {}, {}, mut_entries.data(), mut_entries.size().get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(BF_STATUS_SUCCESS == bsl::to_u64(mut_entries.back().status));
+                        bsl::ut_check(g_mut_data.at("bf_vps_op_write_batch_impl") == ANSWER64);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vps_op_run_impl failure"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1166,6 +1489,63 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters_impl invalid arg2"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vps_op_set_exit_filters_impl({}, {}, {}, 1)};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vps_op_set_exit_filters_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vps_op_set_exit_filters_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bf_exit_filter_t, 2> mut_filters{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vps_op_set_exit_filters_impl(
+                            {}, {}, mut_filters.data(), mut_filters.size().get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(
+                            g_mut_data.at("bf_vps_op_set_exit_filters_impl") == mut_filters.size());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters_impl clear"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vps_op_set_exit_filters_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_intrinsic_op_rdmsr_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1569,6 +1949,35 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_map_direct_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_mem_op_map_direct_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_map_direct_impl({}, {}, ANSWER64.get())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(g_mut_data.at("bf_mem_op_map_direct_impl").is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_map_direct_impl({}, {}, ANSWER64.get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(g_mut_data.at("bf_mem_op_map_direct_impl") == ANSWER64);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
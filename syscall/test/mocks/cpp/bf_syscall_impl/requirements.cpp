@@ -74,6 +74,19 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_tls_r14_impl()));
             static_assert(noexcept(syscall::bf_tls_set_r15_impl({})));
             static_assert(noexcept(syscall::bf_tls_r15_impl()));
+            static_assert(noexcept(syscall::bf_tls_exit_seq_impl()));
+            static_assert(noexcept(syscall::bf_tls_exit_reason_impl()));
+            static_assert(noexcept(syscall::bf_tls_exit_qualification_impl()));
+            static_assert(noexcept(syscall::bf_tls_exit_instr_len_impl()));
+            static_assert(noexcept(syscall::bf_tls_exit_instr_info_impl()));
+            static_assert(noexcept(syscall::bf_tls_set_rip_impl({})));
+            static_assert(noexcept(syscall::bf_tls_rip_impl()));
+            static_assert(noexcept(syscall::bf_tls_set_rsp_impl({})));
+            static_assert(noexcept(syscall::bf_tls_rsp_impl()));
+            static_assert(noexcept(syscall::bf_tls_set_rflags_impl({})));
+            static_assert(noexcept(syscall::bf_tls_set_exit_info_mask_impl({})));
+            static_assert(noexcept(syscall::bf_tls_rflags_impl()));
+            static_assert(noexcept(syscall::bf_tls_cr3_impl()));
             static_assert(noexcept(syscall::bf_tls_extid_impl()));
             static_assert(noexcept(syscall::bf_tls_vmid_impl()));
             static_assert(noexcept(syscall::bf_tls_vpid_impl()));
@@ -95,6 +108,8 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_debug_op_dump_ext_impl({})));
             static_assert(noexcept(syscall::bf_debug_op_dump_page_pool_impl()));
             static_assert(noexcept(syscall::bf_debug_op_dump_huge_pool_impl()));
+            static_assert(noexcept(syscall::bf_debug_op_page_pool_stats_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_debug_op_dump_lock_stats_impl()));
             static_assert(noexcept(syscall::bf_callback_op_register_bootstrap_impl({}, {})));
             static_assert(noexcept(syscall::bf_callback_op_register_vmexit_impl({}, {})));
             static_assert(noexcept(syscall::bf_callback_op_register_fail_impl({}, {})));
@@ -108,12 +123,15 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_vps_op_init_as_root_impl({}, {})));
             static_assert(noexcept(syscall::bf_vps_op_read_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vps_op_write_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_vps_op_read_batch_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_vps_op_write_batch_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vps_op_run_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vps_op_run_current_impl({})));
             static_assert(noexcept(syscall::bf_vps_op_advance_ip_impl({}, {})));
             static_assert(noexcept(syscall::bf_vps_op_advance_ip_and_run_current_impl({})));
             static_assert(noexcept(syscall::bf_vps_op_promote_impl({}, {})));
             static_assert(noexcept(syscall::bf_vps_op_clear_vps_impl({}, {})));
+            static_assert(noexcept(syscall::bf_vps_op_set_exit_filters_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_rdmsr_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_wrmsr_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_invlpga_impl({}, {}, {})));
@@ -124,6 +142,7 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_mem_op_alloc_huge_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_mem_op_free_huge_impl({}, {})));
             static_assert(noexcept(syscall::bf_mem_op_alloc_heap_impl({}, {}, {})));
+            static_assert(noexcept(syscall::bf_mem_op_map_direct_impl({}, {}, {})));
         };
     };
 
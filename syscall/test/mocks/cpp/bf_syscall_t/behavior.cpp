@@ -24,7 +24,9 @@
 
 #include "../../../../mocks/cpp/bf_syscall_t.hpp"
 
+#include <bsl/array.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/span.hpp>
 #include <bsl/ut.hpp>
 
 namespace syscall
@@ -565,6 +567,201 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_tls_exit_seq/bf_tls_set_exit_seq"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_seq());
+                        bsl::ut_check(mut_sys.bf_tls_exit_seq().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_seq(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_seq() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_reason/bf_tls_set_exit_reason"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_reason());
+                        bsl::ut_check(mut_sys.bf_tls_exit_reason().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_reason(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_reason() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_qualification"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_qualification());
+                        bsl::ut_check(mut_sys.bf_tls_exit_qualification().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_qualification(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_qualification() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_instr_len/bf_tls_set_exit_instr_len"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_len());
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_len().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_instr_len(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_len() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_instr_info/bf_tls_set_exit_instr_info"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_info());
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_info().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_instr_info(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_info() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rip/bf_tls_set_rip"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rip());
+                        bsl::ut_check(mut_sys.bf_tls_rip().is_zero());
+                        bsl::ut_check(mut_sys.bf_tls_dirty().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_rip(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rip() == ANSWER64);
+                        bsl::ut_check(mut_sys.bf_tls_dirty() == TLS_DIRTY_RIP);
+                    };
+
+                    mut_sys.bf_tls_set_rip(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rip() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rsp/bf_tls_set_rsp"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rsp());
+                        bsl::ut_check(mut_sys.bf_tls_rsp().is_zero());
+                        bsl::ut_check(mut_sys.bf_tls_dirty().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_rsp(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rsp() == ANSWER64);
+                        bsl::ut_check(mut_sys.bf_tls_dirty() == TLS_DIRTY_RSP);
+                    };
+
+                    mut_sys.bf_tls_set_rsp(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rsp() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rflags/bf_tls_set_rflags"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rflags());
+                        bsl::ut_check(mut_sys.bf_tls_rflags().is_zero());
+                        bsl::ut_check(mut_sys.bf_tls_dirty().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_rflags(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rflags() == ANSWER64);
+                        bsl::ut_check(mut_sys.bf_tls_dirty() == TLS_DIRTY_RFLAGS);
+                    };
+
+                    mut_sys.bf_tls_set_rflags(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rflags() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_set_exit_info_mask"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info_mask().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_info_mask(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info_mask() == ANSWER64);
+                    };
+
+                    mut_sys.bf_tls_set_exit_info_mask(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info_mask() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_cr3/bf_tls_set_cr3"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_cr3());
+                        bsl::ut_check(mut_sys.bf_tls_cr3().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_cr3(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_cr3() == ANSWER64);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_tls_extid/bf_tls_set_extid"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1074,6 +1271,117 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vps_op_read_batch invalid args"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{bf_uint16_t::failure()};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                    bsl::ut_check(!mut_sys.bf_vps_op_read_batch({}, {}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch reports errors per entry"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bf_reg_t const reg0{bf_reg_t::bf_reg_t_rax};
+                bf_reg_t const reg1{bf_reg_t::bf_reg_t_rbx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_entries.front().reg = reg0;
+                    mut_entries.back().reg = reg1;
+                    mut_sys.set_bf_vps_op_read(arg0, reg0, ANSWER64);
+                    mut_sys.set_bf_vps_op_read(arg0, reg1, bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                        bsl::ut_check(bsl::to_u64(mut_entries.front().val) == ANSWER64);
+                        bsl::ut_check(bsl::to_u64(mut_entries.front().status) == BF_STATUS_SUCCESS);
+                        bsl::ut_check(bsl::to_u64(mut_entries.back().status) != BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vps_op_read(arg0, {}, ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                        for (auto const elem : arg1) {
+                            bsl::ut_check(bsl::to_u64(elem.data->val) == ANSWER64);
+                            bsl::ut_check(bsl::to_u64(elem.data->status) == BF_STATUS_SUCCESS);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch invalid args"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{bf_uint16_t::failure()};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                    bsl::ut_check(!mut_sys.bf_vps_op_write_batch({}, {}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch reports errors per entry"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bf_reg_t const reg0{bf_reg_t::bf_reg_t_rax};
+                bf_reg_t const reg1{bf_reg_t::bf_reg_t_rbx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_entries.front().reg = reg0;
+                    mut_entries.front().val = ANSWER64.get();
+                    mut_entries.back().reg = reg1;
+                    mut_entries.back().val = ANSWER64.get();
+                    mut_sys.set_bf_vps_op_write(arg0, reg1, ANSWER64, bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                        bsl::ut_check(bsl::to_u64(mut_entries.front().status) == BF_STATUS_SUCCESS);
+                        bsl::ut_check(bsl::to_u64(mut_entries.back().status) != BF_STATUS_SUCCESS);
+                        bsl::ut_check(mut_sys.bf_vps_op_read(arg0, reg0) == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_entries.back().val = ANSWER64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                        bsl::ut_check(mut_sys.bf_vps_op_read(arg0, {}) == ANSWER64);
+                        for (auto const elem : arg1) {
+                            bsl::ut_check(bsl::to_u64(elem.data->status) == BF_STATUS_SUCCESS);
+                        }
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vps_op_run invalid arg0"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1280,6 +1588,47 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters invalid args"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{bf_uint16_t::failure()};
+                bsl::array<bf_exit_filter_t, BF_EXIT_FILTER_MAX_ENTRIES.get() + 1> mut_filters{};
+                bsl::span<bf_exit_filter_t const> const arg1{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_sys.bf_vps_op_set_exit_filters(arg0, {}));
+                    bsl::ut_check(!mut_sys.bf_vps_op_set_exit_filters({}, arg1));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters bf_vps_op_set_exit_filters_impl fails"} =
+            []() noexcept {
+                bsl::ut_given{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bf_uint16_t const arg0{};
+                    bsl::ut_when{} = [&]() noexcept {
+                        mut_sys.set_bf_vps_op_set_exit_filters(arg0, bsl::errc_failure);
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(!mut_sys.bf_vps_op_set_exit_filters(arg0, {}));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_exit_filter_t, 2> mut_filters{};
+                bsl::span<bf_exit_filter_t const> const arg1{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_sys.bf_vps_op_set_exit_filters(arg0, arg1));
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1727,6 +2076,50 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_map_direct invalid phys"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{bf_uint64_t::failure()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, ANSWER64));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct invalid size"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, {}));
+                    bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, bf_uint64_t::failure()));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct failure"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_mem_op_map_direct(bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, ANSWER64));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_sys.bf_mem_op_map_direct(phys, ANSWER64));
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // direct map helpers
         // ---------------------------------------------------------------------
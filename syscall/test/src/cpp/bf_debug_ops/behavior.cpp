@@ -24,6 +24,7 @@
 
 #include "../../../../src/cpp/bf_debug_ops.hpp"
 
+#include <bsl/convert.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/ut.hpp>
 
@@ -161,6 +162,75 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_debug_op_page_pool_stats failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_uint64_t mut_total{};
+                bf_uint64_t mut_used{};
+                bf_uint64_t mut_hwm{};
+                bf_uint64_t mut_fails{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_debug_op_page_pool_stats_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            BF_STATUS_FAILURE_UNKNOWN ==
+                            bf_debug_op_page_pool_stats(mut_total, mut_used, mut_hwm, mut_fails));
+                        bsl::ut_check(mut_total.is_zero());
+                        bsl::ut_check(mut_used.is_zero());
+                        bsl::ut_check(mut_hwm.is_zero());
+                        bsl::ut_check(mut_fails.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_page_pool_stats success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_uint64_t mut_total{};
+                bf_uint64_t mut_used{};
+                bf_uint64_t mut_hwm{};
+                bf_uint64_t mut_fails{};
+                constexpr auto total{0x4000_u64};
+                constexpr auto used{0x2000_u64};
+                constexpr auto hwm{0x3000_u64};
+                constexpr auto fails{0x1_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg0_out") =
+                        bsl::to_umax(total);
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg1_out") =
+                        bsl::to_umax(used);
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg2_out") =
+                        bsl::to_umax(hwm);
+                    g_mut_data.at("bf_debug_op_page_pool_stats_impl_reg3_out") =
+                        bsl::to_umax(fails);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            BF_STATUS_SUCCESS ==
+                            bf_debug_op_page_pool_stats(mut_total, mut_used, mut_hwm, mut_fails));
+                        bsl::ut_check(total == mut_total);
+                        bsl::ut_check(used == mut_used);
+                        bsl::ut_check(hwm == mut_hwm);
+                        bsl::ut_check(fails == mut_fails);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_dump_lock_stats"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                g_mut_bf_debug_op_dump_lock_stats_impl_executed = {};
+                bsl::ut_when{} = []() noexcept {
+                    bf_debug_op_dump_lock_stats();
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_dump_lock_stats_impl_executed);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
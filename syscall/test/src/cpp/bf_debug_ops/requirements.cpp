@@ -40,17 +40,23 @@ main() noexcept -> bsl::exit_code
     bsl::enable_color();
 
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
-        bsl::ut_then{} = []() noexcept {
-            static_assert(noexcept(syscall::bf_debug_op_out({}, {})));
-            static_assert(noexcept(syscall::bf_debug_op_dump_vm({})));
-            static_assert(noexcept(syscall::bf_debug_op_dump_vp({})));
-            static_assert(noexcept(syscall::bf_debug_op_dump_vps({})));
-            static_assert(noexcept(syscall::bf_debug_op_dump_vmexit_log({})));
-            static_assert(noexcept(syscall::bf_debug_op_write_c({})));
-            static_assert(noexcept(syscall::bf_debug_op_write_str({})));
-            static_assert(noexcept(syscall::bf_debug_op_dump_ext({})));
-            static_assert(noexcept(syscall::bf_debug_op_dump_page_pool()));
-            static_assert(noexcept(syscall::bf_debug_op_dump_huge_pool()));
+        bsl::ut_given{} = []() noexcept {
+            syscall::bf_uint64_t mut_val{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(syscall::bf_debug_op_out({}, {})));
+                static_assert(noexcept(syscall::bf_debug_op_dump_vm({})));
+                static_assert(noexcept(syscall::bf_debug_op_dump_vp({})));
+                static_assert(noexcept(syscall::bf_debug_op_dump_vps({})));
+                static_assert(noexcept(syscall::bf_debug_op_dump_vmexit_log({})));
+                static_assert(noexcept(syscall::bf_debug_op_write_c({})));
+                static_assert(noexcept(syscall::bf_debug_op_write_str({})));
+                static_assert(noexcept(syscall::bf_debug_op_dump_ext({})));
+                static_assert(noexcept(syscall::bf_debug_op_dump_page_pool()));
+                static_assert(noexcept(syscall::bf_debug_op_dump_huge_pool()));
+                static_assert(noexcept(
+                    syscall::bf_debug_op_page_pool_stats(mut_val, mut_val, mut_val, mut_val)));
+                static_assert(noexcept(syscall::bf_debug_op_dump_lock_stats()));
+            };
         };
     };
 
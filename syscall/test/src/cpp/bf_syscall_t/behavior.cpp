@@ -27,7 +27,9 @@
 #include <string>
 #include <unordered_map>
 
+#include <bsl/array.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/span.hpp>
 #include <bsl/ut.hpp>
 
 namespace syscall
@@ -625,6 +627,178 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_tls_exit_seq"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_seq") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_seq() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_reason"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_reason") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_reason() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_qualification"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_qualification") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_qualification() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_instr_len"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_instr_len") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_len() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_exit_instr_info"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_instr_info") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_instr_info() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rip/bf_tls_set_rip"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rip());
+                        bsl::ut_check(mut_sys.bf_tls_rip().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_rip(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rip() == ANSWER64);
+                        bsl::ut_check(g_mut_data.at("bf_tls_dirty") == TLS_DIRTY_RIP);
+                    };
+
+                    mut_sys.bf_tls_set_rip(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rip() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rsp/bf_tls_set_rsp"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rsp());
+                        bsl::ut_check(mut_sys.bf_tls_rsp().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_rsp(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rsp() == ANSWER64);
+                        bsl::ut_check(g_mut_data.at("bf_tls_dirty") == TLS_DIRTY_RSP);
+                    };
+
+                    mut_sys.bf_tls_set_rsp(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rsp() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_rflags/bf_tls_set_rflags"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rflags());
+                        bsl::ut_check(mut_sys.bf_tls_rflags().is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_rflags(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rflags() == ANSWER64);
+                        bsl::ut_check(g_mut_data.at("bf_tls_dirty") == TLS_DIRTY_RFLAGS);
+                    };
+
+                    mut_sys.bf_tls_set_rflags(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_rflags() == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_set_exit_info_mask"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+
+                    mut_sys.bf_tls_set_exit_info_mask(ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_data.at("bf_tls_exit_info_mask") == ANSWER64);
+                    };
+
+                    mut_sys.bf_tls_set_exit_info_mask(bf_uint64_t::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_data.at("bf_tls_exit_info_mask") == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_tls_cr3"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_cr3") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_cr3() == ANSWER64);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_tls_extid/bf_tls_set_extid"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1243,6 +1417,156 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vps_op_read_batch invalid arg0"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{bf_uint16_t::failure()};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch invalid arg1"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, BF_REG_BATCH_MAX_ENTRIES.get() + 1> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_read_batch(arg0, {}));
+                        bsl::ut_check(!mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch bf_vps_op_read_batch_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vps_op_read_batch_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                        for (auto const elem : arg1) {
+                            bsl::ut_check(
+                                bsl::to_u64(elem.data->status) == BF_STATUS_FAILURE_UNKNOWN);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_read_batch success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_vps_op_read_batch_impl_val") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vps_op_read_batch(arg0, arg1));
+                        for (auto const elem : arg1) {
+                            bsl::ut_check(bsl::to_u64(elem.data->val) == ANSWER64);
+                            bsl::ut_check(bsl::to_u64(elem.data->status) == BF_STATUS_SUCCESS);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch invalid arg0"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{bf_uint16_t::failure()};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch invalid arg1"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, BF_REG_BATCH_MAX_ENTRIES.get() + 1> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_write_batch(arg0, {}));
+                        bsl::ut_check(!mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch bf_vps_op_write_batch_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vps_op_write_batch_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                        for (auto const elem : arg1) {
+                            bsl::ut_check(
+                                bsl::to_u64(elem.data->status) == BF_STATUS_FAILURE_UNKNOWN);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_write_batch success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_reg_batch_entry_t, 2> mut_entries{};
+                bsl::span<bf_reg_batch_entry_t> const arg1{mut_entries.data(), mut_entries.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    mut_entries.back().val = ANSWER64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vps_op_write_batch(arg0, arg1));
+                        bsl::ut_check(g_mut_data.at("bf_vps_op_write_batch_impl") == ANSWER64);
+                        for (auto const elem : arg1) {
+                            bsl::ut_check(bsl::to_u64(elem.data->status) == BF_STATUS_SUCCESS);
+                        }
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vps_op_run invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1492,6 +1816,73 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters invalid arg0"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{bf_uint16_t::failure()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_set_exit_filters(arg0, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters invalid arg1"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_exit_filter_t, BF_EXIT_FILTER_MAX_ENTRIES.get() + 1> mut_filters{};
+                bsl::span<bf_exit_filter_t const> const arg1{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vps_op_set_exit_filters(arg0, arg1));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters bf_vps_op_set_exit_filters_impl fails"} =
+            []() noexcept {
+                bsl::ut_given_at_runtime{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bf_uint16_t const arg0{};
+                    bsl::ut_when{} = [&]() noexcept {
+                        g_mut_errc.clear();
+                        g_mut_data.clear();
+                        g_mut_errc.at("bf_vps_op_set_exit_filters_impl") =
+                            BF_STATUS_FAILURE_UNKNOWN;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(!mut_sys.bf_vps_op_set_exit_filters(arg0, {}));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vps_op_set_exit_filters success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint16_t const arg0{};
+                bsl::array<bf_exit_filter_t, 2> mut_filters{};
+                bsl::span<bf_exit_filter_t const> const arg1{
+                    mut_filters.data(), mut_filters.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vps_op_set_exit_filters(arg0, arg1));
+                        bsl::ut_check(
+                            g_mut_data.at("bf_vps_op_set_exit_filters_impl") == mut_filters.size());
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -2065,6 +2456,69 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_map_direct invalid phys"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{bf_uint64_t::failure()};
+                bf_uint64_t const size{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, size));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct invalid size"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, {}));
+                        bsl::ut_check(
+                            !mut_sys.bf_mem_op_map_direct(phys, bf_uint64_t::failure()));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct bf_mem_op_map_direct_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{};
+                bf_uint64_t const size{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_mem_op_map_direct_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_map_direct(phys, size));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_map_direct success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_uint64_t const phys{};
+                bf_uint64_t const size{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_mem_op_map_direct(phys, size));
+                        bsl::ut_check(g_mut_data.at("bf_mem_op_map_direct_impl") == size);
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // direct map helpers
         // ---------------------------------------------------------------------
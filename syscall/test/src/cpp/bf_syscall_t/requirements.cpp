@@ -87,6 +87,19 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_tls_set_r14({})));
                 static_assert(noexcept(mut_sys.bf_tls_r15()));
                 static_assert(noexcept(mut_sys.bf_tls_set_r15({})));
+                static_assert(noexcept(mut_sys.bf_tls_exit_seq()));
+                static_assert(noexcept(mut_sys.bf_tls_exit_reason()));
+                static_assert(noexcept(mut_sys.bf_tls_exit_qualification()));
+                static_assert(noexcept(mut_sys.bf_tls_exit_instr_len()));
+                static_assert(noexcept(mut_sys.bf_tls_exit_instr_info()));
+                static_assert(noexcept(mut_sys.bf_tls_rip()));
+                static_assert(noexcept(mut_sys.bf_tls_set_rip({})));
+                static_assert(noexcept(mut_sys.bf_tls_rsp()));
+                static_assert(noexcept(mut_sys.bf_tls_set_rsp({})));
+                static_assert(noexcept(mut_sys.bf_tls_rflags()));
+                static_assert(noexcept(mut_sys.bf_tls_set_rflags({})));
+                static_assert(noexcept(mut_sys.bf_tls_set_exit_info_mask({})));
+                static_assert(noexcept(mut_sys.bf_tls_cr3()));
                 static_assert(noexcept(mut_sys.bf_tls_extid()));
                 static_assert(noexcept(mut_sys.bf_tls_vmid()));
                 static_assert(noexcept(mut_sys.bf_tls_vpid()));
@@ -103,12 +116,15 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_vps_op_init_as_root({})));
                 static_assert(noexcept(mut_sys.bf_vps_op_read({}, {})));
                 static_assert(noexcept(mut_sys.bf_vps_op_write({}, {}, {})));
+                static_assert(noexcept(mut_sys.bf_vps_op_read_batch({}, {})));
+                static_assert(noexcept(mut_sys.bf_vps_op_write_batch({}, {})));
                 static_assert(noexcept(mut_sys.bf_vps_op_run({}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vps_op_run_current()));
                 static_assert(noexcept(mut_sys.bf_vps_op_advance_ip({})));
                 static_assert(noexcept(mut_sys.bf_vps_op_advance_ip_and_run_current()));
                 static_assert(noexcept(mut_sys.bf_vps_op_promote({})));
                 static_assert(noexcept(mut_sys.bf_vps_op_clear_vps({})));
+                static_assert(noexcept(mut_sys.bf_vps_op_set_exit_filters({}, {})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_rdmsr({})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_wrmsr({}, {})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_invlpga({}, {})));
@@ -121,6 +137,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_huge({})));
                 static_assert(noexcept(mut_sys.bf_mem_op_free_huge({})));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_heap({})));
+                static_assert(noexcept(mut_sys.bf_mem_op_map_direct({}, {})));
                 static_assert(noexcept(mut_sys.bf_read_phys({})));
                 static_assert(noexcept(mut_sys.bf_write_phys({}, {})));
 
@@ -154,6 +171,19 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(sys.bf_tls_set_r14({})));
                 static_assert(noexcept(sys.bf_tls_r15()));
                 static_assert(noexcept(sys.bf_tls_set_r15({})));
+                static_assert(noexcept(sys.bf_tls_exit_seq()));
+                static_assert(noexcept(sys.bf_tls_exit_reason()));
+                static_assert(noexcept(sys.bf_tls_exit_qualification()));
+                static_assert(noexcept(sys.bf_tls_exit_instr_len()));
+                static_assert(noexcept(sys.bf_tls_exit_instr_info()));
+                static_assert(noexcept(sys.bf_tls_rip()));
+                static_assert(noexcept(sys.bf_tls_set_rip({})));
+                static_assert(noexcept(sys.bf_tls_rsp()));
+                static_assert(noexcept(sys.bf_tls_set_rsp({})));
+                static_assert(noexcept(sys.bf_tls_rflags()));
+                static_assert(noexcept(sys.bf_tls_set_rflags({})));
+                static_assert(noexcept(sys.bf_tls_set_exit_info_mask({})));
+                static_assert(noexcept(sys.bf_tls_cr3()));
                 static_assert(noexcept(sys.bf_tls_extid()));
                 static_assert(noexcept(sys.bf_tls_vmid()));
                 static_assert(noexcept(sys.bf_tls_vpid()));
@@ -161,6 +191,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(sys.bf_tls_ppid()));
                 static_assert(noexcept(sys.bf_tls_online_pps()));
                 static_assert(noexcept(sys.bf_vps_op_read({}, {})));
+                static_assert(noexcept(sys.bf_vps_op_read_batch({}, {})));
                 static_assert(noexcept(sys.bf_intrinsic_op_rdmsr({})));
                 static_assert(noexcept(sys.bf_read_phys({})));
             };
@@ -31,6 +31,8 @@
 #include <loader_platform_interface.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <trace_ring_t.hpp>
+#include <trace_vmm_args_t.hpp>
 
 #include <bsl/arguments.hpp>
 #include <bsl/array.hpp>
@@ -55,7 +57,8 @@ namespace vmmctl
     ///   @brief Provides the main implementation of the vmmctl application.
     ///     This application is used to start and stop the VMM as well as
     ///     to dump the contents of the VMM's internal debug ring to the
-    ///     console for debugging.
+    ///     console for debugging, and to control and export the VMM's
+    ///     trace rings.
     ///
     class vmmctl_main final
     {
@@ -68,7 +71,9 @@ namespace vmmctl
         /// @brief stores the arguments for stopping the VMM.
         loader::stop_vmm_args_t m_stop_vmm_ctl_args{IOCTL_VERSION.get()};
         /// @brief stores the arguments for dumping the VMM.
-        loader::dump_vmm_args_t m_dump_vmm_ctl_args{IOCTL_VERSION.get(), {}};
+        loader::dump_vmm_args_t m_dump_vmm_ctl_args{IOCTL_VERSION.get(), {}, {}, {}};
+        /// @brief stores the arguments for tracing the VMM.
+        loader::trace_vmm_args_t m_trace_vmm_ctl_args{IOCTL_VERSION.get(), {}, {}, {}, {}};
 
         /// <!-- description -->
         ///   @brief Displays the help menu for vmmctl
@@ -79,9 +84,15 @@ namespace vmmctl
             bsl::print() << "Usage: vmmctl start microkernel ext1 <ext2> ..." << bsl::endl;
             bsl::print() << "  or:  vmmctl stop" << bsl::endl;
             bsl::print() << "  or:  vmmctl dump" << bsl::endl;
+            bsl::print() << "  or:  vmmctl trace start <event1> <event2> ..." << bsl::endl;
+            bsl::print() << "  or:  vmmctl trace stop" << bsl::endl;
+            bsl::print() << "  or:  vmmctl trace json|csv" << bsl::endl;
             bsl::print() << bsl::endl;
             bsl::print() << "A utility for managing the Bareflank Hypervisor's VMM";
             bsl::print() << bsl::endl;
+            bsl::print() << bsl::endl;
+            bsl::print() << "Trace events (all are traced if none are given):" << bsl::endl;
+            bsl::print() << "  vmexit, vmentry, syscall, ext, page_fault, lock" << bsl::endl;
         }
 
         /// <!-- description -->
@@ -181,7 +192,9 @@ namespace vmmctl
 
         /// <!-- description -->
         ///   @brief Dumps the VMM given a set of ioctl arguments to send
-        ///     to the loader.
+        ///     to the loader. Each PP has its own debug ring, which the
+        ///     loader merges in time order and returns one chunk at a time,
+        ///     so the loader is asked for chunks until none remain.
         ///
         /// <!-- inputs/outputs -->
         ///   @param pmut_ctl_args the command line arguments provided by the user.
@@ -201,37 +214,312 @@ namespace vmmctl
                 return bsl::exit_failure;
             }
 
-            bsl::safe_uintmax mut_epos{pmut_ctl_args->debug_ring.epos};
-            bsl::safe_uintmax mut_spos{pmut_ctl_args->debug_ring.spos};
+            constexpr auto zero{0_umax};
+            if (zero == bsl::to_umax(pmut_ctl_args->len)) {
+                bsl::alert() << "no debug data to dump\n";
+                return bsl::exit_success;
+            }
+
+            while (zero != bsl::to_umax(pmut_ctl_args->len)) {
+                auto const len{bsl::to_umax(pmut_ctl_args->len)};
+                for (bsl::safe_uintmax mut_i{}; mut_i < len; ++mut_i) {
+                    auto const *const c{pmut_ctl_args->buf.at_if(mut_i)};
+                    if (bsl::unlikely(nullptr == c)) {
+                        break;
+                    }
+
+                    bsl::print() << *c;
+                }
+
+                bsl::exit_code const next{
+                    this->read_write_data(loader::DUMP_VMM, ctl, pmut_ctl_args)};
+                if (bsl::unlikely(bsl::exit_success != next)) {
+                    return bsl::exit_failure;
+                }
+            }
+
+            bsl::print() << bsl::endl;
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the name of the provided trace event.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param event the TRACE_EVENT_xxx to get the name of
+        ///   @return Returns the name of the provided trace event.
+        ///
+        [[nodiscard]] static constexpr auto
+        trace_event_name(bsl::safe_uintmax const &event) noexcept -> bsl::string_view
+        {
+            if (loader::TRACE_EVENT_VMEXIT == event) {
+                return "vmexit";
+            }
+
+            if (loader::TRACE_EVENT_VMENTRY == event) {
+                return "vmentry";
+            }
+
+            if (loader::TRACE_EVENT_SYSCALL_ENTRY == event) {
+                return "syscall_entry";
+            }
+
+            if (loader::TRACE_EVENT_SYSCALL_EXIT == event) {
+                return "syscall_exit";
+            }
+
+            if (loader::TRACE_EVENT_EXT_CALL == event) {
+                return "ext_call";
+            }
+
+            if (loader::TRACE_EVENT_EXT_RETURN == event) {
+                return "ext_return";
+            }
+
+            if (loader::TRACE_EVENT_PAGE_FAULT == event) {
+                return "page_fault";
+            }
+
+            if (loader::TRACE_EVENT_LOCK_CONTENTION == event) {
+                return "lock_contention";
+            }
+
+            return "unknown";
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts the event names provided by the user into the
+        ///     mask of events that the microkernel should trace. If no event
+        ///     names are provided, every event is traced.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_args the user provided arguments
+        ///   @param mut_mask the resulting mask of events to trace
+        ///   @return Returns bsl::errc_success if all of the provided event
+        ///     names are valid, otherwise returns bsl::errc_failure.
+        ///
+        [[nodiscard]] static constexpr auto
+        make_trace_mask(bsl::arguments &mut_args, bsl::safe_uintmax &mut_mask) noexcept
+            -> bsl::errc_type
+        {
+            constexpr auto one{1_umax};
+
+            if (!mut_args) {
+                mut_mask = (one << loader::TRACE_EVENT_MAX) - one;
+                return bsl::errc_success;
+            }
+
+            mut_mask = {};
+            while (mut_args) {
+                auto const name{mut_args.front<bsl::string_view>()};
+                if (name == "vmexit") {
+                    mut_mask |= one << loader::TRACE_EVENT_VMEXIT;
+                }
+                else if (name == "vmentry") {
+                    mut_mask |= one << loader::TRACE_EVENT_VMENTRY;
+                }
+                else if (name == "syscall") {
+                    mut_mask |= one << loader::TRACE_EVENT_SYSCALL_ENTRY;
+                    mut_mask |= one << loader::TRACE_EVENT_SYSCALL_EXIT;
+                }
+                else if (name == "ext") {
+                    mut_mask |= one << loader::TRACE_EVENT_EXT_CALL;
+                    mut_mask |= one << loader::TRACE_EVENT_EXT_RETURN;
+                }
+                else if (name == "page_fault") {
+                    mut_mask |= one << loader::TRACE_EVENT_PAGE_FAULT;
+                }
+                else if (name == "lock") {
+                    mut_mask |= one << loader::TRACE_EVENT_LOCK_CONTENTION;
+                }
+                else {
+                    bsl::error() << "invalid trace event: \"" << name << "\"\n";
+                    return bsl::errc_failure;
+                }
+
+                ++mut_args;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a single trace record as either a Chrome trace
+        ///     event (which can be loaded into chrome://tracing or Perfetto)
+        ///     or a line of CSV. Each PP is given its own track. Note that
+        ///     the timestamps are in TSC ticks and not microseconds.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP that recorded the trace record
+        ///   @param rec the trace record to output
+        ///   @param json true to output JSON, false to output CSV
+        ///   @param first true if this is the first JSON trace event
+        ///
+        static constexpr void
+        print_trace_record(
+            bsl::safe_uintmax const &ppid,
+            loader::trace_record_t const &rec,
+            bool const json,
+            bool const first) noexcept
+        {
+            auto const name{trace_event_name(bsl::to_umax(rec.event))};
+            auto const vpsid{bsl::to_umax(rec.vpsid)};
+            auto const tsc{bsl::to_umax(rec.tsc)};
+
+            if (!json) {
+                bsl::print() << ppid << ',' << name << ',' << tsc << ',' << vpsid << ',';
+                bsl::print() << bsl::hex(rec.data0) << ',' << bsl::hex(rec.data1) << bsl::endl;
+                return;
+            }
 
-            if (!(pmut_ctl_args->debug_ring.buf.size() > mut_epos)) {
-                mut_epos = {};
+            if (!first) {
+                bsl::print() << ',' << bsl::endl;
             }
             else {
                 bsl::touch();
             }
 
-            if (mut_spos == mut_epos) {
-                bsl::alert() << "no debug data to dump\n";
-                return bsl::exit_success;
+            bsl::print() << "{\"name\":\"" << name << "\",\"ph\":\"i\",\"s\":\"t\",";
+            bsl::print() << "\"ts\":" << tsc << ",\"pid\":0,\"tid\":" << ppid << ',';
+            bsl::print() << "\"args\":{\"vpsid\":" << vpsid << ',';
+            bsl::print() << "\"data0\":\"" << bsl::hex(rec.data0) << "\",";
+            bsl::print() << "\"data1\":\"" << bsl::hex(rec.data1) << "\"}}";
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the trace ring of each PP from the loader and
+        ///     outputs the records in each, oldest first, as either Chrome
+        ///     trace events or CSV.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ctl the ioctl to the loader
+        ///   @param pmut_ctl_args the ioctl arguments to read the trace
+        ///     rings with
+        ///   @param json true to output JSON, false to output CSV
+        ///   @return Returns bsl::exit_success if the trace rings were
+        ///     successfully output, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        print_trace_rings(
+            ioctl const &ctl, loader::trace_vmm_args_t *const pmut_ctl_args, bool const json)
+            const noexcept -> bsl::exit_code
+        {
+            bool mut_first{true};
+
+            if (json) {
+                bsl::print() << "{\"traceEvents\":[" << bsl::endl;
+            }
+            else {
+                bsl::print() << "ppid,event,tsc,vpsid,data0,data1" << bsl::endl;
             }
 
-            while (mut_spos != mut_epos) {
-                if (!(pmut_ctl_args->debug_ring.buf.size() > mut_spos)) {
-                    mut_spos = {};
+            for (bsl::safe_uintmax mut_ppid{}; mut_ppid < HYPERVISOR_MAX_PPS; ++mut_ppid) {
+                pmut_ctl_args->op = loader::TRACE_VMM_OP_READ.get();
+                pmut_ctl_args->ppid = mut_ppid.get();
+
+                bsl::exit_code const ret{
+                    this->read_write_data(loader::TRACE_VMM, ctl, pmut_ctl_args)};
+                if (bsl::unlikely(bsl::exit_success != ret)) {
+                    return bsl::exit_failure;
+                }
+
+                /// NOTE:
+                /// - Once the trace ring has wrapped, epos points to the
+                ///   oldest record, otherwise the oldest record is at 0.
+                ///
+
+                auto const &ring{pmut_ctl_args->ring};
+                auto const num{bsl::to_umax(ring.num)};
+                auto mut_pos{bsl::to_umax(ring.epos)};
+                auto mut_count{num};
+
+                if (num > loader::TRACE_RING_MAX_RECORDS) {
+                    mut_count = loader::TRACE_RING_MAX_RECORDS;
                 }
                 else {
-                    bsl::touch();
+                    mut_pos = {};
                 }
 
-                bsl::print() << *pmut_ctl_args->debug_ring.buf.at_if(mut_spos);
-                ++mut_spos;
+                for (bsl::safe_uintmax mut_i{}; mut_i < mut_count; ++mut_i) {
+                    auto const *const rec{ring.records.at_if(mut_pos)};
+                    if (bsl::unlikely(nullptr == rec)) {
+                        break;
+                    }
+
+                    this->print_trace_record(mut_ppid, *rec, json, mut_first);
+                    mut_first = false;
+
+                    ++mut_pos;
+                    if (!(loader::TRACE_RING_MAX_RECORDS > mut_pos)) {
+                        mut_pos = {};
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+            }
+
+            if (json) {
+                bsl::print() << bsl::endl << "]}" << bsl::endl;
+            }
+            else {
+                bsl::touch();
             }
 
-            bsl::print() << bsl::endl;
             return bsl::exit_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Starts, stops or outputs a trace of the VMM given the
+        ///     trace command provided by the user and a set of ioctl
+        ///     arguments to send to the loader.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_args the user provided arguments
+        ///   @param pmut_ctl_args the ioctl arguments to send to the loader
+        ///   @return Returns bsl::exit_success if the trace command
+        ///     succeeded, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        trace_vmm(bsl::arguments &mut_args, loader::trace_vmm_args_t *const pmut_ctl_args)
+            const noexcept -> bsl::exit_code
+        {
+            auto const cmd{mut_args.front<bsl::string_view>()};
+            ++mut_args;
+
+            ioctl const ctl{loader::DEVICE_NAME};
+            if (bsl::unlikely(!ctl)) {
+                return bsl::exit_failure;
+            }
+
+            if (cmd == "start") {
+                bsl::safe_uintmax mut_mask{};
+                if (bsl::unlikely(!this->make_trace_mask(mut_args, mut_mask))) {
+                    return bsl::exit_failure;
+                }
+
+                pmut_ctl_args->op = loader::TRACE_VMM_OP_START.get();
+                pmut_ctl_args->mask = mut_mask.get();
+                return this->read_write_data(loader::TRACE_VMM, ctl, pmut_ctl_args);
+            }
+
+            if (cmd == "stop") {
+                pmut_ctl_args->op = loader::TRACE_VMM_OP_STOP.get();
+                return this->read_write_data(loader::TRACE_VMM, ctl, pmut_ctl_args);
+            }
+
+            if (cmd == "json") {
+                return this->print_trace_rings(ctl, pmut_ctl_args, true);
+            }
+
+            if (cmd == "csv") {
+                return this->print_trace_rings(ctl, pmut_ctl_args, false);
+            }
+
+            this->process_cmd_output_error(cmd);
+            return bsl::exit_failure;
+        }
+
         /// <!-- description -->
         ///   @brief Maps an ELF file by getting the filename and path from
         ///     the arguments provided by the user, opening the ELF file, and
@@ -437,6 +725,10 @@ namespace vmmctl
                 return this->dump_vmm(&m_dump_vmm_ctl_args);
             }
 
+            if (cmd == "trace") {
+                return this->trace_vmm(mut_args, &m_trace_vmm_ctl_args);
+            }
+
             this->process_cmd_output_error(cmd);
             return bsl::exit_failure;
         }